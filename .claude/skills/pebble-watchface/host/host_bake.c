@@ -0,0 +1,82 @@
+/**
+ * Host Bake
+ *
+ * Renders a face's SpriteBake poses (lib/sprite_atlas.h) and prints them for
+ * create_sprite_atlas.py. Linked instead of host_main.c: the face is built
+ * with -DSPRITE_ATLAS_BAKE -Dmain=pebble_app_main and its main() never runs.
+ *
+ * Each sprite is drawn twice, over black and over white. Pixels that come
+ * out the same both times are the sprite's; the rest are background and
+ * become transparent.
+ *
+ * Output:
+ *     bake <name> <count> <width> <height>
+ *     sprite <index> <dx> <dy> <w> <h> <clipped>   opaque bbox relative to the anchor
+ *     <h lines of w hex GColor8 bytes, 00 = transparent>
+ *     ...
+ */
+
+#include "host_internal.h"
+#include "sprite_atlas.h"
+
+static GColor s_pass[PBL_DISPLAY_HEIGHT][PBL_DISPLAY_WIDTH];
+
+static void prv_render(uint16_t index, GColor background) {
+    host_graphics_clear(background);
+    GContext ctx;
+    host_graphics_begin_layer(&ctx, GPointZero, GRect(0, 0, PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT));
+    g_sprite_bake.draw(&ctx, index, g_sprite_bake.anchor);
+}
+
+static void prv_bake(uint16_t index) {
+    prv_render(index, GColorBlack);
+    for (int y = 0; y < PBL_DISPLAY_HEIGHT; y++) {
+        for (int x = 0; x < PBL_DISPLAY_WIDTH; x++) {
+            s_pass[y][x] = host_frame_buffer_pixel(x, y);
+        }
+    }
+    prv_render(index, GColorWhite);
+
+    int x0 = PBL_DISPLAY_WIDTH, y0 = PBL_DISPLAY_HEIGHT, x1 = -1, y1 = -1;
+    for (int y = 0; y < PBL_DISPLAY_HEIGHT; y++) {
+        for (int x = 0; x < PBL_DISPLAY_WIDTH; x++) {
+            if (s_pass[y][x].argb != host_frame_buffer_pixel(x, y).argb) {
+                s_pass[y][x] = GColorClear;
+                continue;
+            }
+            if (x < x0) x0 = x;
+            if (x > x1) x1 = x;
+            if (y < y0) y0 = y;
+            if (y > y1) y1 = y;
+        }
+    }
+
+    if (x1 < 0) {
+        printf("sprite %u 0 0 0 0 0\n", index);
+        return;
+    }
+    // Touching the canvas edge: part of the pose was probably cut off
+    bool clipped = x0 == 0 || y0 == 0 || x1 == PBL_DISPLAY_WIDTH - 1 || y1 == PBL_DISPLAY_HEIGHT - 1;
+    printf("sprite %u %d %d %d %d %d\n", index, x0 - g_sprite_bake.anchor.x, y0 - g_sprite_bake.anchor.y,
+           x1 - x0 + 1, y1 - y0 + 1, clipped);
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            printf("%02x", s_pass[y][x].argb);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv) {
+    host_graphics_init();
+    host_runtime_init();
+
+    printf("bake %s %u %d %d\n", g_sprite_bake.name, g_sprite_bake.count, PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT);
+    for (uint16_t i = 0; i < g_sprite_bake.count; i++) {
+        prv_bake(i);
+    }
+
+    host_runtime_deinit();
+    host_graphics_deinit();
+    return 0;
+}
@@ -0,0 +1,737 @@
+/**
+ * Host Graphics
+ *
+ * Software GContext drawing into an in-memory frame buffer laid out like the
+ * watch's: 1-bit rows (20 bytes, LSB first) on aplite/diorite, one GColor8
+ * byte per pixel on basalt, and a 180x180 byte buffer whose rows are clipped
+ * to the visible circle on chalk. Shapes are close to, not bit-identical
+ * with, the firmware rasterizer; what matters for benchmarking is that the
+ * same calls touch roughly the same pixels. Every pixel write is counted.
+ */
+
+#include <math.h>
+#include "host_internal.h"
+
+#define BW_ROW_BYTES 20
+#define HOST_PATH_MAX_POINTS 256
+
+const char *const HOST_CALL_NAMES[HOST_NUM_CALLS] = {
+    "fill_rect", "draw_rect", "round_rect", "line", "pixel", "fill_circle",
+    "draw_circle", "path_filled", "path_outline", "bitmap", "text", "capture",
+    "update_proc", "state",
+};
+
+HostDrawStats g_host_stats;
+
+// System memory on the watch, so not counted against the app heap
+static uint8_t s_fb_data[PBL_DISPLAY_HEIGHT * PBL_DISPLAY_WIDTH];
+static GBitmap s_fb;
+static GContext s_ctx;
+static int16_t s_span_min[PBL_DISPLAY_HEIGHT];
+static int16_t s_span_max[PBL_DISPLAY_HEIGHT];
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+bool gpoint_equal(const GPoint *const a, const GPoint *const b) {
+    return a->x == b->x && a->y == b->y;
+}
+
+bool grect_equal(const GRect *const a, const GRect *const b) {
+    return gpoint_equal(&a->origin, &b->origin) && a->size.w == b->size.w && a->size.h == b->size.h;
+}
+
+bool grect_is_empty(const GRect *const rect) {
+    return rect->size.w == 0 || rect->size.h == 0;
+}
+
+static GRect prv_standardize(GRect r) {
+    if (r.size.w < 0) { r.origin.x += r.size.w; r.size.w = -r.size.w; }
+    if (r.size.h < 0) { r.origin.y += r.size.h; r.size.h = -r.size.h; }
+    return r;
+}
+
+bool grect_contains_point(const GRect *rect, const GPoint *point) {
+    GRect r = prv_standardize(*rect);
+    return point->x >= r.origin.x && point->x < r.origin.x + r.size.w &&
+           point->y >= r.origin.y && point->y < r.origin.y + r.size.h;
+}
+
+void grect_clip(GRect *const rect_to_clip, const GRect *const rect_clipper) {
+    GRect a = prv_standardize(*rect_to_clip);
+    GRect b = prv_standardize(*rect_clipper);
+    int x0 = a.origin.x > b.origin.x ? a.origin.x : b.origin.x;
+    int y0 = a.origin.y > b.origin.y ? a.origin.y : b.origin.y;
+    int x1 = a.origin.x + a.size.w < b.origin.x + b.size.w ? a.origin.x + a.size.w : b.origin.x + b.size.w;
+    int y1 = a.origin.y + a.size.h < b.origin.y + b.size.h ? a.origin.y + a.size.h : b.origin.y + b.size.h;
+    if (x1 <= x0 || y1 <= y0) {
+        *rect_to_clip = GRect(x0, y0, 0, 0);
+    } else {
+        *rect_to_clip = GRect(x0, y0, x1 - x0, y1 - y0);
+    }
+}
+
+GPoint grect_center_point(const GRect *rect) {
+    return GPoint(rect->origin.x + rect->size.w / 2, rect->origin.y + rect->size.h / 2);
+}
+
+GRect grect_crop(GRect rect, const int32_t crop_size_px) {
+    return GRect(rect.origin.x + crop_size_px, rect.origin.y + crop_size_px,
+                 rect.size.w - 2 * crop_size_px, rect.size.h - 2 * crop_size_px);
+}
+
+bool gcolor_equal(GColor8 x, GColor8 y) {
+    return x.argb == y.argb;
+}
+
+GColor8 gcolor_legible_over(GColor8 background_color) {
+    return background_color.r + background_color.g + background_color.b >= 5 ? GColorBlack : GColorWhite;
+}
+
+// ============================================================================
+// TRIG
+// ============================================================================
+
+int32_t sin_lookup(int32_t angle) {
+    return (int32_t)lround(sin(angle * (2.0 * M_PI / TRIG_MAX_ANGLE)) * TRIG_MAX_RATIO);
+}
+
+int32_t cos_lookup(int32_t angle) {
+    return (int32_t)lround(cos(angle * (2.0 * M_PI / TRIG_MAX_ANGLE)) * TRIG_MAX_RATIO);
+}
+
+int32_t atan2_lookup(int16_t y, int16_t x) {
+    double a = atan2(y, x) * (TRIG_MAX_ANGLE / (2.0 * M_PI));
+    int32_t angle = (int32_t)lround(a);
+    return angle < 0 ? angle + TRIG_MAX_ANGLE : angle % TRIG_MAX_ANGLE;
+}
+
+// ============================================================================
+// FRAME BUFFER
+// ============================================================================
+
+void host_graphics_init(void) {
+    s_fb.bounds = GRect(0, 0, PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT);
+#if defined(PBL_COLOR)
+    s_fb.row_bytes = PBL_DISPLAY_WIDTH;
+    s_fb.format = PBL_IF_ROUND_ELSE(GBitmapFormat8BitCircular, GBitmapFormat8Bit);
+#else
+    s_fb.row_bytes = BW_ROW_BYTES;
+    s_fb.format = GBitmapFormat1Bit;
+#endif
+    s_fb.data = s_fb_data;
+    memset(s_fb_data, 0, sizeof(s_fb_data));
+
+    for (int y = 0; y < PBL_DISPLAY_HEIGHT; y++) {
+#if defined(PBL_ROUND)
+        double dy = y + 0.5 - PBL_DISPLAY_HEIGHT / 2.0;
+        double half = sqrt(fmax(0, (PBL_DISPLAY_WIDTH / 2.0) * (PBL_DISPLAY_WIDTH / 2.0) - dy * dy));
+        s_span_min[y] = (int16_t)lround(PBL_DISPLAY_WIDTH / 2.0 - half);
+        s_span_max[y] = (int16_t)lround(PBL_DISPLAY_WIDTH / 2.0 + half) - 1;
+#else
+        s_span_min[y] = 0;
+        s_span_max[y] = PBL_DISPLAY_WIDTH - 1;
+#endif
+    }
+}
+
+void host_graphics_deinit(void) {
+    s_fb.data = NULL;
+}
+
+GContext *host_graphics_context(void) {
+    return &s_ctx;
+}
+
+GBitmap *host_frame_buffer(void) {
+    return &s_fb;
+}
+
+void host_row_span(int y, int16_t *min_x, int16_t *max_x) {
+    *min_x = s_span_min[y];
+    *max_x = s_span_max[y];
+}
+
+void host_graphics_begin_layer(GContext *ctx, GPoint offset, GRect clip) {
+    GRect screen = s_fb.bounds;
+    grect_clip(&clip, &screen);
+
+    ctx->fb = &s_fb;
+    ctx->offset = offset;
+    ctx->clip = clip;
+    ctx->stroke_color = GColorBlack;
+    ctx->fill_color = GColorBlack;
+    ctx->text_color = GColorBlack;
+    ctx->stroke_width = 1;
+    ctx->comp_op = GCompOpAssign;
+    ctx->antialiased = true;
+    ctx->fb_captured = false;
+}
+
+#if !defined(PBL_COLOR)
+// Grays are dithered on B/W screens, like the firmware does
+static bool prv_bw_white(GColor color, int x, int y) {
+    int lum = color.r + color.g + color.b;
+    if (lum <= 2) return false;
+    if (lum >= 7) return true;
+    return (x + y) & 1;
+}
+#endif
+
+static void prv_write(int x, int y, GColor color) {
+#if defined(PBL_COLOR)
+    s_fb.data[y * s_fb.row_bytes + x] = color.argb | 0xC0;
+#else
+    uint8_t *byte = &s_fb.data[y * s_fb.row_bytes + (x >> 3)];
+    if (prv_bw_white(color, x, y)) {
+        *byte |= 1 << (x & 7);
+    } else {
+        *byte &= ~(1 << (x & 7));
+    }
+#endif
+}
+
+GColor host_frame_buffer_pixel(int x, int y) {
+#if defined(PBL_COLOR)
+    return (GColor8){ .argb = s_fb.data[y * s_fb.row_bytes + x] };
+#else
+    return (s_fb.data[y * s_fb.row_bytes + (x >> 3)] >> (x & 7)) & 1 ? GColorWhite : GColorBlack;
+#endif
+}
+
+// ============================================================================
+// RASTER HELPERS (screen coordinates)
+// ============================================================================
+
+static void prv_hspan(GContext *ctx, int y, int x0, int x1, GColor color) {
+    if (color.a == 0) return;
+    if (y < ctx->clip.origin.y || y >= ctx->clip.origin.y + ctx->clip.size.h) return;
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+
+    int cx0 = ctx->clip.origin.x;
+    int cx1 = ctx->clip.origin.x + ctx->clip.size.w - 1;
+    if (x0 < cx0) x0 = cx0;
+    if (x1 > cx1) x1 = cx1;
+    if (x0 < s_span_min[y]) x0 = s_span_min[y];
+    if (x1 > s_span_max[y]) x1 = s_span_max[y];
+    if (x1 < x0) return;
+
+    for (int x = x0; x <= x1; x++) {
+        prv_write(x, y, color);
+    }
+    g_host_stats.pixels += x1 - x0 + 1;
+}
+
+static void prv_plot(GContext *ctx, int x, int y, GColor color) {
+    prv_hspan(ctx, y, x, x, color);
+}
+
+static int prv_isqrt(int v) {
+    return v <= 0 ? 0 : (int)sqrt((double)v);
+}
+
+static void prv_fill_disc(GContext *ctx, int cx, int cy, int r, GColor color) {
+    for (int dy = -r; dy <= r; dy++) {
+        int half = prv_isqrt(r * r - dy * dy);
+        prv_hspan(ctx, cy + dy, cx - half, cx + half, color);
+    }
+}
+
+// Even-odd scanline fill; vertices sit on pixel centers
+static void prv_fill_polygon(GContext *ctx, const double *xs, const double *ys, int n, GColor color) {
+    static double crossings[HOST_PATH_MAX_POINTS];
+    if (n < 3) return;
+    if (n > HOST_PATH_MAX_POINTS) n = HOST_PATH_MAX_POINTS;
+    double min_y = ys[0], max_y = ys[0];
+    for (int i = 1; i < n; i++) {
+        if (ys[i] < min_y) min_y = ys[i];
+        if (ys[i] > max_y) max_y = ys[i];
+    }
+
+
+    int y_end = (int)floor(max_y);
+    for (int y = (int)ceil(min_y); y <= y_end; y++) {
+        int count = 0;
+        for (int i = 0, j = n - 1; i < n; j = i++) {
+            double y0 = ys[j], y1 = ys[i];
+            if ((y0 <= y && y < y1) || (y1 <= y && y < y0)) {
+                crossings[count++] = xs[j] + (y - y0) * (xs[i] - xs[j]) / (y1 - y0);
+            }
+        }
+        for (int i = 1; i < count; i++) {
+            double v = crossings[i];
+            int k = i;
+            while (k > 0 && crossings[k - 1] > v) {
+                crossings[k] = crossings[k - 1];
+                k--;
+            }
+            crossings[k] = v;
+        }
+        for (int i = 0; i + 1 < count; i += 2) {
+            prv_hspan(ctx, y, (int)ceil(crossings[i]), (int)floor(crossings[i + 1]), color);
+        }
+    }
+}
+
+static void prv_line(GContext *ctx, int x0, int y0, int x1, int y1, GColor color, int width) {
+    if (width <= 1) {
+        int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+        int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+        int err = dx + dy;
+        for (;;) {
+            prv_plot(ctx, x0, y0, color);
+            if (x0 == x1 && y0 == y1) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x0 += sx; }
+            if (e2 <= dx) { err += dx; y0 += sy; }
+        }
+        return;
+    }
+
+    // Thick lines: a quad with round caps, like the firmware's capsules
+    double len = hypot(x1 - x0, y1 - y0);
+    double half = width / 2.0;
+    if (len > 0) {
+        double nx = -(y1 - y0) / len * half;
+        double ny = (x1 - x0) / len * half;
+        double xs[4] = { x0 + nx, x1 + nx, x1 - nx, x0 - nx };
+        double ys[4] = { y0 + ny, y1 + ny, y1 - ny, y0 - ny };
+        prv_fill_polygon(ctx, xs, ys, 4, color);
+    }
+    prv_fill_disc(ctx, x0, y0, (width - 1) / 2, color);
+    prv_fill_disc(ctx, x1, y1, (width - 1) / 2, color);
+}
+
+// Horizontal inset of a rounded corner `dy` rows from the straight edge
+static int prv_corner_inset(int r, int dy) {
+    double d = r - dy - 0.5;
+    return r - (int)lround(sqrt(fmax(0, (double)r * r - d * d)));
+}
+
+// ============================================================================
+// DRAWING STATE
+// ============================================================================
+
+void graphics_context_set_stroke_color(GContext *ctx, GColor color) {
+    host_count(HOST_CALL_STATE);
+    ctx->stroke_color = color;
+}
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color) {
+    host_count(HOST_CALL_STATE);
+    ctx->fill_color = color;
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color) {
+    host_count(HOST_CALL_STATE);
+    ctx->text_color = color;
+}
+
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode) {
+    host_count(HOST_CALL_STATE);
+    ctx->comp_op = mode;
+}
+
+void graphics_context_set_antialiased(GContext *ctx, bool enable) {
+    ctx->antialiased = enable;
+}
+
+void graphics_context_set_stroke_width(GContext *ctx, uint8_t stroke_width) {
+    host_count(HOST_CALL_STATE);
+    ctx->stroke_width = stroke_width ? stroke_width : 1;
+}
+
+// ============================================================================
+// PRIMITIVES
+// ============================================================================
+
+void graphics_draw_pixel(GContext *ctx, GPoint point) {
+    host_count(HOST_CALL_PIXEL);
+    prv_plot(ctx, point.x + ctx->offset.x, point.y + ctx->offset.y, ctx->stroke_color);
+}
+
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1) {
+    host_count(HOST_CALL_LINE);
+    prv_line(ctx, p0.x + ctx->offset.x, p0.y + ctx->offset.y, p1.x + ctx->offset.x, p1.y + ctx->offset.y,
+             ctx->stroke_color, ctx->stroke_width);
+}
+
+void graphics_draw_rect(GContext *ctx, GRect rect) {
+    host_count(HOST_CALL_DRAW_RECT);
+    GRect r = prv_standardize(rect);
+    if (grect_is_empty(&r)) return;
+    int x0 = r.origin.x + ctx->offset.x, y0 = r.origin.y + ctx->offset.y;
+    int x1 = x0 + r.size.w - 1, y1 = y0 + r.size.h - 1;
+    prv_hspan(ctx, y0, x0, x1, ctx->stroke_color);
+    if (y1 != y0) prv_hspan(ctx, y1, x0, x1, ctx->stroke_color);
+    for (int y = y0 + 1; y < y1; y++) {
+        prv_plot(ctx, x0, y, ctx->stroke_color);
+        if (x1 != x0) prv_plot(ctx, x1, y, ctx->stroke_color);
+    }
+}
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {
+    host_count(HOST_CALL_FILL_RECT);
+    GRect r = prv_standardize(rect);
+    if (grect_is_empty(&r)) return;
+
+    int radius = corner_radius;
+    if (radius > r.size.w / 2) radius = r.size.w / 2;
+    if (radius > r.size.h / 2) radius = r.size.h / 2;
+    if (corner_mask == GCornerNone) radius = 0;
+
+    int x0 = r.origin.x + ctx->offset.x, y0 = r.origin.y + ctx->offset.y;
+    int x1 = x0 + r.size.w - 1;
+    for (int row = 0; row < r.size.h; row++) {
+        int left = 0, right = 0;
+        if (row < radius) {
+            int inset = prv_corner_inset(radius, row);
+            if (corner_mask & GCornerTopLeft) left = inset;
+            if (corner_mask & GCornerTopRight) right = inset;
+        } else if (r.size.h - 1 - row < radius) {
+            int inset = prv_corner_inset(radius, r.size.h - 1 - row);
+            if (corner_mask & GCornerBottomLeft) left = inset;
+            if (corner_mask & GCornerBottomRight) right = inset;
+        }
+        prv_hspan(ctx, y0 + row, x0 + left, x1 - right, ctx->fill_color);
+    }
+}
+
+void graphics_draw_round_rect(GContext *ctx, GRect rect, uint16_t radius) {
+    host_count(HOST_CALL_ROUND_RECT);
+    GRect r = prv_standardize(rect);
+    if (grect_is_empty(&r)) return;
+    int rad = radius;
+    if (rad > r.size.w / 2) rad = r.size.w / 2;
+    if (rad > r.size.h / 2) rad = r.size.h / 2;
+
+    int x0 = r.origin.x + ctx->offset.x, y0 = r.origin.y + ctx->offset.y;
+    int x1 = x0 + r.size.w - 1, y1 = y0 + r.size.h - 1;
+    GColor c = ctx->stroke_color;
+    prv_hspan(ctx, y0, x0 + rad, x1 - rad, c);
+    prv_hspan(ctx, y1, x0 + rad, x1 - rad, c);
+    for (int y = y0 + rad; y <= y1 - rad; y++) {
+        prv_plot(ctx, x0, y, c);
+        prv_plot(ctx, x1, y, c);
+    }
+    // Corner arcs: connect each row's inset to the next one
+    for (int row = 0; row < rad; row++) {
+        int inset = prv_corner_inset(rad, row);
+        int next = row + 1 < rad ? prv_corner_inset(rad, row + 1) : 0;
+        int span_end = next < inset ? inset - 1 : inset;
+        if (span_end < next) span_end = next;
+        for (int x = next; x <= span_end; x++) {
+            prv_plot(ctx, x0 + x, y0 + row, c);
+            prv_plot(ctx, x1 - x, y0 + row, c);
+            prv_plot(ctx, x0 + x, y1 - row, c);
+            prv_plot(ctx, x1 - x, y1 - row, c);
+        }
+    }
+}
+
+void graphics_fill_circle(GContext *ctx, GPoint p, uint16_t radius) {
+    host_count(HOST_CALL_FILL_CIRCLE);
+    prv_fill_disc(ctx, p.x + ctx->offset.x, p.y + ctx->offset.y, radius, ctx->fill_color);
+}
+
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius) {
+    host_count(HOST_CALL_DRAW_CIRCLE);
+    int cx = p.x + ctx->offset.x, cy = p.y + ctx->offset.y;
+    GColor c = ctx->stroke_color;
+
+    if (ctx->stroke_width <= 1) {
+        // Midpoint circle, 8-way symmetric
+        int x = radius, y = 0, err = 1 - x;
+        while (x >= y) {
+            prv_plot(ctx, cx + x, cy + y, c); prv_plot(ctx, cx - x, cy + y, c);
+            prv_plot(ctx, cx + x, cy - y, c); prv_plot(ctx, cx - x, cy - y, c);
+            prv_plot(ctx, cx + y, cy + x, c); prv_plot(ctx, cx - y, cy + x, c);
+            prv_plot(ctx, cx + y, cy - x, c); prv_plot(ctx, cx - y, cy - x, c);
+            y++;
+            if (err < 0) {
+                err += 2 * y + 1;
+            } else {
+                x--;
+                err += 2 * (y - x) + 1;
+            }
+        }
+        return;
+    }
+
+    // Thick outline: annulus spans
+    int outer = radius + ctx->stroke_width / 2;
+    int inner = radius - (ctx->stroke_width + 1) / 2;
+    for (int dy = -outer; dy <= outer; dy++) {
+        int xo = prv_isqrt(outer * outer - dy * dy);
+        if (inner >= 0 && abs(dy) <= inner) {
+            int xi = prv_isqrt(inner * inner - dy * dy);
+            prv_hspan(ctx, cy + dy, cx - xo, cx - xi - 1, c);
+            prv_hspan(ctx, cy + dy, cx + xi + 1, cx + xo, c);
+        } else {
+            prv_hspan(ctx, cy + dy, cx - xo, cx + xo, c);
+        }
+    }
+}
+
+// ============================================================================
+// PATHS
+// ============================================================================
+
+GPath *gpath_create(const GPathInfo *init) {
+    GPath *path = calloc(1, sizeof(GPath));
+    if (!path) return NULL;
+    path->num_points = init->num_points;
+    path->points = init->points;
+    return path;
+}
+
+void gpath_destroy(GPath *gpath) {
+    free(gpath);
+}
+
+void gpath_rotate_to(GPath *path, int32_t angle) {
+    path->rotation = angle;
+}
+
+void gpath_move_to(GPath *path, GPoint point) {
+    path->offset = point;
+}
+
+static int prv_path_points(GContext *ctx, const GPath *path, double *xs, double *ys, int max) {
+    int n = path->num_points < (uint32_t)max ? (int)path->num_points : max;
+    int32_t s = sin_lookup(path->rotation), c = cos_lookup(path->rotation);
+    for (int i = 0; i < n; i++) {
+        GPoint p = path->points[i];
+        int32_t rx = (p.x * c - p.y * s) / TRIG_MAX_RATIO;
+        int32_t ry = (p.x * s + p.y * c) / TRIG_MAX_RATIO;
+        xs[i] = rx + path->offset.x + ctx->offset.x;
+        ys[i] = ry + path->offset.y + ctx->offset.y;
+    }
+    return n;
+}
+
+void gpath_draw_filled(GContext *ctx, GPath *path) {
+    host_count(HOST_CALL_PATH_FILLED);
+    double xs[HOST_PATH_MAX_POINTS], ys[HOST_PATH_MAX_POINTS];
+    int n = prv_path_points(ctx, path, xs, ys, HOST_PATH_MAX_POINTS);
+    prv_fill_polygon(ctx, xs, ys, n, ctx->fill_color);
+}
+
+void gpath_draw_outline(GContext *ctx, GPath *path) {
+    host_count(HOST_CALL_PATH_OUTLINE);
+    double xs[HOST_PATH_MAX_POINTS], ys[HOST_PATH_MAX_POINTS];
+    int n = prv_path_points(ctx, path, xs, ys, HOST_PATH_MAX_POINTS);
+    for (int i = 0; i < n; i++) {
+        int j = (i + 1) % n;
+        prv_line(ctx, (int)xs[i], (int)ys[i], (int)xs[j], (int)ys[j], ctx->stroke_color, ctx->stroke_width);
+    }
+}
+
+// ============================================================================
+// BITMAPS
+// ============================================================================
+
+static uint16_t prv_row_bytes(GBitmapFormat format, int16_t w) {
+    switch (format) {
+        case GBitmapFormat1Bit: return ((w + 31) / 32) * 4;
+        case GBitmapFormat1BitPalette: return (w + 7) / 8;
+        case GBitmapFormat2BitPalette: return (w + 3) / 4;
+        case GBitmapFormat4BitPalette: return (w + 1) / 2;
+        default: return w;
+    }
+}
+
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format) {
+    if (size.w <= 0 || size.h <= 0) return NULL;
+    GBitmap *bitmap = calloc(1, sizeof(GBitmap));
+    if (!bitmap) return NULL;
+    bitmap->row_bytes = prv_row_bytes(format, size.w);
+    bitmap->data = calloc(size.h, bitmap->row_bytes);
+    if (!bitmap->data) {
+        free(bitmap);
+        return NULL;
+    }
+    bitmap->bounds = GRect(0, 0, size.w, size.h);
+    bitmap->format = format;
+    bitmap->owns_data = true;
+    return bitmap;
+}
+
+// Resource file: width and height as little-endian uint16, then one GColor8
+// byte per pixel (alpha 0 = transparent). Always 8-bit, so on the watch a
+// palettized PNG takes less heap than the host reports.
+GBitmap *gbitmap_create_with_resource(uint32_t resource_id) {
+    if (!g_host_config.resource_dir) return NULL;
+    char path[512];
+    snprintf(path, sizeof(path), "%s/resource_%u.bin", g_host_config.resource_dir, (unsigned)resource_id);
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    uint8_t header[4];
+    GBitmap *bitmap = NULL;
+    if (fread(header, 1, sizeof(header), file) == sizeof(header)) {
+        GSize size = GSize(header[0] | header[1] << 8, header[2] | header[3] << 8);
+        bitmap = gbitmap_create_blank(size, GBitmapFormat8Bit);
+        if (bitmap && fread(bitmap->data, 1, (size_t)size.w * size.h, file) != (size_t)size.w * size.h) {
+            gbitmap_destroy(bitmap);
+            bitmap = NULL;
+        }
+    }
+    fclose(file);
+    return bitmap;
+}
+
+GBitmap *gbitmap_create_as_sub_bitmap(const GBitmap *base_bitmap, GRect sub_rect) {
+    GBitmap *bitmap = calloc(1, sizeof(GBitmap));
+    if (!bitmap) return NULL;
+    *bitmap = *base_bitmap;
+    grect_clip(&sub_rect, &base_bitmap->bounds);
+    bitmap->bounds = sub_rect;
+    bitmap->owns_data = false;
+    return bitmap;
+}
+
+void gbitmap_destroy(GBitmap *bitmap) {
+    if (!bitmap || bitmap == &s_fb) return;
+    if (bitmap->owns_data) free(bitmap->data);
+    free(bitmap);
+}
+
+GRect gbitmap_get_bounds(const GBitmap *bitmap) { return bitmap->bounds; }
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds) { bitmap->bounds = bounds; }
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap) { return bitmap->row_bytes; }
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap) { return bitmap->format; }
+uint8_t *gbitmap_get_data(const GBitmap *bitmap) { return bitmap->data; }
+
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y) {
+    GBitmapDataRowInfo info = {
+        .data = bitmap->data + (bitmap->bounds.origin.y + y) * bitmap->row_bytes,
+        .min_x = bitmap->bounds.origin.x,
+        .max_x = bitmap->bounds.origin.x + bitmap->bounds.size.w - 1,
+    };
+    if (bitmap == &s_fb && y < PBL_DISPLAY_HEIGHT) {
+        info.min_x = s_span_min[y];
+        info.max_x = s_span_max[y];
+    }
+    return info;
+}
+
+static bool prv_bit(const GBitmap *bitmap, int x, int y) {
+    return (bitmap->data[y * bitmap->row_bytes + (x >> 3)] >> (x & 7)) & 1;
+}
+
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect) {
+    host_count(HOST_CALL_BITMAP);
+    if (!bitmap || bitmap->format == GBitmapFormat1BitPalette ||
+        bitmap->format == GBitmapFormat2BitPalette || bitmap->format == GBitmapFormat4BitPalette) {
+        return;  // Palettized bitmaps only come from resources, which the host doesn't load
+    }
+
+    GRect dst = prv_standardize(rect);
+    dst.origin.x += ctx->offset.x;
+    dst.origin.y += ctx->offset.y;
+    GRect area = dst;
+    grect_clip(&area, &ctx->clip);
+    GRect src = bitmap->bounds;
+    if (grect_is_empty(&area) || grect_is_empty(&src)) return;
+
+    for (int y = area.origin.y; y < area.origin.y + area.size.h; y++) {
+        int sy = src.origin.y + (y - dst.origin.y) % src.size.h;
+        int x0 = area.origin.x > s_span_min[y] ? area.origin.x : s_span_min[y];
+        int x1 = area.origin.x + area.size.w - 1 < s_span_max[y] ? area.origin.x + area.size.w - 1 : s_span_max[y];
+
+        for (int x = x0; x <= x1; x++) {
+            int sx = src.origin.x + (x - dst.origin.x) % src.size.w;
+            GColor color;
+            if (bitmap->format == GBitmapFormat1Bit) {
+                bool white = prv_bit(bitmap, sx, sy);
+#if !defined(PBL_COLOR)
+                bool dst_white = prv_bit(&s_fb, x, y);
+                switch (ctx->comp_op) {
+                    case GCompOpAssignInverted: white = !white; break;
+                    case GCompOpOr: white = dst_white || white; break;
+                    case GCompOpAnd: white = dst_white && white; break;
+                    case GCompOpClear: white = dst_white && !white; break;
+                    case GCompOpSet: white = dst_white || !white; break;
+                    default: break;
+                }
+#endif
+                color = white ? GColorWhite : GColorBlack;
+            } else {
+                color.argb = bitmap->data[sy * bitmap->row_bytes + sx];
+                if (ctx->comp_op == GCompOpSet && color.a == 0) continue;
+                color.argb |= 0xC0;
+            }
+            prv_write(x, y, color);
+            g_host_stats.pixels++;
+        }
+    }
+}
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx) {
+    host_count(HOST_CALL_CAPTURE);
+    if (ctx->fb_captured) return NULL;
+    ctx->fb_captured = true;
+    return &s_fb;
+}
+
+GBitmap *graphics_capture_frame_buffer_format(GContext *ctx, GBitmapFormat format) {
+    return format == s_fb.format ? graphics_capture_frame_buffer(ctx) : NULL;
+}
+
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer) {
+    if (!ctx->fb_captured || buffer != &s_fb) return false;
+    ctx->fb_captured = false;
+    return true;
+}
+
+bool graphics_frame_buffer_is_captured(GContext *ctx) {
+    return ctx->fb_captured;
+}
+
+void host_graphics_clear(GColor color) {
+    GContext ctx;
+    host_graphics_begin_layer(&ctx, GPointZero, s_fb.bounds);
+    for (int y = 0; y < PBL_DISPLAY_HEIGHT; y++) {
+        prv_hspan(&ctx, y, 0, PBL_DISPLAY_WIDTH - 1, color);
+    }
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+
+#define HOST_MAX_FONTS 32
+
+static struct HostFont s_fonts[HOST_MAX_FONTS];
+static int s_num_fonts;
+
+GFont fonts_get_system_font(const char *font_key) {
+    for (int i = 0; i < s_num_fonts; i++) {
+        if (strcmp(s_fonts[i].key, font_key) == 0) return &s_fonts[i];
+    }
+    if (s_num_fonts == HOST_MAX_FONTS) return &s_fonts[0];
+
+    // Size is the first number in the key: RESOURCE_ID_GOTHIC_18_BOLD -> 18
+    const char *digits = font_key;
+    while (*digits && (*digits < '0' || *digits > '9')) digits++;
+    struct HostFont *font = &s_fonts[s_num_fonts++];
+    font->key = font_key;
+    font->height = *digits ? (int16_t)atoi(digits) : 14;
+    return font;
+}
+
+GSize graphics_text_layout_get_content_size(const char *text, GFont const font, const GRect box,
+                                            const GTextOverflowMode overflow_mode,
+                                            const GTextAlignment alignment) {
+    int height = font ? font->height : 14;
+    int w = text ? (int)strlen(text) * height / 2 : 0;
+    return GSize(w < box.size.w ? w : box.size.w, height);
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *text_attributes) {
+    host_count(HOST_CALL_TEXT);
+}
@@ -0,0 +1,122 @@
+/**
+ * Host runtime internals shared by host_runtime.c, host_graphics.c and
+ * host_main.c. Watchface code only sees pebble.h.
+ */
+
+#pragma once
+
+#include "pebble.h"
+
+// ============================================================================
+// DRAW STATISTICS
+// ============================================================================
+
+typedef enum {
+    HOST_CALL_FILL_RECT,
+    HOST_CALL_DRAW_RECT,
+    HOST_CALL_ROUND_RECT,
+    HOST_CALL_LINE,
+    HOST_CALL_PIXEL,
+    HOST_CALL_FILL_CIRCLE,
+    HOST_CALL_DRAW_CIRCLE,
+    HOST_CALL_PATH_FILLED,
+    HOST_CALL_PATH_OUTLINE,
+    HOST_CALL_BITMAP,
+    HOST_CALL_TEXT,
+    HOST_CALL_CAPTURE,
+    HOST_CALL_UPDATE_PROC,
+    HOST_CALL_STATE,            // Color, stroke width and compositing changes
+    HOST_NUM_CALLS
+} HostCall;
+
+extern const char *const HOST_CALL_NAMES[HOST_NUM_CALLS];
+
+typedef struct {
+    uint64_t calls[HOST_NUM_CALLS];
+    uint64_t pixels;            // Pixel writes, overdraw included
+} HostDrawStats;
+
+extern HostDrawStats g_host_stats;
+
+static inline void host_count(HostCall call) {
+    g_host_stats.calls[call]++;
+}
+
+// ============================================================================
+// GRAPHICS
+// ============================================================================
+
+struct GBitmap {
+    uint8_t *data;
+    uint16_t row_bytes;
+    GRect bounds;
+    GBitmapFormat format;
+    bool owns_data;
+};
+
+struct GContext {
+    GBitmap *fb;
+    GPoint offset;              // Drawing origin of the current layer
+    GRect clip;                 // Screen coordinates
+    GColor stroke_color;
+    GColor fill_color;
+    GColor text_color;
+    uint8_t stroke_width;
+    GCompOp comp_op;
+    bool antialiased;
+    bool fb_captured;
+};
+
+struct HostFont {
+    const char *key;
+    int16_t height;
+};
+
+// Allocates the platform frame buffer (1-bit on B/W, 8-bit elsewhere)
+void host_graphics_init(void);
+void host_graphics_deinit(void);
+GContext *host_graphics_context(void);
+GBitmap *host_frame_buffer(void);
+
+// Resets drawing state and clipping for one layer's update proc
+void host_graphics_begin_layer(GContext *ctx, GPoint offset, GRect clip);
+
+// Fills the whole screen (window background)
+void host_graphics_clear(GColor color);
+
+// Frame buffer pixel as 8-bit color (B/W platforms: black or white)
+GColor host_frame_buffer_pixel(int x, int y);
+
+// Visible span of a frame buffer row (round displays are narrower)
+void host_row_span(int y, int16_t *min_x, int16_t *max_x);
+
+// ============================================================================
+// RUNTIME
+// ============================================================================
+
+typedef struct {
+    uint32_t frames;            // Stop after this many render passes
+    uint32_t max_virtual_ms;    // ... or this much virtual time
+    uint32_t tap_interval_ms;   // Synthetic accel taps (0 = none)
+    uint16_t quick_view_h;      // Rows Timeline Quick View covers at the bottom (0 = none)
+    const char *resource_dir;   // Decoded bitmap resources (NULL = none)
+    bool verbose;               // Print APP_LOG output
+} HostConfig;
+
+typedef struct {
+    uint32_t frames;
+    uint64_t virtual_ms;
+    uint64_t update_ns;         // Timer, tick and tap callbacks
+    uint64_t render_ns;         // Layer tree traversal and update procs
+    uint64_t pixels_max;        // Most pixel writes in one frame
+    size_t heap_peak;           // Most bytes allocated at once
+} HostRunStats;
+
+extern HostConfig g_host_config;
+extern HostRunStats g_host_run;
+
+uint64_t host_now_ns(void);
+
+// Resets the virtual clock, services and stats before the face's main()
+void host_runtime_init(void);
+void host_runtime_deinit(void);
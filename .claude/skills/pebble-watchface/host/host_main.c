@@ -0,0 +1,134 @@
+/**
+ * Host Main
+ *
+ * Runs a watchface's main() headless and prints draw statistics as JSON.
+ * The face is compiled with -Dmain=pebble_app_main so this file owns the
+ * real entry point.
+ *
+ * Usage:
+ *     ./face [--frames N] [--max-virtual-s S] [--tap-ms MS] [--dump out.ppm]
+ *            [--resources DIR] [--verbose]
+ */
+
+#include "host_internal.h"
+
+int pebble_app_main(void);
+
+#if defined(PBL_PLATFORM_APLITE)
+#define HOST_PLATFORM "aplite"
+#elif defined(PBL_PLATFORM_CHALK)
+#define HOST_PLATFORM "chalk"
+#elif defined(PBL_PLATFORM_DIORITE)
+#define HOST_PLATFORM "diorite"
+#else
+#define HOST_PLATFORM "basalt"
+#endif
+
+static const char *s_dump_path;
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+// Binary PPM of the last rendered frame; pixels outside a round display are black
+static void prv_dump_frame(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT);
+    for (int y = 0; y < PBL_DISPLAY_HEIGHT; y++) {
+        int16_t min_x, max_x;
+        host_row_span(y, &min_x, &max_x);
+        for (int x = 0; x < PBL_DISPLAY_WIDTH; x++) {
+            GColor c = (x >= min_x && x <= max_x) ? host_frame_buffer_pixel(x, y) : GColorBlack;
+            uint8_t rgb[3] = { c.r * 85, c.g * 85, c.b * 85 };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+    fclose(file);
+}
+
+static void prv_print_stats(uint64_t wall_ns) {
+    const HostRunStats *run = &g_host_run;
+    double frames = run->frames ? run->frames : 1;
+    double draw_s = (run->update_ns + run->render_ns) / 1e9;
+
+    printf("{\n");
+    printf("  \"platform\": \"%s\",\n", HOST_PLATFORM);
+    printf("  \"frames\": %u,\n", run->frames);
+    printf("  \"virtual_ms\": %llu,\n", (unsigned long long)run->virtual_ms);
+    printf("  \"wall_ms\": %.1f,\n", wall_ns / 1e6);
+    printf("  \"fps\": %.0f,\n", draw_s > 0 ? run->frames / draw_s : 0.0);
+    printf("  \"virtual_fps\": %.2f,\n", run->virtual_ms ? run->frames * 1000.0 / run->virtual_ms : 0.0);
+    printf("  \"update_us\": %.2f,\n", run->update_ns / 1e3 / frames);
+    printf("  \"render_us\": %.2f,\n", run->render_ns / 1e3 / frames);
+    printf("  \"pixels_per_frame\": %.0f,\n", g_host_stats.pixels / frames);
+    printf("  \"pixels_max\": %llu,\n", (unsigned long long)run->pixels_max);
+    printf("  \"heap_peak\": %zu,\n", run->heap_peak);
+    printf("  \"calls_per_frame\": {");
+    for (int i = 0; i < HOST_NUM_CALLS; i++) {
+        printf("%s\n    \"%s\": %.2f", i ? "," : "", HOST_CALL_NAMES[i], g_host_stats.calls[i] / frames);
+    }
+    printf("\n  }\n}\n");
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void prv_usage(const char *argv0) {
+    fprintf(stderr, "Usage: %s [--frames N] [--max-virtual-s S] [--tap-ms MS] [--quick-view H] "
+            "[--dump out.ppm] [--resources DIR] [--verbose]\n", argv0);
+}
+
+static bool prv_parse_args(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--verbose") == 0) {
+            g_host_config.verbose = true;
+            continue;
+        }
+        if (!value) return false;
+        if (strcmp(arg, "--frames") == 0) {
+            g_host_config.frames = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(arg, "--max-virtual-s") == 0) {
+            g_host_config.max_virtual_ms = (uint32_t)(strtod(value, NULL) * 1000);
+        } else if (strcmp(arg, "--tap-ms") == 0) {
+            g_host_config.tap_interval_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(arg, "--quick-view") == 0) {
+            g_host_config.quick_view_h = (uint16_t)strtoul(value, NULL, 10);
+        } else if (strcmp(arg, "--dump") == 0) {
+            s_dump_path = value;
+        } else if (strcmp(arg, "--resources") == 0) {
+            g_host_config.resource_dir = value;
+        } else {
+            return false;
+        }
+        i++;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (!prv_parse_args(argc, argv)) {
+        prv_usage(argv[0]);
+        return 2;
+    }
+
+    host_graphics_init();
+    host_runtime_init();
+
+    uint64_t start = host_now_ns();
+    int result = pebble_app_main();
+    uint64_t wall_ns = host_now_ns() - start;
+
+    if (s_dump_path) prv_dump_frame(s_dump_path);
+    prv_print_stats(wall_ns);
+
+    host_runtime_deinit();
+    host_graphics_deinit();
+    return result;
+}
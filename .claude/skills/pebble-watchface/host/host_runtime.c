@@ -0,0 +1,791 @@
+/**
+ * Host Runtime
+ *
+ * Layers, windows, timers and event services on a virtual clock. The event
+ * loop jumps straight to the next timer, tick or synthetic tap instead of
+ * sleeping, so an hour of watch time runs in well under a second and every
+ * run of the same face is identical.
+ */
+
+#include <stdarg.h>
+#include <time.h>
+#include "host_internal.h"
+
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+#define HOST_START_TIME 1718359770ULL       // 2024-06-14 10:09:30 UTC
+#define HOST_HEAP_SIZE PBL_IF_COLOR_ELSE(64 * 1024, 24 * 1024)
+#define HOST_MAX_PERSIST 32
+
+HostConfig g_host_config = {
+    .frames = 2000,
+    .max_virtual_ms = 48u * 60 * 60 * 1000,
+    .tap_interval_ms = 0,
+    .verbose = false,
+};
+HostRunStats g_host_run;
+
+struct Layer {
+    GRect frame;
+    GRect bounds;
+    LayerUpdateProc update_proc;
+    Layer *parent;
+    Layer *first_child;
+    Layer *next_sibling;
+    bool hidden;
+    bool clips;
+    void *data;
+};
+
+struct TextLayer {
+    Layer layer;                // First, so the update proc can cast back
+    const char *text;
+    GFont font;
+    GColor background_color;
+    GColor text_color;
+    GTextAlignment alignment;
+    GTextOverflowMode overflow;
+};
+
+struct Window {
+    Layer *root;
+    WindowHandlers handlers;
+    GColor background_color;
+    ClickConfigProvider click_config_provider;
+    void *user_data;
+    bool loaded;
+};
+
+struct AppTimer {
+    uint64_t fire_at;
+    uint32_t pass;              // Event pass that registered it
+    AppTimerCallback callback;
+    void *data;
+    AppTimer *next;
+};
+
+typedef struct {
+    uint32_t key;
+    int size;
+    uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} PersistEntry;
+
+static uint64_t s_now_ms;
+static uint32_t s_pass;
+static bool s_render_pending;
+static Window *s_top_window;
+static AppTimer *s_timers;
+
+static TickHandler s_tick_handler;
+static TimeUnits s_tick_units;
+static uint64_t s_next_tick_ms;
+static struct tm s_last_tick_tm;
+
+static AccelTapHandler s_tap_handler;
+static uint64_t s_next_tap_ms;
+
+static PersistEntry s_persist[HOST_MAX_PERSIST];
+static int s_num_persist;
+
+static size_t s_heap_used;
+
+// ============================================================================
+// HEAP
+// ============================================================================
+
+typedef struct {
+    size_t size;
+    size_t pad;                 // Keeps the payload 16-byte aligned
+} HeapHeader;
+
+void *host_malloc(size_t size) {
+    HeapHeader *header = malloc(sizeof(HeapHeader) + size);
+    if (!header) return NULL;
+    header->size = size;
+    s_heap_used += size;
+    if (s_heap_used > g_host_run.heap_peak) g_host_run.heap_peak = s_heap_used;
+    return header + 1;
+}
+
+void *host_calloc(size_t count, size_t size) {
+    void *ptr = host_malloc(count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void host_free(void *ptr) {
+    if (!ptr) return;
+    HeapHeader *header = (HeapHeader *)ptr - 1;
+    s_heap_used -= header->size;
+    free(header);
+}
+
+void *host_realloc(void *ptr, size_t size) {
+    if (!ptr) return host_malloc(size);
+    size_t old_size = ((HeapHeader *)ptr - 1)->size;
+    void *grown = host_malloc(size);
+    if (!grown) return NULL;
+    memcpy(grown, ptr, old_size < size ? old_size : size);
+    host_free(ptr);
+    return grown;
+}
+
+size_t heap_bytes_used(void) {
+    return s_heap_used;
+}
+
+size_t heap_bytes_free(void) {
+    return s_heap_used < HOST_HEAP_SIZE ? HOST_HEAP_SIZE - s_heap_used : 0;
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+uint64_t host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+time_t host_time(time_t *tloc) {
+    time_t now = (time_t)(s_now_ms / 1000);
+    if (tloc) *tloc = now;
+    return now;
+}
+
+struct tm *host_localtime(const time_t *timep) {
+    return gmtime(timep);
+}
+
+uint16_t time_ms(time_t *t_utc, uint16_t *out_ms) {
+    uint16_t ms = s_now_ms % 1000;
+    if (t_utc) *t_utc = (time_t)(s_now_ms / 1000);
+    if (out_ms) *out_ms = ms;
+    return ms;
+}
+
+bool clock_is_24h_style(void) {
+    return true;
+}
+
+// ============================================================================
+// LAYERS
+// ============================================================================
+
+static void prv_layer_init(Layer *layer, GRect frame) {
+    memset(layer, 0, sizeof(Layer));
+    layer->frame = frame;
+    layer->bounds = GRect(0, 0, frame.size.w, frame.size.h);
+    layer->clips = true;
+}
+
+Layer *layer_create(GRect frame) {
+    return layer_create_with_data(frame, 0);
+}
+
+Layer *layer_create_with_data(GRect frame, size_t data_size) {
+    Layer *layer = host_malloc(sizeof(Layer) + data_size);
+    if (!layer) return NULL;
+    prv_layer_init(layer, frame);
+    if (data_size) {
+        layer->data = layer + 1;
+        memset(layer->data, 0, data_size);
+    }
+    return layer;
+}
+
+void *layer_get_data(const Layer *layer) {
+    return layer->data;
+}
+
+void layer_destroy(Layer *layer) {
+    if (!layer) return;
+    layer_remove_from_parent(layer);
+    layer_remove_child_layers(layer);
+    host_free(layer);
+}
+
+void layer_mark_dirty(Layer *layer) {
+    s_render_pending = true;
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+    layer->update_proc = update_proc;
+}
+
+void layer_set_frame(Layer *layer, GRect frame) {
+    // Like the firmware: bounds keep tracking the frame size while unscrolled
+    if (layer->bounds.origin.x == 0 && layer->bounds.origin.y == 0) {
+        layer->bounds.size = frame.size;
+    }
+    layer->frame = frame;
+    s_render_pending = true;
+}
+
+GRect layer_get_frame(const Layer *layer) {
+    return layer->frame;
+}
+
+void layer_set_bounds(Layer *layer, GRect bounds) {
+    layer->bounds = bounds;
+    s_render_pending = true;
+}
+
+GRect layer_get_bounds(const Layer *layer) {
+    return layer->bounds;
+}
+
+// Bounds minus whatever --quick-view covers at the bottom of the screen
+GRect layer_get_unobstructed_bounds(const Layer *layer) {
+    GRect bounds = layer->bounds;
+    if (!g_host_config.quick_view_h) return bounds;
+
+    int16_t screen_y = 0;
+    for (const Layer *l = layer; l; l = l->parent) screen_y += l->frame.origin.y;
+    int16_t bottom = PBL_DISPLAY_HEIGHT - g_host_config.quick_view_h - screen_y;
+    if (bounds.origin.y + bounds.size.h > bottom) {
+        bounds.size.h = bottom > bounds.origin.y ? bottom - bounds.origin.y : 0;
+    }
+    return bounds;
+}
+
+void layer_add_child(Layer *parent, Layer *child) {
+    layer_remove_from_parent(child);
+    child->parent = parent;
+    Layer **link = &parent->first_child;
+    while (*link) link = &(*link)->next_sibling;
+    *link = child;
+    s_render_pending = true;
+}
+
+void layer_remove_from_parent(Layer *child) {
+    if (!child->parent) return;
+    Layer **link = &child->parent->first_child;
+    while (*link && *link != child) link = &(*link)->next_sibling;
+    if (*link) *link = child->next_sibling;
+    child->parent = NULL;
+    child->next_sibling = NULL;
+    s_render_pending = true;
+}
+
+void layer_remove_child_layers(Layer *parent) {
+    while (parent->first_child) {
+        layer_remove_from_parent(parent->first_child);
+    }
+}
+
+void layer_set_hidden(Layer *layer, bool hidden) {
+    if (layer->hidden != hidden) s_render_pending = true;
+    layer->hidden = hidden;
+}
+
+bool layer_get_hidden(const Layer *layer) {
+    return layer->hidden;
+}
+
+void layer_set_clips(Layer *layer, bool clips) {
+    layer->clips = clips;
+}
+
+bool layer_get_clips(const Layer *layer) {
+    return layer->clips;
+}
+
+// ============================================================================
+// TEXT LAYERS
+// ============================================================================
+
+static void prv_text_layer_update(Layer *layer, GContext *ctx) {
+    TextLayer *text_layer = (TextLayer *)layer;
+    GRect bounds = layer->bounds;
+    if (text_layer->background_color.a) {
+        graphics_context_set_fill_color(ctx, text_layer->background_color);
+        graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    }
+    if (text_layer->text && text_layer->text[0]) {
+        graphics_context_set_text_color(ctx, text_layer->text_color);
+        graphics_draw_text(ctx, text_layer->text, text_layer->font, bounds,
+                           text_layer->overflow, text_layer->alignment, NULL);
+    }
+}
+
+TextLayer *text_layer_create(GRect frame) {
+    TextLayer *text_layer = host_calloc(1, sizeof(TextLayer));
+    if (!text_layer) return NULL;
+    prv_layer_init(&text_layer->layer, frame);
+    text_layer->layer.update_proc = prv_text_layer_update;
+    text_layer->font = fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+    text_layer->background_color = GColorWhite;
+    text_layer->text_color = GColorBlack;
+    return text_layer;
+}
+
+void text_layer_destroy(TextLayer *text_layer) {
+    if (!text_layer) return;
+    layer_remove_from_parent(&text_layer->layer);
+    host_free(text_layer);
+}
+
+Layer *text_layer_get_layer(TextLayer *text_layer) {
+    return &text_layer->layer;
+}
+
+void text_layer_set_text(TextLayer *text_layer, const char *text) {
+    text_layer->text = text;
+    s_render_pending = true;
+}
+
+const char *text_layer_get_text(TextLayer *text_layer) {
+    return text_layer->text;
+}
+
+void text_layer_set_background_color(TextLayer *text_layer, GColor color) {
+    text_layer->background_color = color;
+    s_render_pending = true;
+}
+
+void text_layer_set_text_color(TextLayer *text_layer, GColor color) {
+    text_layer->text_color = color;
+    s_render_pending = true;
+}
+
+void text_layer_set_font(TextLayer *text_layer, GFont font) {
+    text_layer->font = font;
+    s_render_pending = true;
+}
+
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment text_alignment) {
+    text_layer->alignment = text_alignment;
+}
+
+void text_layer_set_overflow_mode(TextLayer *text_layer, GTextOverflowMode line_mode) {
+    text_layer->overflow = line_mode;
+}
+
+GSize text_layer_get_content_size(TextLayer *text_layer) {
+    return graphics_text_layout_get_content_size(text_layer->text, text_layer->font, text_layer->layer.bounds,
+                                                text_layer->overflow, text_layer->alignment);
+}
+
+// ============================================================================
+// WINDOWS
+// ============================================================================
+
+Window *window_create(void) {
+    Window *window = host_calloc(1, sizeof(Window));
+    if (!window) return NULL;
+    window->root = layer_create(GRect(0, 0, PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT));
+    window->background_color = GColorWhite;
+    return window;
+}
+
+void window_destroy(Window *window) {
+    if (!window) return;
+    if (window == s_top_window) window_stack_remove(window, false);
+    layer_destroy(window->root);
+    host_free(window);
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+    window->handlers = handlers;
+}
+
+Layer *window_get_root_layer(const Window *window) {
+    return window->root;
+}
+
+void window_set_background_color(Window *window, GColor background_color) {
+    window->background_color = background_color;
+    s_render_pending = true;
+}
+
+void window_set_user_data(Window *window, void *data) {
+    window->user_data = data;
+}
+
+void *window_get_user_data(const Window *window) {
+    return window->user_data;
+}
+
+void window_stack_push(Window *window, bool animated) {
+    s_top_window = window;
+    if (!window->loaded) {
+        window->loaded = true;
+        if (window->handlers.load) window->handlers.load(window);
+    }
+    if (window->handlers.appear) window->handlers.appear(window);
+    if (window->click_config_provider) window->click_config_provider(window);
+    s_render_pending = true;
+}
+
+Window *window_stack_remove(Window *window, bool animated) {
+    if (window != s_top_window) return NULL;
+    if (window->handlers.disappear) window->handlers.disappear(window);
+    if (window->loaded) {
+        window->loaded = false;
+        if (window->handlers.unload) window->handlers.unload(window);
+    }
+    s_top_window = NULL;
+    return window;
+}
+
+// Buttons never fire on the host; handlers are accepted and dropped
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider) {
+    window->click_config_provider = click_config_provider;
+}
+
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler) {}
+
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+                                 ClickHandler down_handler, ClickHandler up_handler) {}
+
+// ============================================================================
+// RENDERING
+// ============================================================================
+
+static void prv_render_layer(Layer *layer, GContext *ctx, GPoint parent_origin, GRect parent_clip) {
+    if (layer->hidden) return;
+
+    GPoint origin = GPoint(parent_origin.x + layer->frame.origin.x, parent_origin.y + layer->frame.origin.y);
+    GRect clip = parent_clip;
+    if (layer->clips) {
+        GRect frame = { origin, layer->frame.size };
+        grect_clip(&clip, &frame);
+        if (grect_is_empty(&clip)) return;
+    }
+
+    GPoint content = GPoint(origin.x + layer->bounds.origin.x, origin.y + layer->bounds.origin.y);
+    if (layer->update_proc) {
+        host_graphics_begin_layer(ctx, content, clip);
+        host_count(HOST_CALL_UPDATE_PROC);
+        layer->update_proc(layer, ctx);
+    }
+    for (Layer *child = layer->first_child; child; child = child->next_sibling) {
+        prv_render_layer(child, ctx, content, clip);
+    }
+}
+
+static void prv_render(void) {
+    s_render_pending = false;
+    if (!s_top_window) return;
+
+    uint64_t pixels_before = g_host_stats.pixels;
+    uint64_t start = host_now_ns();
+
+    if (s_top_window->background_color.a) {
+        host_graphics_clear(s_top_window->background_color);
+    }
+    prv_render_layer(s_top_window->root, host_graphics_context(), GPointZero,
+                     GRect(0, 0, PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT));
+
+    g_host_run.render_ns += host_now_ns() - start;
+    g_host_run.frames++;
+    uint64_t pixels = g_host_stats.pixels - pixels_before;
+    if (pixels > g_host_run.pixels_max) g_host_run.pixels_max = pixels;
+}
+
+// ============================================================================
+// TIMERS
+// ============================================================================
+
+static bool prv_timer_live(AppTimer *timer) {
+    for (AppTimer *t = s_timers; t; t = t->next) {
+        if (t == timer) return true;
+    }
+    return false;
+}
+
+static void prv_timer_unlink(AppTimer *timer) {
+    AppTimer **link = &s_timers;
+    while (*link && *link != timer) link = &(*link)->next;
+    if (*link) *link = timer->next;
+}
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+    AppTimer *timer = host_calloc(1, sizeof(AppTimer));
+    if (!timer) return NULL;
+    timer->fire_at = s_now_ms + timeout_ms;
+    timer->pass = s_pass;
+    timer->callback = callback;
+    timer->data = callback_data;
+    timer->next = s_timers;
+    s_timers = timer;
+    return timer;
+}
+
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms) {
+    if (!prv_timer_live(timer_handle)) return false;
+    timer_handle->fire_at = s_now_ms + new_timeout_ms;
+    timer_handle->pass = s_pass;
+    return true;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+    if (!prv_timer_live(timer_handle)) return;
+    prv_timer_unlink(timer_handle);
+    host_free(timer_handle);
+}
+
+// Earliest timer that is due and was registered before this pass, so a
+// callback that re-registers itself with a 0 ms timeout can't spin
+static AppTimer *prv_due_timer(void) {
+    AppTimer *due = NULL;
+    for (AppTimer *t = s_timers; t; t = t->next) {
+        if (t->fire_at <= s_now_ms && t->pass < s_pass && (!due || t->fire_at < due->fire_at)) {
+            due = t;
+        }
+    }
+    return due;
+}
+
+// ============================================================================
+// SERVICES
+// ============================================================================
+
+static uint64_t prv_tick_period_ms(TimeUnits units) {
+    if (units & SECOND_UNIT) return 1000;
+    if (units & MINUTE_UNIT) return 60 * 1000;
+    if (units & HOUR_UNIT) return 60 * 60 * 1000;
+    return 24 * 60 * 60 * 1000;
+}
+
+static void prv_schedule_tick(void) {
+    uint64_t period = prv_tick_period_ms(s_tick_units);
+    s_next_tick_ms = (s_now_ms / period + 1) * period;
+}
+
+static void prv_fire_tick(void) {
+    time_t now = (time_t)(s_now_ms / 1000);
+    struct tm tick_time = *gmtime(&now);
+
+    TimeUnits changed = 0;
+    if (tick_time.tm_sec != s_last_tick_tm.tm_sec) changed |= SECOND_UNIT;
+    if (tick_time.tm_min != s_last_tick_tm.tm_min) changed |= MINUTE_UNIT;
+    if (tick_time.tm_hour != s_last_tick_tm.tm_hour) changed |= HOUR_UNIT;
+    if (tick_time.tm_mday != s_last_tick_tm.tm_mday) changed |= DAY_UNIT;
+    if (tick_time.tm_mon != s_last_tick_tm.tm_mon) changed |= MONTH_UNIT;
+    if (tick_time.tm_year != s_last_tick_tm.tm_year) changed |= YEAR_UNIT;
+    s_last_tick_tm = tick_time;
+
+    prv_schedule_tick();
+    if (changed & s_tick_units) s_tick_handler(&tick_time, changed);
+}
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+    time_t now = (time_t)(s_now_ms / 1000);
+    s_last_tick_tm = *gmtime(&now);
+    s_tick_units = tick_units;
+    s_tick_handler = handler;
+    prv_schedule_tick();
+}
+
+void tick_timer_service_unsubscribe(void) {
+    s_tick_handler = NULL;
+}
+
+void accel_tap_service_subscribe(AccelTapHandler handler) {
+    s_tap_handler = handler;
+    s_next_tap_ms = s_now_ms + g_host_config.tap_interval_ms;
+}
+
+void accel_tap_service_unsubscribe(void) {
+    s_tap_handler = NULL;
+}
+
+// Accepted so faces link; the host only emits taps and ticks
+void accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler) {}
+void accel_data_service_unsubscribe(void) {}
+int accel_service_set_sampling_rate(AccelSamplingRate rate) { return 0; }
+int accel_service_set_samples_per_update(uint32_t num_samples) { return 0; }
+
+void battery_state_service_subscribe(BatteryStateHandler handler) {}
+void battery_state_service_unsubscribe(void) {}
+BatteryChargeState battery_state_service_peek(void) {
+    return (BatteryChargeState){ .charge_percent = 80, .is_charging = false, .is_plugged = false };
+}
+
+void bluetooth_connection_service_subscribe(BluetoothConnectionHandler handler) {}
+void bluetooth_connection_service_unsubscribe(void) {}
+bool bluetooth_connection_service_peek(void) { return true; }
+
+void app_focus_service_subscribe(AppFocusHandler handler) {}
+void app_focus_service_unsubscribe(void) {}
+
+// No worker process on the host: the face runs as if the user declined it
+bool app_worker_is_running(void) { return false; }
+AppWorkerResult app_worker_launch(void) { return APP_WORKER_RESULT_NO_WORKER; }
+AppWorkerResult app_worker_kill(void) { return APP_WORKER_RESULT_NOT_RUNNING; }
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler) { return true; }
+bool app_worker_message_unsubscribe(void) { return true; }
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data) {}
+
+void unobstructed_area_service_subscribe(UnobstructedAreaHandlers handlers, void *context) {}
+void unobstructed_area_service_unsubscribe(void) {}
+
+void vibes_short_pulse(void) {}
+void vibes_long_pulse(void) {}
+void vibes_double_pulse(void) {}
+void light_enable_interaction(void) {}
+
+// ============================================================================
+// PERSISTENT STORAGE (in memory, empty at launch)
+// ============================================================================
+
+static PersistEntry *prv_persist_find(uint32_t key) {
+    for (int i = 0; i < s_num_persist; i++) {
+        if (s_persist[i].key == key) return &s_persist[i];
+    }
+    return NULL;
+}
+
+bool persist_exists(const uint32_t key) {
+    return prv_persist_find(key) != NULL;
+}
+
+int persist_get_size(const uint32_t key) {
+    PersistEntry *entry = prv_persist_find(key);
+    return entry ? entry->size : E_DOES_NOT_EXIST;
+}
+
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size) {
+    PersistEntry *entry = prv_persist_find(key);
+    if (!entry) return E_DOES_NOT_EXIST;
+    int size = (size_t)entry->size < buffer_size ? entry->size : (int)buffer_size;
+    memcpy(buffer, entry->data, size);
+    return size;
+}
+
+bool persist_read_bool(const uint32_t key) {
+    bool value = false;
+    persist_read_data(key, &value, sizeof(value));
+    return value;
+}
+
+int32_t persist_read_int(const uint32_t key) {
+    int32_t value = 0;
+    persist_read_data(key, &value, sizeof(value));
+    return value;
+}
+
+int persist_write_data(const uint32_t key, const void *data, const size_t size) {
+    if (size > PERSIST_DATA_MAX_LENGTH) return E_INVALID_ARGUMENT;
+    PersistEntry *entry = prv_persist_find(key);
+    if (!entry) {
+        if (s_num_persist == HOST_MAX_PERSIST) return E_ERROR;
+        entry = &s_persist[s_num_persist++];
+        entry->key = key;
+    }
+    memcpy(entry->data, data, size);
+    entry->size = (int)size;
+    return (int)size;
+}
+
+status_t persist_write_bool(const uint32_t key, const bool value) {
+    int written = persist_write_data(key, &value, sizeof(value));
+    return written < 0 ? written : S_SUCCESS;
+}
+
+status_t persist_write_int(const uint32_t key, const int32_t value) {
+    int written = persist_write_data(key, &value, sizeof(value));
+    return written < 0 ? written : S_SUCCESS;
+}
+
+status_t persist_delete(const uint32_t key) {
+    PersistEntry *entry = prv_persist_find(key);
+    if (!entry) return E_DOES_NOT_EXIST;
+    *entry = s_persist[--s_num_persist];
+    return S_SUCCESS;
+}
+
+// ============================================================================
+// LOGGING
+// ============================================================================
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...) {
+    if (!g_host_config.verbose) return;
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "[%s:%d] ", src_filename, src_line_number);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+// ============================================================================
+// EVENT LOOP
+// ============================================================================
+
+static uint64_t prv_next_event_ms(void) {
+    uint64_t next = UINT64_MAX;
+    for (AppTimer *t = s_timers; t; t = t->next) {
+        if (t->fire_at < next) next = t->fire_at;
+    }
+    if (s_tick_handler && s_next_tick_ms < next) next = s_next_tick_ms;
+    if (s_tap_handler && g_host_config.tap_interval_ms && s_next_tap_ms < next) next = s_next_tap_ms;
+    return next;
+}
+
+static void prv_dispatch(void) {
+    s_pass++;
+
+    AppTimer *timer;
+    while ((timer = prv_due_timer())) {
+        prv_timer_unlink(timer);
+        AppTimerCallback callback = timer->callback;
+        void *data = timer->data;
+        host_free(timer);
+        callback(data);
+    }
+    if (s_tick_handler && s_next_tick_ms <= s_now_ms) {
+        prv_fire_tick();
+    }
+    if (s_tap_handler && g_host_config.tap_interval_ms && s_next_tap_ms <= s_now_ms) {
+        s_next_tap_ms = s_now_ms + g_host_config.tap_interval_ms;
+        s_tap_handler(ACCEL_AXIS_Z, 1);
+    }
+}
+
+void app_event_loop(void) {
+    uint64_t start_ms = s_now_ms;
+    uint64_t end_ms = s_now_ms + g_host_config.max_virtual_ms;
+
+    if (s_render_pending) prv_render();
+    while (g_host_run.frames < g_host_config.frames) {
+        uint64_t next = prv_next_event_ms();
+        if (next == UINT64_MAX || next > end_ms) break;
+        s_now_ms = next;
+
+        uint64_t t0 = host_now_ns();
+        prv_dispatch();
+        g_host_run.update_ns += host_now_ns() - t0;
+
+        if (s_render_pending) prv_render();
+    }
+
+    g_host_run.virtual_ms = s_now_ms - start_ms;
+}
+
+void host_runtime_init(void) {
+    s_now_ms = HOST_START_TIME * 1000;
+    s_pass = 0;
+    s_render_pending = false;
+    s_top_window = NULL;
+    s_timers = NULL;
+    s_tick_handler = NULL;
+    s_tap_handler = NULL;
+    s_num_persist = 0;
+    memset(&g_host_run, 0, sizeof(g_host_run));
+    memset(&g_host_stats, 0, sizeof(g_host_stats));
+}
+
+void host_runtime_deinit(void) {
+    while (s_timers) {
+        AppTimer *timer = s_timers;
+        s_timers = timer->next;
+        host_free(timer);
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * Host Tables
+ *
+ * Entry point for bake_tables.py. Linked instead of host_main.c: the face's
+ * TABLE_BAKE sources define table_bake(), which simulates whatever the face
+ * wants precomputed and prints it as C (the body of src/c/baked_tables.h).
+ * Only the sources that mention TABLE_BAKE are built, so the face's main()
+ * and the header being generated are never compiled.
+ */
+
+#include "host_internal.h"
+
+void table_bake(void);
+
+int main(int argc, char **argv) {
+    host_graphics_init();
+    host_runtime_init();
+    table_bake();
+    host_runtime_deinit();
+    host_graphics_deinit();
+    return 0;
+}
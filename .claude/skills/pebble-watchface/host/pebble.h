@@ -0,0 +1,545 @@
+/**
+ * Host pebble.h
+ *
+ * Just enough of the Pebble SDK to compile watchface C code natively and
+ * run it headless on the host (see host_runtime.c / host_graphics.c). Used
+ * by scripts/benchmark.py; not part of watch builds.
+ *
+ * Select the platform with -DPBL_PLATFORM_APLITE / _BASALT / _CHALK /
+ * _DIORITE (default basalt).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+// ============================================================================
+// PLATFORM
+// ============================================================================
+
+#if defined(PBL_PLATFORM_APLITE)
+#define PBL_BW 1
+#define PBL_RECT 1
+#elif defined(PBL_PLATFORM_CHALK)
+#define PBL_COLOR 1
+#define PBL_ROUND 1
+#elif defined(PBL_PLATFORM_DIORITE)
+#define PBL_BW 1
+#define PBL_RECT 1
+#else
+#ifndef PBL_PLATFORM_BASALT
+#define PBL_PLATFORM_BASALT 1
+#endif
+#define PBL_COLOR 1
+#define PBL_RECT 1
+#endif
+
+#if defined(PBL_ROUND)
+#define PBL_DISPLAY_WIDTH 180
+#define PBL_DISPLAY_HEIGHT 180
+#else
+#define PBL_DISPLAY_WIDTH 144
+#define PBL_DISPLAY_HEIGHT 168
+#endif
+
+#ifdef PBL_COLOR
+#define PBL_IF_COLOR_ELSE(if_true, if_false) (if_true)
+#define PBL_IF_BW_ELSE(if_true, if_false) (if_false)
+#else
+#define PBL_IF_COLOR_ELSE(if_true, if_false) (if_false)
+#define PBL_IF_BW_ELSE(if_true, if_false) (if_true)
+#endif
+#ifdef PBL_ROUND
+#define PBL_IF_ROUND_ELSE(if_true, if_false) (if_true)
+#define PBL_IF_RECT_ELSE(if_true, if_false) (if_false)
+#else
+#define PBL_IF_ROUND_ELSE(if_true, if_false) (if_false)
+#define PBL_IF_RECT_ELSE(if_true, if_false) (if_true)
+#endif
+
+// Only the APIs that differ between the emulated platforms are listed
+#define PBL_API_EXISTS(api) PBL_API_EXISTS_##api
+#if !defined(PBL_PLATFORM_APLITE)
+#define PBL_API_EXISTS_unobstructed_area_service_subscribe 1
+#define PBL_API_EXISTS_layer_get_unobstructed_bounds 1
+#endif
+
+#define ARRAY_LENGTH(array) (sizeof((array)) / sizeof((array)[0]))
+
+// Virtual clock: time(), localtime() and time_ms() follow the host event
+// loop, not the wall clock, so runs are reproducible
+time_t host_time(time_t *tloc);
+struct tm *host_localtime(const time_t *timep);
+#define time(tloc) host_time(tloc)
+#define localtime(timep) host_localtime(timep)
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+typedef struct { int16_t x, y; } GPoint;
+typedef struct { int16_t w, h; } GSize;
+typedef struct { GPoint origin; GSize size; } GRect;
+#define GPoint(x, y) ((GPoint){(x), (y)})
+#define GSize(w, h) ((GSize){(w), (h)})
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+#define GPointZero GPoint(0, 0)
+#define GSizeZero GSize(0, 0)
+#define GRectZero GRect(0, 0, 0, 0)
+
+bool gpoint_equal(const GPoint *const point_a, const GPoint *const point_b);
+bool grect_equal(const GRect *const rect_a, const GRect *const rect_b);
+bool grect_is_empty(const GRect *const rect);
+bool grect_contains_point(const GRect *rect, const GPoint *point);
+void grect_clip(GRect *const rect_to_clip, const GRect *const rect_clipper);
+GPoint grect_center_point(const GRect *rect);
+GRect grect_crop(GRect rect, const int32_t crop_size_px);
+
+// ============================================================================
+// COLOR
+// ============================================================================
+
+typedef union GColor8 {
+    uint8_t argb;
+    struct { uint8_t b:2; uint8_t g:2; uint8_t r:2; uint8_t a:2; };
+} GColor8;
+typedef GColor8 GColor;
+
+#define GColorFromRGBA(red, green, blue, alpha) ((GColor8){.argb = (uint8_t)( \
+    ((((alpha) >> 6) & 3) << 6) | ((((red) >> 6) & 3) << 4) | \
+    ((((green) >> 6) & 3) << 2) | (((blue) >> 6) & 3))})
+#define GColorFromRGB(red, green, blue) GColorFromRGBA(red, green, blue, 255)
+#define GColorFromHEX(v) GColorFromRGB(((v) >> 16) & 0xFF, ((v) >> 8) & 0xFF, (v) & 0xFF)
+#define GColorClear ((GColor8){.argb = 0x00})
+#define GColorBlack GColorFromHEX(0x000000)
+#define GColorOxfordBlue GColorFromHEX(0x000055)
+#define GColorDukeBlue GColorFromHEX(0x0000AA)
+#define GColorBlue GColorFromHEX(0x0000FF)
+#define GColorDarkGreen GColorFromHEX(0x005500)
+#define GColorMidnightGreen GColorFromHEX(0x005555)
+#define GColorCobaltBlue GColorFromHEX(0x0055AA)
+#define GColorBlueMoon GColorFromHEX(0x0055FF)
+#define GColorIslamicGreen GColorFromHEX(0x00AA00)
+#define GColorJaegerGreen GColorFromHEX(0x00AA55)
+#define GColorTiffanyBlue GColorFromHEX(0x00AAAA)
+#define GColorVividCerulean GColorFromHEX(0x00AAFF)
+#define GColorGreen GColorFromHEX(0x00FF00)
+#define GColorMalachite GColorFromHEX(0x00FF55)
+#define GColorMediumSpringGreen GColorFromHEX(0x00FFAA)
+#define GColorCyan GColorFromHEX(0x00FFFF)
+#define GColorBulgarianRose GColorFromHEX(0x550000)
+#define GColorImperialPurple GColorFromHEX(0x550055)
+#define GColorIndigo GColorFromHEX(0x5500AA)
+#define GColorElectricUltramarine GColorFromHEX(0x5500FF)
+#define GColorArmyGreen GColorFromHEX(0x555500)
+#define GColorDarkGray GColorFromHEX(0x555555)
+#define GColorLiberty GColorFromHEX(0x5555AA)
+#define GColorVeryLightBlue GColorFromHEX(0x5555FF)
+#define GColorKellyGreen GColorFromHEX(0x55AA00)
+#define GColorMayGreen GColorFromHEX(0x55AA55)
+#define GColorCadetBlue GColorFromHEX(0x55AAAA)
+#define GColorPictonBlue GColorFromHEX(0x55AAFF)
+#define GColorBrightGreen GColorFromHEX(0x55FF00)
+#define GColorScreaminGreen GColorFromHEX(0x55FF55)
+#define GColorMediumAquamarine GColorFromHEX(0x55FFAA)
+#define GColorElectricBlue GColorFromHEX(0x55FFFF)
+#define GColorDarkCandyAppleRed GColorFromHEX(0xAA0000)
+#define GColorJazzberryJam GColorFromHEX(0xAA0055)
+#define GColorPurple GColorFromHEX(0xAA00AA)
+#define GColorVividViolet GColorFromHEX(0xAA00FF)
+#define GColorWindsorTan GColorFromHEX(0xAA5500)
+#define GColorRoseVale GColorFromHEX(0xAA5555)
+#define GColorPurpureus GColorFromHEX(0xAA55AA)
+#define GColorLavenderIndigo GColorFromHEX(0xAA55FF)
+#define GColorLimerick GColorFromHEX(0xAAAA00)
+#define GColorBrass GColorFromHEX(0xAAAA55)
+#define GColorLightGray GColorFromHEX(0xAAAAAA)
+#define GColorBabyBlueEyes GColorFromHEX(0xAAAAFF)
+#define GColorSpringBud GColorFromHEX(0xAAFF00)
+#define GColorInchworm GColorFromHEX(0xAAFF55)
+#define GColorMintGreen GColorFromHEX(0xAAFFAA)
+#define GColorCeleste GColorFromHEX(0xAAFFFF)
+#define GColorRed GColorFromHEX(0xFF0000)
+#define GColorFolly GColorFromHEX(0xFF0055)
+#define GColorFashionMagenta GColorFromHEX(0xFF00AA)
+#define GColorMagenta GColorFromHEX(0xFF00FF)
+#define GColorOrange GColorFromHEX(0xFF5500)
+#define GColorSunsetOrange GColorFromHEX(0xFF5555)
+#define GColorBrilliantRose GColorFromHEX(0xFF55AA)
+#define GColorShockingPink GColorFromHEX(0xFF55FF)
+#define GColorChromeYellow GColorFromHEX(0xFFAA00)
+#define GColorRajah GColorFromHEX(0xFFAA55)
+#define GColorMelon GColorFromHEX(0xFFAAAA)
+#define GColorRichBrilliantLavender GColorFromHEX(0xFFAAFF)
+#define GColorYellow GColorFromHEX(0xFFFF00)
+#define GColorIcterine GColorFromHEX(0xFFFF55)
+#define GColorPastelYellow GColorFromHEX(0xFFFFAA)
+#define GColorWhite GColorFromHEX(0xFFFFFF)
+
+bool gcolor_equal(GColor8 x, GColor8 y);
+GColor8 gcolor_legible_over(GColor8 background_color);
+
+// ============================================================================
+// GRAPHICS
+// ============================================================================
+
+typedef enum {
+    GCornerNone = 0,
+    GCornerTopLeft = 1 << 0,
+    GCornerTopRight = 1 << 1,
+    GCornerBottomLeft = 1 << 2,
+    GCornerBottomRight = 1 << 3,
+    GCornersAll = 0x0F,
+    GCornersTop = GCornerTopLeft | GCornerTopRight,
+    GCornersBottom = GCornerBottomLeft | GCornerBottomRight,
+    GCornersLeft = GCornerTopLeft | GCornerBottomLeft,
+    GCornersRight = GCornerTopRight | GCornerBottomRight,
+} GCornerMask;
+
+typedef enum {
+    GCompOpAssign,
+    GCompOpAssignInverted,
+    GCompOpOr,
+    GCompOpAnd,
+    GCompOpClear,
+    GCompOpSet,
+} GCompOp;
+
+typedef enum {
+    GBitmapFormat1Bit = 0,
+    GBitmapFormat8Bit,
+    GBitmapFormat1BitPalette,
+    GBitmapFormat2BitPalette,
+    GBitmapFormat4BitPalette,
+    GBitmapFormat8BitCircular,
+} GBitmapFormat;
+
+typedef enum { GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight } GTextAlignment;
+typedef enum { GTextOverflowModeWordWrap, GTextOverflowModeTrailingEllipsis, GTextOverflowModeFill } GTextOverflowMode;
+
+typedef struct GContext GContext;
+typedef struct GBitmap GBitmap;
+typedef struct HostFont *GFont;
+typedef struct GTextAttributes GTextAttributes;
+
+typedef struct {
+    uint8_t *data;      // data[min_x..max_x] are valid for the row
+    int16_t min_x;
+    int16_t max_x;
+} GBitmapDataRowInfo;
+
+void graphics_context_set_stroke_color(GContext *ctx, GColor color);
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode);
+void graphics_context_set_antialiased(GContext *ctx, bool enable);
+void graphics_context_set_stroke_width(GContext *ctx, uint8_t stroke_width);
+
+void graphics_draw_pixel(GContext *ctx, GPoint point);
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1);
+void graphics_draw_rect(GContext *ctx, GRect rect);
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void graphics_draw_round_rect(GContext *ctx, GRect rect, uint16_t radius);
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius);
+void graphics_fill_circle(GContext *ctx, GPoint p, uint16_t radius);
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect);
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx);
+GBitmap *graphics_capture_frame_buffer_format(GContext *ctx, GBitmapFormat format);
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+bool graphics_frame_buffer_is_captured(GContext *ctx);
+
+// Text is counted, not rasterized: the host has no fonts
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *text_attributes);
+GSize graphics_text_layout_get_content_size(const char *text, GFont const font, const GRect box,
+                                            const GTextOverflowMode overflow_mode,
+                                            const GTextAlignment alignment);
+
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format);
+// Loads <resource dir>/resource_<id>.bin written by benchmark.py; NULL without one
+GBitmap *gbitmap_create_with_resource(uint32_t resource_id);
+GBitmap *gbitmap_create_as_sub_bitmap(const GBitmap *base_bitmap, GRect sub_rect);
+void gbitmap_destroy(GBitmap *bitmap);
+GRect gbitmap_get_bounds(const GBitmap *bitmap);
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds);
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap);
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap);
+uint8_t *gbitmap_get_data(const GBitmap *bitmap);
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y);
+
+typedef struct {
+    uint32_t num_points;
+    GPoint *points;
+} GPathInfo;
+
+typedef struct GPath {
+    uint32_t num_points;
+    GPoint *points;
+    int32_t rotation;
+    GPoint offset;
+} GPath;
+
+GPath *gpath_create(const GPathInfo *init);
+void gpath_destroy(GPath *gpath);
+void gpath_draw_filled(GContext *ctx, GPath *path);
+void gpath_draw_outline(GContext *ctx, GPath *path);
+void gpath_rotate_to(GPath *path, int32_t angle);
+void gpath_move_to(GPath *path, GPoint point);
+
+#define TRIG_MAX_RATIO 0xffff
+#define TRIG_MAX_ANGLE 0x10000
+#define DEG_TO_TRIGANGLE(angle) (((angle) * TRIG_MAX_ANGLE) / 360)
+#define TRIGANGLE_TO_DEG(trig_angle) (((trig_angle) * 360) / TRIG_MAX_ANGLE)
+int32_t sin_lookup(int32_t angle);
+int32_t cos_lookup(int32_t angle);
+int32_t atan2_lookup(int16_t y, int16_t x);
+
+// ============================================================================
+// FONTS
+// ============================================================================
+
+#define FONT_KEY_GOTHIC_09 "RESOURCE_ID_GOTHIC_09"
+#define FONT_KEY_GOTHIC_14 "RESOURCE_ID_GOTHIC_14"
+#define FONT_KEY_GOTHIC_14_BOLD "RESOURCE_ID_GOTHIC_14_BOLD"
+#define FONT_KEY_GOTHIC_18 "RESOURCE_ID_GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD "RESOURCE_ID_GOTHIC_18_BOLD"
+#define FONT_KEY_GOTHIC_24 "RESOURCE_ID_GOTHIC_24"
+#define FONT_KEY_GOTHIC_24_BOLD "RESOURCE_ID_GOTHIC_24_BOLD"
+#define FONT_KEY_GOTHIC_28 "RESOURCE_ID_GOTHIC_28"
+#define FONT_KEY_GOTHIC_28_BOLD "RESOURCE_ID_GOTHIC_28_BOLD"
+#define FONT_KEY_BITHAM_30_BLACK "RESOURCE_ID_BITHAM_30_BLACK"
+#define FONT_KEY_BITHAM_34_MEDIUM_NUMBERS "RESOURCE_ID_BITHAM_34_MEDIUM_NUMBERS"
+#define FONT_KEY_BITHAM_42_BOLD "RESOURCE_ID_BITHAM_42_BOLD"
+#define FONT_KEY_BITHAM_42_LIGHT "RESOURCE_ID_BITHAM_42_LIGHT"
+#define FONT_KEY_BITHAM_42_MEDIUM_NUMBERS "RESOURCE_ID_BITHAM_42_MEDIUM_NUMBERS"
+#define FONT_KEY_ROBOTO_CONDENSED_21 "RESOURCE_ID_ROBOTO_CONDENSED_21"
+#define FONT_KEY_ROBOTO_BOLD_SUBSET_49 "RESOURCE_ID_ROBOTO_BOLD_SUBSET_49"
+#define FONT_KEY_LECO_20_BOLD_NUMBERS "RESOURCE_ID_LECO_20_BOLD_NUMBERS"
+#define FONT_KEY_LECO_26_BOLD_NUMBERS_AM_PM "RESOURCE_ID_LECO_26_BOLD_NUMBERS_AM_PM"
+#define FONT_KEY_LECO_28_LIGHT_NUMBERS "RESOURCE_ID_LECO_28_LIGHT_NUMBERS"
+#define FONT_KEY_LECO_32_BOLD_NUMBERS "RESOURCE_ID_LECO_32_BOLD_NUMBERS"
+#define FONT_KEY_LECO_36_BOLD_NUMBERS "RESOURCE_ID_LECO_36_BOLD_NUMBERS"
+#define FONT_KEY_LECO_38_BOLD_NUMBERS "RESOURCE_ID_LECO_38_BOLD_NUMBERS"
+#define FONT_KEY_LECO_42_NUMBERS "RESOURCE_ID_LECO_42_NUMBERS"
+
+GFont fonts_get_system_font(const char *font_key);
+
+// ============================================================================
+// LAYERS AND WINDOWS
+// ============================================================================
+
+typedef struct Layer Layer;
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+
+Layer *layer_create(GRect frame);
+Layer *layer_create_with_data(GRect frame, size_t data_size);
+void *layer_get_data(const Layer *layer);
+void layer_destroy(Layer *layer);
+void layer_mark_dirty(Layer *layer);
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void layer_set_frame(Layer *layer, GRect frame);
+GRect layer_get_frame(const Layer *layer);
+void layer_set_bounds(Layer *layer, GRect bounds);
+GRect layer_get_bounds(const Layer *layer);
+GRect layer_get_unobstructed_bounds(const Layer *layer);
+void layer_add_child(Layer *parent, Layer *child);
+void layer_remove_from_parent(Layer *child);
+void layer_remove_child_layers(Layer *parent);
+void layer_set_hidden(Layer *layer, bool hidden);
+bool layer_get_hidden(const Layer *layer);
+void layer_set_clips(Layer *layer, bool clips);
+bool layer_get_clips(const Layer *layer);
+
+typedef struct TextLayer TextLayer;
+TextLayer *text_layer_create(GRect frame);
+void text_layer_destroy(TextLayer *text_layer);
+Layer *text_layer_get_layer(TextLayer *text_layer);
+void text_layer_set_text(TextLayer *text_layer, const char *text);
+const char *text_layer_get_text(TextLayer *text_layer);
+void text_layer_set_background_color(TextLayer *text_layer, GColor color);
+void text_layer_set_text_color(TextLayer *text_layer, GColor color);
+void text_layer_set_font(TextLayer *text_layer, GFont font);
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment text_alignment);
+void text_layer_set_overflow_mode(TextLayer *text_layer, GTextOverflowMode line_mode);
+GSize text_layer_get_content_size(TextLayer *text_layer);
+
+typedef struct Window Window;
+typedef void (*WindowHandler)(Window *window);
+typedef struct {
+    WindowHandler load;
+    WindowHandler appear;
+    WindowHandler disappear;
+    WindowHandler unload;
+} WindowHandlers;
+
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+Layer *window_get_root_layer(const Window *window);
+void window_set_background_color(Window *window, GColor background_color);
+void window_set_user_data(Window *window, void *data);
+void *window_get_user_data(const Window *window);
+void window_stack_push(Window *window, bool animated);
+Window *window_stack_remove(Window *window, bool animated);
+
+typedef void *ClickRecognizerRef;
+typedef void (*ClickHandler)(ClickRecognizerRef recognizer, void *context);
+typedef void (*ClickConfigProvider)(void *context);
+typedef enum { BUTTON_ID_BACK, BUTTON_ID_UP, BUTTON_ID_SELECT, BUTTON_ID_DOWN, NUM_BUTTONS } ButtonId;
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider);
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler);
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+                                 ClickHandler down_handler, ClickHandler up_handler);
+
+// ============================================================================
+// EVENTS AND SERVICES
+// ============================================================================
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms);
+void app_timer_cancel(AppTimer *timer_handle);
+
+void app_event_loop(void);
+
+typedef enum {
+    SECOND_UNIT = 1 << 0,
+    MINUTE_UNIT = 1 << 1,
+    HOUR_UNIT = 1 << 2,
+    DAY_UNIT = 1 << 3,
+    MONTH_UNIT = 1 << 4,
+    YEAR_UNIT = 1 << 5,
+} TimeUnits;
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+bool clock_is_24h_style(void);
+uint16_t time_ms(time_t *t_utc, uint16_t *out_ms);
+
+typedef struct {
+    uint8_t charge_percent;
+    bool is_charging;
+    bool is_plugged;
+} BatteryChargeState;
+typedef void (*BatteryStateHandler)(BatteryChargeState charge);
+void battery_state_service_subscribe(BatteryStateHandler handler);
+void battery_state_service_unsubscribe(void);
+BatteryChargeState battery_state_service_peek(void);
+
+typedef void (*BluetoothConnectionHandler)(bool connected);
+void bluetooth_connection_service_subscribe(BluetoothConnectionHandler handler);
+void bluetooth_connection_service_unsubscribe(void);
+bool bluetooth_connection_service_peek(void);
+
+typedef void (*AppFocusHandler)(bool in_focus);
+void app_focus_service_subscribe(AppFocusHandler handler);
+void app_focus_service_unsubscribe(void);
+
+typedef enum {
+    APP_WORKER_RESULT_SUCCESS = 0,
+    APP_WORKER_RESULT_NO_WORKER = 1,
+    APP_WORKER_RESULT_DIFFERENT_APP = 2,
+    APP_WORKER_RESULT_NOT_RUNNING = 3,
+    APP_WORKER_RESULT_ALREADY_RUNNING = 4,
+    APP_WORKER_RESULT_ASKING_CONFIRMATION = 5,
+} AppWorkerResult;
+typedef struct {
+    uint16_t data0, data1, data2;
+} AppWorkerMessage;
+typedef void (*AppWorkerMessageHandler)(uint16_t type, AppWorkerMessage *data);
+bool app_worker_is_running(void);
+AppWorkerResult app_worker_launch(void);
+AppWorkerResult app_worker_kill(void);
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler);
+bool app_worker_message_unsubscribe(void);
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data);
+
+typedef enum { ACCEL_AXIS_X = 0, ACCEL_AXIS_Y = 1, ACCEL_AXIS_Z = 2 } AccelAxisType;
+typedef struct {
+    int16_t x, y, z;
+    bool did_vibrate;
+    uint64_t timestamp;
+} AccelData;
+typedef enum {
+    ACCEL_SAMPLING_10HZ = 10,
+    ACCEL_SAMPLING_25HZ = 25,
+    ACCEL_SAMPLING_50HZ = 50,
+    ACCEL_SAMPLING_100HZ = 100,
+} AccelSamplingRate;
+typedef void (*AccelDataHandler)(AccelData *data, uint32_t num_samples);
+typedef void (*AccelTapHandler)(AccelAxisType axis, int32_t direction);
+void accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler);
+void accel_data_service_unsubscribe(void);
+int accel_service_set_sampling_rate(AccelSamplingRate rate);
+int accel_service_set_samples_per_update(uint32_t num_samples);
+void accel_tap_service_subscribe(AccelTapHandler handler);
+void accel_tap_service_unsubscribe(void);
+
+typedef int32_t AnimationProgress;
+#define ANIMATION_NORMALIZED_MAX 65535
+typedef void (*UnobstructedAreaWillChangeHandler)(GRect final_unobstructed_screen_area, void *context);
+typedef void (*UnobstructedAreaChangeHandler)(AnimationProgress progress, void *context);
+typedef void (*UnobstructedAreaDidChangeHandler)(void *context);
+typedef struct {
+    UnobstructedAreaWillChangeHandler will_change;
+    UnobstructedAreaChangeHandler change;
+    UnobstructedAreaDidChangeHandler did_change;
+} UnobstructedAreaHandlers;
+void unobstructed_area_service_subscribe(UnobstructedAreaHandlers handlers, void *context);
+void unobstructed_area_service_unsubscribe(void);
+
+// ============================================================================
+// STORAGE, FEEDBACK, LOGGING
+// ============================================================================
+
+typedef int32_t status_t;
+typedef enum { S_SUCCESS = 0, E_ERROR = -1, E_INVALID_ARGUMENT = -2, E_DOES_NOT_EXIST = -10 } StatusCode;
+#define PERSIST_DATA_MAX_LENGTH 256
+
+bool persist_exists(const uint32_t key);
+int persist_get_size(const uint32_t key);
+bool persist_read_bool(const uint32_t key);
+int32_t persist_read_int(const uint32_t key);
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size);
+status_t persist_write_bool(const uint32_t key, const bool value);
+status_t persist_write_int(const uint32_t key, const int32_t value);
+int persist_write_data(const uint32_t key, const void *data, const size_t size);
+status_t persist_delete(const uint32_t key);
+
+void vibes_short_pulse(void);
+void vibes_long_pulse(void);
+void vibes_double_pulse(void);
+void light_enable_interaction(void);
+
+// Allocations go through the host so heap_bytes_used() and the benchmark's
+// heap_peak reflect what the face would use on the watch
+void *host_malloc(size_t size);
+void *host_calloc(size_t count, size_t size);
+void *host_realloc(void *ptr, size_t size);
+void host_free(void *ptr);
+#define malloc(size) host_malloc(size)
+#define calloc(count, size) host_calloc(count, size)
+#define realloc(ptr, size) host_realloc(ptr, size)
+#define free(ptr) host_free(ptr)
+
+size_t heap_bytes_free(void);
+size_t heap_bytes_used(void);
+
+typedef enum {
+    APP_LOG_LEVEL_ERROR = 1,
+    APP_LOG_LEVEL_WARNING = 50,
+    APP_LOG_LEVEL_INFO = 100,
+    APP_LOG_LEVEL_DEBUG = 200,
+    APP_LOG_LEVEL_DEBUG_VERBOSE = 255,
+} AppLogLevel;
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...);
+#define APP_LOG(level, fmt, ...) app_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
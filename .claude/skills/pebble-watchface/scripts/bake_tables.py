@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Pebble Table Baker
+
+Precomputes per-frame tables from a face's own simulation code. Sources
+under src/c/ that mention TABLE_BAKE are compiled for the host with it
+defined and linked with host/host_tables.c, which calls the face's
+table_bake(); whatever that prints becomes src/c/baked_tables.h. The face
+then replaces per-frame interpolation, trig or collision math with a table
+lookup.
+
+The simulation runs once for rectangular screens (basalt) and once for
+round (chalk); if the output differs the header switches on PBL_ROUND.
+
+Usage:
+    python bake_tables.py /path/to/watchface
+    python bake_tables.py /path/to/watchface -o src/c/fight_table.h
+
+Or on every build: BAKE_TABLES=/path/to/bake_tables.py pebble build
+
+Requires a C compiler (cc, or set CC).
+
+Exit codes:
+    0 - Header written
+    1 - No TABLE_BAKE sources, or the build or bake failed
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+from benchmark import Colors, compile_face, project_sources
+
+SHAPES = {'rect': 'basalt', 'round': 'chalk'}
+TABLE_SOURCES = ['host_graphics.c', 'host_runtime.c', 'host_tables.c']
+
+
+def bake_sources(project_path):
+    return [p for p in project_sources(project_path) if 'TABLE_BAKE' in p.read_text(errors='replace')]
+
+
+def bake(project_path, sources, platform, out_dir, cc):
+    """Run table_bake() built for one platform and return what it printed"""
+    flags = ['-DTABLE_BAKE', '-I', str(project_path / 'src' / 'c')]
+    binary = compile_face(project_path, platform, out_dir, cc, TABLE_SOURCES, flags, sources)
+    return subprocess.run([str(binary)], check=True, capture_output=True, text=True, timeout=60).stdout
+
+
+def render(outputs, sources, project_path):
+    names = ', '.join(str(p.relative_to(project_path / 'src' / 'c')) for p in sources)
+    parts = [
+        f"// Generated by bake_tables.py from {names} - do not edit",
+        "#pragma once",
+        "",
+    ]
+    if outputs['rect'] == outputs['round']:
+        parts.append(outputs['rect'].rstrip())
+    else:
+        parts += ["#if defined(PBL_ROUND)", outputs['round'].rstrip(), "#else",
+                  outputs['rect'].rstrip(), "#endif"]
+    return '\n'.join(parts) + '\n'
+
+
+def bake_tables(project_path, output, cc):
+    """Bake and write the header; returns True on success"""
+    sources = bake_sources(project_path)
+    if not sources:
+        print(f"{Colors.RED}✗{Colors.RESET} No sources under src/c/ mention TABLE_BAKE")
+        return False
+
+    outputs = {}
+    with tempfile.TemporaryDirectory(prefix='pebble-tables-') as tmp:
+        for shape, platform in SHAPES.items():
+            out_dir = Path(tmp) / platform
+            out_dir.mkdir()
+            try:
+                outputs[shape] = bake(project_path, sources, platform, out_dir, cc)
+            except subprocess.CalledProcessError as e:
+                print(f"{Colors.RED}✗{Colors.RESET} {platform}: table bake failed")
+                print('\n'.join('    ' + line for line in (e.stderr or '').strip().splitlines()[:20]))
+                return False
+            except subprocess.TimeoutExpired:
+                print(f"{Colors.RED}✗{Colors.RESET} {platform}: table_bake() did not finish")
+                return False
+
+    output.write_text(render(outputs, sources, project_path))
+    shapes = 'one table' if outputs['rect'] == outputs['round'] else 'rect + round tables'
+    print(f"{Colors.GREEN}✓{Colors.RESET} Wrote {output.relative_to(project_path)} ({shapes}, "
+          f"{sum(len(o.splitlines()) for o in outputs.values())} lines)")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bake a face's per-frame tables on the host")
+    parser.add_argument('project', type=Path, help='Project directory')
+    parser.add_argument('-o', '--output', type=Path, help='Header path (default src/c/baked_tables.h)')
+    args = parser.parse_args()
+
+    cc = os.environ.get('CC', 'cc')
+    if not shutil.which(cc):
+        print(f"{Colors.RED}No C compiler found ({cc}); set CC{Colors.RESET}")
+        sys.exit(1)
+
+    project = args.project.resolve()
+    output = (args.output or Path('src/c/baked_tables.h'))
+    output = output if output.is_absolute() else project / output
+    sys.exit(0 if bake_tables(project, output, cc) else 1)
+
+
+if __name__ == '__main__':
+    main()
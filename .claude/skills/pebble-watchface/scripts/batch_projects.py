@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+"""
+Pebble Watchface Batch Runner
+
+Scaffolds, builds, validates and captures many watchfaces from one manifest,
+several projects at a time, and writes a single JSON report.
+
+Each project is hashed (package.json, wscript, src/, worker_src/,
+resources/) together with this skill's scripts, host runtime and templates.
+A project whose hash matches its last successful run is not rerun; its
+previous result goes into the report marked "cached". Editing a template
+or the host renderer therefore reruns the whole catalogue, and editing one
+face reruns only that face.
+
+Manifest (JSON, paths relative to the manifest):
+    {
+      "output": "faces",                       // where new faces are scaffolded
+      "projects": [
+        {"path": "samples/projects/batman-watchface"},
+        {"name": "Sunny Side", "template": "animated", "author": "Me"},
+        {"name": "Plain Hands", "template": "static", "display": "Plain"}
+      ]
+    }
+
+An entry with "name" and no existing directory is created with
+create_project.py (template: animated, static or rockyjs).
+
+Steps, in order, per project:
+    scaffold  - create_project.py for entries that don't exist yet
+    build     - pebble build (skipped when the SDK isn't on PATH)
+    validate  - validate_project.py; after build so the memory check runs
+    capture   - benchmark.py on the host: draw stats and a PPM of the last
+                frame per platform (skipped without a C compiler)
+
+Emulator GIFs stay with create_preview_gif.py, which already captures
+several projects on shared emulators.
+
+Usage:
+    python batch_projects.py catalogue.json
+    python batch_projects.py catalogue.json --jobs 4 --steps validate capture
+    python batch_projects.py catalogue.json --force --report report.json
+
+Exit codes:
+    0 - Every project passed (or was cached from a passing run)
+    1 - A step failed for at least one project
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+SKILL_DIR = SCRIPT_DIR.parent
+STEPS = ['scaffold', 'build', 'validate', 'capture']
+TEMPLATES = ['animated', 'static', 'rockyjs']
+PLATFORMS = ['aplite', 'basalt', 'chalk', 'diorite']
+
+# What a project's result depends on
+PROJECT_INPUTS = ['package.json', 'wscript', 'src', 'worker_src', 'resources']
+TOOL_INPUTS = ['scripts', 'host', 'templates']
+LOG_TAIL = 20                   # Lines of a failed step's output kept in the report
+ANSI_ESCAPE = re.compile(r'\033\[[0-9;]*m')
+
+
+class Colors:
+    """ANSI color codes for terminal output"""
+    RED = '\033[91m'
+    GREEN = '\033[92m'
+    YELLOW = '\033[93m'
+    BLUE = '\033[94m'
+    RESET = '\033[0m'
+    BOLD = '\033[1m'
+
+
+def slugify(name):
+    """Same directory name create_project.py uses"""
+    return name.lower().replace(' ', '-').replace('_', '-')
+
+
+def hash_tree(root, entries, digest):
+    """Feed every file under root/entries (sorted, build/ excluded) into digest"""
+    for entry in entries:
+        path = root / entry
+        if path.is_file():
+            files = [path]
+        elif path.is_dir():
+            files = sorted(p for p in path.rglob('*') if p.is_file() and '__pycache__' not in p.parts)
+        else:
+            continue
+        for f in files:
+            digest.update(str(f.relative_to(root)).encode())
+            digest.update(b'\0')
+            digest.update(f.read_bytes())
+            digest.update(b'\0')
+
+
+def tools_hash():
+    digest = hashlib.sha256()
+    hash_tree(SKILL_DIR, TOOL_INPUTS, digest)
+    return digest.hexdigest()
+
+
+def project_hash(project_path, tools):
+    digest = hashlib.sha256(tools.encode())
+    hash_tree(project_path, PROJECT_INPUTS, digest)
+    return digest.hexdigest()
+
+
+def load_manifest(manifest_path):
+    """Resolve manifest entries to (name, project_path, entry) tuples"""
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+    base = manifest_path.parent
+    output = (base / manifest.get('output', '.')).resolve()
+
+    projects = []
+    for entry in manifest.get('projects', []):
+        if 'path' in entry:
+            project_path = (base / entry['path']).resolve()
+        elif 'name' in entry:
+            project_path = output / slugify(entry['name'])
+        else:
+            raise ValueError(f'manifest entry needs "path" or "name": {entry}')
+        if entry.get('template', 'animated') not in TEMPLATES:
+            raise ValueError(f'unknown template in {entry}')
+        projects.append((project_path.name, project_path, entry))
+    return projects
+
+
+def run_step(cmd, cwd=None, env=None, timeout=None):
+    """Run one step; returns (ok, seconds, tail of output)"""
+    start = time.monotonic()
+    try:
+        result = subprocess.run(cmd, cwd=cwd, env=env, capture_output=True, text=True, timeout=timeout)
+        ok = result.returncode == 0
+        output = result.stdout + result.stderr
+    except subprocess.TimeoutExpired:
+        ok, output = False, f'timed out after {timeout}s'
+    lines = ANSI_ESCAPE.sub('', output).strip().splitlines()
+    return ok, round(time.monotonic() - start, 2), lines[-LOG_TAIL:]
+
+
+def step_result(status, seconds=0, log=None, **extra):
+    result = {'status': status, 'seconds': seconds, **extra}
+    if log and status == 'failed':
+        result['log'] = log
+    return result
+
+
+def scaffold(project_path, entry):
+    if project_path.exists():
+        return step_result('skipped', reason='exists')
+    if 'name' not in entry:
+        return step_result('failed', log=[f'{project_path} does not exist'])
+    cmd = [sys.executable, str(SCRIPT_DIR / 'create_project.py'), entry['name'],
+           f"--{entry.get('template', 'animated')}", '--output', str(project_path.parent)]
+    if 'author' in entry:
+        cmd += ['--author', entry['author']]
+    if 'display' in entry:
+        cmd += ['--display', entry['display']]
+    ok, seconds, log = run_step(cmd)
+    return step_result('ok' if ok else 'failed', seconds, log)
+
+
+def build(project_path, args):
+    if not shutil.which('pebble'):
+        return step_result('skipped', reason='pebble SDK not on PATH')
+    ok, seconds, log = run_step(['pebble', 'build'], cwd=project_path, timeout=args.timeout)
+    return step_result('ok' if ok else 'failed', seconds, log)
+
+
+def validate(project_path, args):
+    cmd = [sys.executable, str(SCRIPT_DIR / 'validate_project.py'), str(project_path),
+           '--min-headroom', str(args.min_headroom)]
+    ok, seconds, log = run_step(cmd, timeout=args.timeout)
+    return step_result('ok' if ok else 'failed', seconds, log)
+
+
+def capture(project_path, args):
+    if not shutil.which(os.environ.get('CC', 'cc')):
+        return step_result('skipped', reason='no C compiler; set CC')
+    if not (project_path / 'src' / 'c').is_dir():
+        return step_result('skipped', reason='no C sources')
+
+    dump_dir = args.capture_dir / project_path.name
+    with tempfile.TemporaryDirectory(prefix='pebble-batch-') as tmp:
+        stats_path = Path(tmp) / 'stats.json'
+        cmd = [sys.executable, str(SCRIPT_DIR / 'benchmark.py'), str(project_path),
+               '--frames', str(args.frames), '--platforms', *args.platforms,
+               '--dump', str(dump_dir), '--json', str(stats_path)]
+        ok, seconds, log = run_step(cmd, timeout=args.timeout)
+        stats = json.loads(stats_path.read_text()).get(project_path.name, {}) if stats_path.exists() else {}
+
+    frames = {p: str(dump_dir / f'{project_path.name}_{p}.ppm') for p in stats}
+    return step_result('ok' if ok else 'failed', seconds, log, frames=frames, stats=stats)
+
+
+def run_project(name, project_path, entry, args, tools, cache):
+    """Every requested step for one project, or its cached result"""
+    steps = {}
+    if 'scaffold' in args.steps:
+        steps['scaffold'] = scaffold(project_path, entry)
+        if steps['scaffold']['status'] == 'failed':
+            return {'path': str(project_path), 'ok': False, 'cached': False, 'steps': steps}
+
+    digest = project_hash(project_path, tools)
+    previous = cache.get(str(project_path))
+    if (not args.force and previous and previous['hash'] == digest and previous['ok']
+            and set(args.steps) <= set(previous['steps'])):
+        return {**previous, 'cached': True}
+
+    for step in args.steps:
+        if step == 'build':
+            steps['build'] = build(project_path, args)
+        elif step == 'validate':
+            steps['validate'] = validate(project_path, args)
+        elif step == 'capture':
+            steps['capture'] = capture(project_path, args)
+
+    ok = all(s['status'] != 'failed' for s in steps.values())
+    return {'path': str(project_path), 'hash': digest, 'ok': ok, 'cached': False, 'steps': steps}
+
+
+def print_row(name, result):
+    if result['cached']:
+        mark, detail = f"{Colors.BLUE}={Colors.RESET}", 'unchanged (cached)'
+    elif result['ok']:
+        mark = f"{Colors.GREEN}✓{Colors.RESET}"
+        detail = ' '.join(f"{k}:{v['status']}" for k, v in result['steps'].items())
+    else:
+        mark = f"{Colors.RED}✗{Colors.RESET}"
+        detail = ' '.join(f"{k}:{v['status']}" for k, v in result['steps'].items())
+    print(f"  {mark} {name:<24} {detail}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Scaffold, build, validate and capture many watchfaces')
+    parser.add_argument('manifest', type=Path, help='JSON manifest of projects')
+    parser.add_argument('--steps', nargs='+', choices=STEPS, default=STEPS)
+    parser.add_argument('--jobs', '-j', type=int, default=os.cpu_count() or 2,
+                        help='Projects processed at once (default: CPU count)')
+    parser.add_argument('--force', action='store_true', help='Rerun projects whose hash is unchanged')
+    parser.add_argument('--report', type=Path, help='JSON report (default: batch-report.json by the manifest)')
+    parser.add_argument('--cache', type=Path, help='Hash cache (default: .batch-cache.json by the manifest)')
+    parser.add_argument('--capture-dir', type=Path, help='PPM captures (default: batch-captures/ by the manifest)')
+    parser.add_argument('--platforms', nargs='+', choices=PLATFORMS, default=PLATFORMS)
+    parser.add_argument('--frames', type=int, default=300, help='Host frames per capture (default 300)')
+    parser.add_argument('--min-headroom', type=int, default=2048, help='Passed to validate_project.py')
+    parser.add_argument('--timeout', type=float, default=600, help='Seconds per step before giving up')
+    args = parser.parse_args()
+
+    manifest_path = args.manifest.resolve()
+    base = manifest_path.parent
+    args.report = (args.report or base / 'batch-report.json').resolve()
+    args.cache = (args.cache or base / '.batch-cache.json').resolve()
+    args.capture_dir = (args.capture_dir or base / 'batch-captures').resolve()
+
+    try:
+        projects = load_manifest(manifest_path)
+    except (OSError, ValueError) as e:
+        print(f"{Colors.RED}Bad manifest: {e}{Colors.RESET}")
+        sys.exit(1)
+
+    cache = json.loads(args.cache.read_text()) if args.cache.exists() else {}
+    tools = tools_hash()
+
+    print(f"{Colors.BOLD}Batch{Colors.RESET} - {len(projects)} project(s), {args.jobs} at a time, "
+          f"steps: {' '.join(args.steps)}")
+    start = time.monotonic()
+    with ThreadPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+        futures = [(name, pool.submit(run_project, name, path, entry, args, tools, cache))
+                   for name, path, entry in projects]
+        results = {}
+        for name, future in futures:
+            results[name] = future.result()
+            print_row(name, results[name])
+
+    for result in results.values():
+        if not result['cached'] and 'hash' in result:
+            cache[result['path']] = {k: v for k, v in result.items() if k != 'cached'}
+    args.cache.write_text(json.dumps(cache, indent=2))
+
+    failed = [name for name, r in results.items() if not r['ok']]
+    report = {
+        'manifest': str(manifest_path),
+        'steps': args.steps,
+        'seconds': round(time.monotonic() - start, 2),
+        'counts': {
+            'total': len(results),
+            'ran': sum(1 for r in results.values() if not r['cached']),
+            'cached': sum(1 for r in results.values() if r['cached']),
+            'failed': len(failed),
+        },
+        'projects': results,
+    }
+    args.report.write_text(json.dumps(report, indent=2))
+    print(f"\nWrote {args.report}")
+
+    if failed:
+        print(f"{Colors.RED}{len(failed)} project(s) failed: {', '.join(failed)}{Colors.RESET}")
+        sys.exit(1)
+    print(f"{Colors.GREEN}All projects passed{Colors.RESET}")
+    sys.exit(0)
+
+
+if __name__ == '__main__':
+    main()
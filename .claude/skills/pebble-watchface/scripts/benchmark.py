@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+"""
+Pebble Watchface Host Benchmark
+
+Compiles a project's C sources natively against host/pebble.h, runs them
+headless on a virtual clock and reports draw cost per platform: host fps,
+microseconds per frame, pixels written per frame and draw calls per frame.
+
+Host fps is not watch fps - use it to compare two versions of the same
+face, or one face across platforms. Pixels and calls per frame transfer
+directly: they are what the watch's CPU has to do.
+
+Usage:
+    python benchmark.py /path/to/watchface
+    python benchmark.py samples/projects/* --platforms basalt chalk
+    python benchmark.py /path/to/watchface --frames 5000 --json results.json
+    python benchmark.py /path/to/watchface --dump frames/   # PPM of last frame
+
+Bitmap resources listed in package.json are decoded for the host (8-bit
+non-interlaced PNGs, as create_sprite_atlas.py writes) so sprite-atlas draws
+are measured; others load as NULL and the face's fallback path runs.
+
+Requires a C compiler (cc, or set CC).
+
+Exit codes:
+    0 - All builds and runs succeeded
+    1 - A build or run failed
+"""
+
+import argparse
+import json
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+from pathlib import Path
+
+SKILL_DIR = Path(__file__).resolve().parent.parent
+HOST_DIR = SKILL_DIR / 'host'
+HOST_SOURCES = ['host_graphics.c', 'host_runtime.c', 'host_main.c']
+PLATFORMS = ['aplite', 'basalt', 'chalk', 'diorite']
+CFLAGS = ['-O2', '-std=gnu11', '-w']
+
+# Resource file tags the SDK tries for each platform, most specific first
+PLATFORM_TAGS = {
+    'aplite': ['~aplite', '~bw', '~rect'],
+    'basalt': ['~basalt', '~color', '~rect'],
+    'chalk': ['~chalk', '~color', '~round'],
+    'diorite': ['~diorite', '~bw', '~rect'],
+}
+
+
+class Colors:
+    """ANSI color codes for terminal output"""
+    RED = '\033[91m'
+    GREEN = '\033[92m'
+    YELLOW = '\033[93m'
+    BLUE = '\033[94m'
+    RESET = '\033[0m'
+    BOLD = '\033[1m'
+
+
+def project_sources(project_path):
+    """App C sources; worker_src runs in its own process and is skipped"""
+    src = project_path / 'src' / 'c'
+    return sorted(p for p in src.rglob('*.c'))
+
+
+def media_entries(project_path):
+    """package.json resources.media, in resource ID order"""
+    try:
+        pkg = json.loads((project_path / 'package.json').read_text())
+    except (OSError, json.JSONDecodeError):
+        return []
+    return pkg.get('pebble', {}).get('resources', {}).get('media', [])
+
+
+def write_resource_ids(project_path, out_dir):
+    """RESOURCE_ID_* defines like the SDK's generated header, numbered from 1"""
+    header = out_dir / 'resource_ids.auto.h'
+    lines = [f"#define RESOURCE_ID_{entry['name']} {i}"
+             for i, entry in enumerate(media_entries(project_path), 1) if 'name' in entry]
+    header.write_text('\n'.join(lines) + '\n')
+    return header
+
+
+def read_png(path):
+    """Decode an 8-bit non-interlaced PNG to (width, height, [(r, g, b, a)]).
+
+    Covers gray, RGB, palette and alpha variants; returns None for anything
+    else (16-bit, low bit depths, interlaced).
+    """
+    data = path.read_bytes()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        return None
+    pos, idat, palette, alpha = 8, b'', [], b''
+    while pos < len(data):
+        length, kind = struct.unpack_from('>I4s', data, pos)
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            alpha = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if depth != 8 or interlace or not channels:
+        return None
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up, up_left = prev[i], prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                row[i] = (row[i] + (left if pa <= pb and pa <= pc else up if pb <= pc else up_left)) & 0xFF
+        rows.append(row)
+        prev = row
+
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            px = row[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif color_type == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            elif color_type == 3:
+                r, g, b = palette[px[0]]
+                pixels.append((r, g, b, alpha[px[0]] if px[0] < len(alpha) else 255))
+            elif color_type == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            else:
+                pixels.append(tuple(px))
+    return width, height, pixels
+
+
+def write_png(path, width, height, pixels):
+    """8-bit RGBA PNG, pixels is rows of RGBA tuples"""
+    raw = b''.join(b'\x00' + bytes(c for px in row for c in px) for row in pixels)
+
+    def chunk(kind, data):
+        return struct.pack('>I', len(data)) + kind + data + struct.pack('>I', zlib.crc32(kind + data))
+
+    png = (b'\x89PNG\r\n\x1a\n' + chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 6, 0, 0, 0)) +
+           chunk(b'IDAT', zlib.compress(raw, 9)) + chunk(b'IEND', b''))
+    path.write_bytes(png)
+
+
+def export_bitmaps(project_path, platform, out_dir):
+    """Decode the platform's bitmap resources into host_graphics.c's format"""
+    resources = project_path / 'resources'
+    for i, entry in enumerate(media_entries(project_path), 1):
+        if entry.get('type') not in ('bitmap', 'png') or 'file' not in entry:
+            continue
+        if platform not in entry.get('targetPlatforms', [platform]):
+            continue
+        base = resources / entry['file']
+        candidates = [base.with_name(base.stem + tag + base.suffix) for tag in PLATFORM_TAGS[platform]]
+        source = next((c for c in candidates + [base] if c.exists()), None)
+        decoded = read_png(source) if source else None
+        if not decoded:
+            continue
+        width, height, pixels = decoded
+        argb = bytes(0 if a < 128 else 0xC0 | (r >> 6) << 4 | (g >> 6) << 2 | b >> 6
+                     for r, g, b, a in pixels)
+        (out_dir / f"resource_{i}.bin").write_bytes(struct.pack('<HH', width, height) + argb)
+
+
+def compile_face(project_path, platform, out_dir, cc, host_sources=HOST_SOURCES, flags=(), sources=None):
+    """Build the host binary for one platform (all app sources by default), returning its path or raising"""
+    define = f"-DPBL_PLATFORM_{platform.upper()}"
+    include = ['-I', str(HOST_DIR), '-include', str(write_resource_ids(project_path, out_dir))]
+    objects = []
+
+    for i, source in enumerate(sources or project_sources(project_path)):
+        obj = out_dir / f"face_{i}_{source.stem}.o"
+        cmd = [cc, *CFLAGS, define, *include, *flags, '-Dmain=pebble_app_main', '-c', str(source), '-o', str(obj)]
+        subprocess.run(cmd, check=True, capture_output=True, text=True)
+        objects.append(obj)
+
+    for name in host_sources:
+        obj = out_dir / f"host_{Path(name).stem}.o"
+        cmd = [cc, *CFLAGS, define, *include, *flags, '-c', str(HOST_DIR / name), '-o', str(obj)]
+        subprocess.run(cmd, check=True, capture_output=True, text=True)
+        objects.append(obj)
+
+    binary = out_dir / f"face_{platform}"
+    subprocess.run([cc, *map(str, objects), '-lm', '-o', str(binary)], check=True, capture_output=True, text=True)
+    return binary
+
+
+def run_face(binary, args, dump_path=None):
+    """Run a host binary and parse its JSON report"""
+    cmd = [str(binary), '--frames', str(args.frames), '--max-virtual-s', str(args.max_virtual_s),
+           '--tap-ms', str(args.tap_ms), '--quick-view', str(args.quick_view),
+           '--resources', str(binary.parent)]
+    if dump_path:
+        cmd += ['--dump', str(dump_path)]
+    result = subprocess.run(cmd, check=True, capture_output=True, text=True, timeout=args.timeout)
+    return json.loads(result.stdout)
+
+
+def format_row(name, stats):
+    calls = stats['calls_per_frame']
+    draw_calls = sum(v for k, v in calls.items() if k not in ('update_proc', 'capture', 'state'))
+    return (f"  {name:<10} {stats['frames']:>6} {stats['fps']:>9.0f} "
+            f"{stats['update_us'] + stats['render_us']:>9.1f} {stats['pixels_per_frame']:>8.0f} "
+            f"{draw_calls:>7.1f} {calls['state']:>6.1f} {calls['update_proc']:>6.1f} {stats['heap_peak']:>7}")
+
+
+def print_header():
+    print(f"  {'platform':<10} {'frames':>6} {'host fps':>9} {'us/frame':>9} {'px/frame':>8} "
+          f"{'calls':>7} {'state':>6} {'procs':>6} {'heap':>7}")
+
+
+def benchmark_project(project_path, args, cc):
+    """Benchmark one project on every requested platform"""
+    print(f"\n{Colors.BOLD}{project_path.name}{Colors.RESET}")
+    if not project_sources(project_path):
+        print(f"  {Colors.RED}✗{Colors.RESET} No C sources under src/c/")
+        return None, False
+
+    results = {}
+    ok = True
+    print_header()
+    with tempfile.TemporaryDirectory(prefix='pebble-bench-') as tmp:
+        for platform in args.platforms:
+            out_dir = Path(tmp) / platform
+            out_dir.mkdir()
+            try:
+                binary = compile_face(project_path, platform, out_dir, cc)
+                export_bitmaps(project_path, platform, out_dir)
+            except subprocess.CalledProcessError as e:
+                print(f"  {Colors.RED}✗{Colors.RESET} {platform}: build failed")
+                print('\n'.join('      ' + line for line in (e.stderr or '').strip().splitlines()[:20]))
+                ok = False
+                continue
+
+            dump_path = None
+            if args.dump:
+                args.dump.mkdir(parents=True, exist_ok=True)
+                dump_path = args.dump / f"{project_path.name}_{platform}.ppm"
+            try:
+                stats = run_face(binary, args, dump_path)
+            except (subprocess.CalledProcessError, subprocess.TimeoutExpired, json.JSONDecodeError) as e:
+                print(f"  {Colors.RED}✗{Colors.RESET} {platform}: run failed ({e.__class__.__name__})")
+                ok = False
+                continue
+
+            results[platform] = stats
+            print(format_row(platform, stats))
+    return results, ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark watchface draw code on the host')
+    parser.add_argument('projects', nargs='+', type=Path, help='Project directories')
+    parser.add_argument('--platforms', nargs='+', choices=PLATFORMS, default=PLATFORMS)
+    parser.add_argument('--frames', type=int, default=2000, help='Render passes per run (default 2000)')
+    parser.add_argument('--max-virtual-s', type=float, default=48 * 3600,
+                        help='Stop after this much watch time (default 48h)')
+    parser.add_argument('--tap-ms', type=int, default=8000,
+                        help='Synthetic wrist flick interval, keeps burst animations awake (0 = none)')
+    parser.add_argument('--quick-view', type=int, default=0, metavar='H',
+                        help='Timeline Quick View covers the bottom H rows from launch (51 on the watch)')
+    parser.add_argument('--timeout', type=float, default=120, help='Seconds per run before giving up')
+    parser.add_argument('--json', type=Path, help='Write all results to this file')
+    parser.add_argument('--dump', type=Path, help='Directory for PPM screenshots of the last frame')
+    args = parser.parse_args()
+
+    cc = os.environ.get('CC', 'cc')
+    if not shutil.which(cc):
+        print(f"{Colors.RED}No C compiler found ({cc}); set CC{Colors.RESET}")
+        sys.exit(1)
+
+    print(f"{Colors.BOLD}Host benchmark{Colors.RESET} - {args.frames} frames, taps every {args.tap_ms} ms")
+    all_results = {}
+    all_ok = True
+    for project in args.projects:
+        results, ok = benchmark_project(project.resolve(), args, cc)
+        all_ok &= ok
+        if results:
+            all_results[project.name] = results
+
+    if args.json:
+        args.json.write_text(json.dumps(all_results, indent=2))
+        print(f"\nWrote {args.json}")
+
+    print(f"\n{Colors.BLUE}ℹ{Colors.RESET} calls = draw calls per frame, state = context state changes, "
+          "procs = update procs run per frame")
+    sys.exit(0 if all_ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+"""
+Pebble Watchface Regression Check
+
+Renders a face on the host and compares the picture and its draw cost
+against a reference: a different frame, or a draw path that got noticeably
+more expensive, fails the check.
+
+The reference is either the baselines stored in the project, or another
+git revision built side by side:
+
+    stored  (default)  regression/host_<platform>.png and regression/perf.json,
+                       written by --update
+    --against REV      the same project at REV (e.g. main), checked out in a
+                       temporary git worktree and run interleaved with the
+                       working tree, so machine noise hits both alike
+
+Per platform it compares:
+    host frame  - the last frame of a fixed benchmark.py run; the host clock
+                  starts at the same instant every run, so this is exact
+    draw cost   - draw calls, state changes and pixels per frame, and the
+                  heap peak; deterministic
+    frame time  - host us/frame, best of --repeat runs; only with --against.
+                  Host timing moves too much between runs and machines to
+                  store, so it is only gated against a build measured in
+                  the same run
+    emulator    - with --emulator, a `pebble screenshot` of each running
+                  emulator against the checked-in screenshot_<platform>.png,
+                  within a tolerance (the clock on screen differs)
+
+Usage:
+    python check_regressions.py samples/projects/*                # Stored baselines
+    python check_regressions.py samples/projects/* --against main
+    python check_regressions.py samples/projects/tumbling-monkeys --update
+    python check_regressions.py . --emulator --platforms basalt chalk
+
+Commit updated baselines (--update) only when the change in output is
+intended.
+
+Requires a C compiler (cc, or set CC); --against needs git.
+
+Exit codes:
+    0 - No regressions
+    1 - A regression, a missing baseline or a failed build
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+from benchmark import (Colors, PLATFORMS, compile_face, export_bitmaps, project_sources,
+                       read_png, run_face, write_png)
+
+BASELINE_DIR = 'regression'
+DEFAULT_FRAMES = 2000
+
+# Draw cost figures compared; calls not counted as drawing
+COST_KEYS = ['draw_calls', 'state', 'pixels_per_frame', 'heap_peak']
+NON_DRAW_CALLS = ('update_proc', 'capture', 'state')
+
+
+def read_ppm(path):
+    """Binary PPM from host_main.c's --dump to (width, height, [(r, g, b)])"""
+    _, size, _, pixels = path.read_bytes().split(b'\n', 3)
+    width, height = map(int, size.split())
+    return width, height, [tuple(pixels[i:i + 3]) for i in range(0, width * height * 3, 3)]
+
+
+def read_rgb_png(path):
+    decoded = read_png(path) if path.exists() else None
+    if not decoded:
+        return None
+    width, height, pixels = decoded
+    return width, height, [px[:3] for px in pixels]
+
+
+def compare_images(actual, expected, channel_tolerance=0):
+    """Fraction of pixels whose channels differ by more than channel_tolerance"""
+    (aw, ah, apx), (ew, eh, epx) = actual, expected
+    if (aw, ah) != (ew, eh):
+        return 1.0
+    differ = sum(1 for a, e in zip(apx, epx)
+                 if max(abs(a[0] - e[0]), abs(a[1] - e[1]), abs(a[2] - e[2])) > channel_tolerance)
+    return differ / (aw * ah)
+
+
+def cost_figures(stats):
+    calls = stats['calls_per_frame']
+    return {
+        'draw_calls': round(sum(v for k, v in calls.items() if k not in NON_DRAW_CALLS), 2),
+        'state': calls['state'],
+        'pixels_per_frame': stats['pixels_per_frame'],
+        'heap_peak': stats['heap_peak'],
+    }
+
+
+# ============================================================================
+# HOST RUNS
+# ============================================================================
+
+def build_host(project_path, platform, cc, out_dir):
+    out_dir.mkdir(parents=True)
+    binary = compile_face(project_path, platform, out_dir, cc)
+    export_bitmaps(project_path, platform, out_dir)
+    return binary
+
+
+def measure(binaries, args, repeat):
+    """Run each binary `repeat` times, taking turns so that a noisy moment on
+    the machine lands on all of them. Returns (frame, cost, best us/frame)
+    per binary."""
+    frames, costs, best_us = [], [], [None] * len(binaries)
+    for i in range(max(1, repeat)):
+        for j, binary in enumerate(binaries):
+            dump_path = binary.parent / 'frame.ppm' if i == 0 else None
+            stats = run_face(binary, args, dump_path)
+            if i == 0:
+                frames.append(read_ppm(dump_path))
+                costs.append(cost_figures(stats))
+            us = stats['update_us'] + stats['render_us']
+            best_us[j] = us if best_us[j] is None else min(best_us[j], us)
+    return [(frame, cost, round(us, 2)) for frame, cost, us in zip(frames, costs, best_us)]
+
+
+def compare_run(result, run, reference, args):
+    """Flag what got different or more expensive than reference"""
+    frame, cost, us = run
+    ref_frame, ref_cost, ref_us = reference
+    result['host_diff'] = round(compare_images(frame, ref_frame), 5) if ref_frame else 1.0
+    if result['host_diff'] > args.pixel_tolerance:
+        result['problems'].append(f"host frame differs ({result['host_diff']:.2%} of pixels)")
+
+    for key in COST_KEYS:
+        before, after = ref_cost.get(key, 0), cost[key]
+        if after > before * (1 + args.cost_tolerance) and after - before > 0.5:
+            result['problems'].append(f"{key} {before} -> {after}")
+
+    result['us_change'] = None
+    if ref_us:
+        result['us_change'] = round(us / ref_us - 1, 3)
+        if us > ref_us * (1 + args.time_tolerance):
+            result['problems'].append(f"frame time {ref_us} -> {us} us (+{us / ref_us - 1:.0%})")
+
+
+# ============================================================================
+# REFERENCES
+# ============================================================================
+
+def checkout_revision(project_path, rev, tmp):
+    """The project as of rev, in a temporary worktree. Returns (repo, worktree, project)."""
+    repo = Path(subprocess.run(['git', 'rev-parse', '--show-toplevel'], cwd=project_path,
+                               capture_output=True, text=True, check=True).stdout.strip())
+    worktree = Path(tmp) / 'against'
+    subprocess.run(['git', 'worktree', 'add', '--detach', '-q', str(worktree), rev],
+                   cwd=repo, capture_output=True, text=True, check=True)
+    return repo, worktree, worktree / project_path.relative_to(repo)
+
+
+def remove_worktree(repo, worktree):
+    subprocess.run(['git', 'worktree', 'remove', '--force', str(worktree)],
+                   cwd=repo, capture_output=True, text=True)
+
+
+def check_emulator(result, project_path, platform, args, tmp):
+    """Compare a live emulator screenshot with the checked-in one"""
+    stored_path = project_path / f'screenshot_{platform}.png'
+    capture_path = Path(tmp) / f'emulator_{platform}.png'
+    captured = subprocess.run(['pebble', 'screenshot', '--emulator', platform, str(capture_path)],
+                              capture_output=True, text=True)
+    if captured.returncode != 0 or not capture_path.exists():
+        result['emulator'] = 'not running'
+        return
+    if args.update:
+        shutil.copy(capture_path, stored_path)
+        result['emulator'] = 'recorded'
+        return
+
+    actual, expected = read_rgb_png(capture_path), read_rgb_png(stored_path)
+    if not expected:
+        result['problems'].append(f'no readable {stored_path.name} (run with --update)')
+        return
+    if not actual:
+        result['problems'].append('unreadable emulator screenshot')
+        return
+    result['emulator_diff'] = round(compare_images(actual, expected, args.channel_tolerance), 5)
+    if result['emulator_diff'] > args.emulator_tolerance:
+        result['problems'].append(f"emulator screenshot differs ({result['emulator_diff']:.2%} of pixels)")
+
+
+# ============================================================================
+# PROJECTS
+# ============================================================================
+
+def check_platform(project_path, platform, against_path, baseline, args, cc, tmp):
+    """One platform's result dict; records baselines with --update"""
+    result = {'problems': []}
+    out_dir = Path(tmp) / platform
+    try:
+        binaries = [build_host(project_path, platform, cc, out_dir / 'current')]
+        if against_path:
+            binaries.append(build_host(against_path, platform, cc, out_dir / 'against'))
+        runs = measure(binaries, args, args.repeat if against_path else 1)
+    except (subprocess.CalledProcessError, subprocess.TimeoutExpired, json.JSONDecodeError) as e:
+        result['problems'].append(f"host build or run failed ({e.__class__.__name__})")
+        return result
+
+    frame, cost, us = runs[0]
+    result.update(cost=cost, us_per_frame=us)
+    baseline_dir = project_path / BASELINE_DIR
+    host_png = baseline_dir / f'host_{platform}.png'
+
+    if args.update:
+        baseline_dir.mkdir(exist_ok=True)
+        width, height, pixels = frame
+        write_png(host_png, width, height,
+                  [[(*px, 255) for px in pixels[y * width:(y + 1) * width]] for y in range(height)])
+    elif against_path:
+        compare_run(result, runs[0], runs[1], args)
+    else:
+        stored = baseline.get('platforms', {}).get(platform)
+        if stored is None or not host_png.exists():
+            result['problems'].append('no baseline (run with --update)')
+        else:
+            compare_run(result, runs[0], (read_rgb_png(host_png), stored, None), args)
+
+    if args.emulator:
+        check_emulator(result, project_path, platform, args, tmp)
+    return result
+
+
+def check_project(project_path, args, cc):
+    """Returns (report, ok) for one project"""
+    print(f"\n{Colors.BOLD}{project_path.name}{Colors.RESET}")
+    if not project_sources(project_path):
+        print(f"  {Colors.YELLOW}!{Colors.RESET} No C sources under src/c/, skipped")
+        return {}, True
+
+    perf_path = project_path / BASELINE_DIR / 'perf.json'
+    baseline = json.loads(perf_path.read_text()) if perf_path.exists() else {}
+    frames = args.frames
+    if not args.update and not args.against and baseline.get('frames'):
+        args.frames = baseline['frames']    # Stored costs are per-frame averages over this run
+
+    report = {}
+    with tempfile.TemporaryDirectory(prefix='pebble-regress-') as tmp:
+        repo = worktree = against_path = None
+        if args.against:
+            try:
+                repo, worktree, against_path = checkout_revision(project_path, args.against, tmp)
+            except (subprocess.CalledProcessError, ValueError) as e:
+                print(f"  {Colors.RED}✗{Colors.RESET} Cannot check out {args.against}: "
+                      f"{(getattr(e, 'stderr', '') or str(e)).strip()}")
+                args.frames = frames
+                return {}, False
+            if not project_sources(against_path):
+                print(f"  {Colors.YELLOW}!{Colors.RESET} Not in {args.against}, skipped")
+                remove_worktree(repo, worktree)
+                args.frames = frames
+                return {}, True
+        try:
+            for platform in args.platforms:
+                report[platform] = check_platform(project_path, platform, against_path, baseline,
+                                                  args, cc, tmp)
+                print_row(platform, report[platform])
+        finally:
+            if worktree:
+                remove_worktree(repo, worktree)
+
+    ok = all(not r['problems'] for r in report.values())
+    if args.update and ok:
+        recorded = {'frames': args.frames, 'platforms': {p: r['cost'] for p, r in report.items()}}
+        perf_path.write_text(json.dumps(recorded, indent=2) + '\n')
+        print(f"  Recorded baselines in {perf_path.parent}")
+    args.frames = frames
+    return report, ok
+
+
+def print_row(platform, result):
+    cost = result.get('cost')
+    figures = ''
+    if cost:
+        change = result.get('us_change')
+        figures = (f"{cost['draw_calls']:>7.1f} calls {cost['pixels_per_frame']:>7.0f} px "
+                   f"{result['us_per_frame']:>8.1f} us" + (f" ({change:+.0%})" if change is not None else ''))
+    if result['problems']:
+        print(f"  {Colors.RED}✗{Colors.RESET} {platform:<8} {figures}")
+        for problem in result['problems']:
+            print(f"      {problem}")
+    else:
+        print(f"  {Colors.GREEN}✓{Colors.RESET} {platform:<8} {figures}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Check watchface output and draw cost for regressions')
+    parser.add_argument('projects', nargs='+', type=Path, help='Project directories')
+    parser.add_argument('--platforms', nargs='+', choices=PLATFORMS, default=PLATFORMS)
+    parser.add_argument('--against', metavar='REV', help='Compare with this git revision instead of baselines')
+    parser.add_argument('--update', action='store_true', help='Record new baselines instead of checking')
+    parser.add_argument('--emulator', action='store_true',
+                        help='Also compare running emulators against screenshot_<platform>.png')
+    parser.add_argument('--frames', type=int, default=DEFAULT_FRAMES,
+                        help=f'Host frames per run (default {DEFAULT_FRAMES}; stored baselines use their own)')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='With --against, host runs per build, best time kept (default 5)')
+    parser.add_argument('--pixel-tolerance', type=float, default=0.0,
+                        help='Fraction of host pixels allowed to differ (default 0)')
+    parser.add_argument('--emulator-tolerance', type=float, default=0.05,
+                        help='Fraction of emulator pixels allowed to differ (default 0.05)')
+    parser.add_argument('--channel-tolerance', type=int, default=8,
+                        help='Emulator channel difference still counted as equal (default 8)')
+    parser.add_argument('--cost-tolerance', type=float, default=0.05,
+                        help='Allowed growth in calls, state changes, pixels and heap (default 0.05)')
+    parser.add_argument('--time-tolerance', type=float, default=0.2,
+                        help='Allowed growth in host frame time (default 0.2)')
+    parser.add_argument('--json', type=Path, help='Write all results to this file')
+    args = parser.parse_args()
+
+    if args.update and args.against:
+        parser.error('--update records the working tree; drop --against')
+
+    # run_face() settings, fixed so runs are comparable
+    args.max_virtual_s = 48 * 3600
+    args.tap_ms = 8000
+    args.quick_view = 0
+    args.timeout = 120
+
+    cc = os.environ.get('CC', 'cc')
+    if not shutil.which(cc):
+        print(f"{Colors.RED}No C compiler found ({cc}); set CC{Colors.RESET}")
+        sys.exit(1)
+    if args.emulator and not shutil.which('pebble'):
+        print(f"{Colors.RED}--emulator needs the pebble SDK on PATH{Colors.RESET}")
+        sys.exit(1)
+
+    all_results = {}
+    all_ok = True
+    for project in args.projects:
+        results, ok = check_project(project.resolve(), args, cc)
+        all_ok &= ok
+        all_results[project.resolve().name] = results
+
+    if args.json:
+        args.json.write_text(json.dumps(all_results, indent=2))
+        print(f"\nWrote {args.json}")
+
+    if not args.update:
+        print(f"\n{Colors.GREEN}No regressions{Colors.RESET}" if all_ok
+              else f"\n{Colors.RED}Regressions found{Colors.RESET}")
+    sys.exit(0 if all_ok else 1)
+
+
+if __name__ == '__main__':
+    main()
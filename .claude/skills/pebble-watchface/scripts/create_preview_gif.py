@@ -2,143 +2,477 @@
 """
 Create animated GIF previews for each platform by capturing multiple frames.
 
+All platforms capture at the same time, one worker per emulator. PNG decode
+runs in a thread pool while the next screenshots are taken, and GIF encoding
+for one project overlaps capture of the next, so a batch of faces costs
+roughly (frames x delay) per project instead of per platform.
+
+With --step the face must be built with CAPTURE=1 (see frame_governor.h):
+it draws one animation step per accel tap, and each frame is an emu-tap
+followed by a screenshot instead of a timed sleep. The GIF then holds
+exactly frames 0..N-1 of the loop, independent of emulator speed.
+
 Usage:
-    python3 create_preview_gif.py [project_dir] [--frames N] [--delay MS]
+    python3 create_preview_gif.py [project_dir ...] [--frames N] [--delay MS]
+                                  [--platforms P ...] [--install] [--step]
 
 Options:
-    project_dir     Project directory (default: current directory)
+    project_dir     Project directories (default: current directory)
     --frames N      Number of frames to capture (default: 10)
-    --delay MS      Delay between frames in milliseconds (default: 500)
+    --delay MS      Time between frame starts in milliseconds (default: 500)
+    --platforms     Emulators to capture (default: basalt aplite chalk diorite)
+    --install       Launch each emulator and install the project's PBW first
+                    (all platforms in parallel); needed for more than one project
+    --step          Tap-step a CAPTURE=1 build; --delay is then the GIF frame
+                    duration (use the face's interval_ms for real-time playback)
+    --settle MS     With --step, wait this long after each tap (default: 100)
+
+    --reencode GIF  Rewrite existing previews with the encoder below instead of
+                    capturing (e.g. samples/projects/*/preview_*.gif)
+
+GIFs are written by a small encoder here rather than Pillow's: frames share
+one palette of the Pebble colors they use (at most 64, or black and white on
+aplite and diorite), and after the first frame only the bounding box of what
+changed is stored, with unchanged pixels inside it transparent. Identical
+frames merge into one longer frame. A watchface that animates a small sprite over
+a still background then costs roughly the sprite per frame.
 
 Creates:
     - preview_basalt.gif
     - preview_aplite.gif
     - preview_chalk.gif
+    - preview_diorite.gif
 
 Requires: Pillow, pebble SDK installed
 """
 
 import sys
-import os
+import struct
 import subprocess
+import tempfile
 import time
 import argparse
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 
 try:
-    from PIL import Image
+    from PIL import Image, ImageSequence
 except ImportError:
     print("Error: Pillow is required. Install with: pip3 install Pillow")
     sys.exit(1)
 
+PLATFORMS = ["basalt", "aplite", "chalk", "diorite"]
+BW_PLATFORMS = ("aplite", "diorite")
+DECODE_WORKERS = 4
+
+# Pebble color has 2 bits per channel: 64 colors. Screenshots hold at most
+# those 64 (as the SDK color-corrects them); a capture with more colors than
+# a GIF palette fits is snapped to the raw channel levels.
+COLOR_LEVELS = (0x00, 0x55, 0xAA, 0xFF)
+SNAP_LEVEL = bytes(min(COLOR_LEVELS, key=lambda level: abs(level - v)) for v in range(256))
+MAX_COLORS = 255                # One GIF palette slot stays transparent
+MIN_DELAY_CS = 2                # Browsers slow shorter GIF delays down to 100ms
+LZW_MAX_CODE = 4096
+
+
+def emulator_running(emulator: str) -> bool:
+    """Check if an emulator is up by trying to capture from it"""
+    result = subprocess.run(
+        ["pebble", "screenshot", "--emulator", emulator, "/dev/null"],
+        capture_output=True,
+        text=True
+    )
+    return result.returncode == 0
+
+
+def install_on_emulators(project_dir: Path, platforms: list) -> list:
+    """Launch emulators and install the PBW on all platforms at once.
+
+    Returns the platforms that installed successfully.
+    """
+    print(f"Installing on {', '.join(platforms)}...")
+    procs = {
+        platform: subprocess.Popen(
+            ["pebble", "install", "--emulator", platform],
+            cwd=project_dir,
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.PIPE,
+            text=True
+        )
+        for platform in platforms
+    }
+
+    ready = []
+    for platform, proc in procs.items():
+        _, stderr = proc.communicate()
+        if proc.returncode == 0:
+            ready.append(platform)
+        else:
+            last_line = (stderr.strip().splitlines() or ["unknown error"])[-1]
+            print(f"Warning: install failed on {platform}: {last_line}")
+    return ready
+
+
+def load_frame(frame_path: Path):
+    """Decode a screenshot fully so the file can be deleted"""
+    with Image.open(frame_path) as image:
+        return image.convert("RGB")
+
+
+def step_frame(emulator: str, settle_ms: int) -> bool:
+    """Advance a CAPTURE=1 build by one animation step"""
+    result = subprocess.run(
+        ["pebble", "emu-tap", "--emulator", emulator],
+        capture_output=True,
+        text=True
+    )
+    # The tap returns once sent; give the frame time to render
+    time.sleep(settle_ms / 1000.0)
+    return result.returncode == 0
 
-def capture_frames(emulator: str, project_dir: Path, num_frames: int, frame_delay_ms: int) -> list:
-    """Capture multiple frames from an emulator"""
-    frames = []
-    temp_dir = project_dir / "temp_frames"
-    temp_dir.mkdir(exist_ok=True)
 
-    print(f"Capturing {num_frames} frames from {emulator}...")
+def capture_frames(emulator: str, temp_dir: Path, num_frames: int, frame_delay_ms: int,
+                   decode_pool: ThreadPoolExecutor, settle_ms: int = None) -> list:
+    """Capture frames from one emulator on a fixed cadence, or by tap-stepping
+    when settle_ms is set.
+
+    Returns futures of decoded frames; decoding runs in decode_pool while
+    the next screenshots are being taken.
+    """
+    futures = []
+    start = time.monotonic()
 
     for i in range(num_frames):
-        frame_path = temp_dir / f"frame_{emulator}_{i:03d}.png"
+        if settle_ms is not None:
+            # Frame 0 is whatever is on screen after install
+            if i > 0 and not step_frame(emulator, settle_ms):
+                print(f"Warning: emu-tap failed on {emulator}, stopping at frame {i}")
+                break
+        else:
+            # Frame starts are scheduled, so a slow screenshot doesn't stretch the GIF
+            wait = start + i * frame_delay_ms / 1000.0 - time.monotonic()
+            if wait > 0:
+                time.sleep(wait)
 
-        # Capture screenshot
+        frame_path = temp_dir / f"frame_{emulator}_{i:03d}.png"
         result = subprocess.run(
             ["pebble", "screenshot", "--emulator", emulator, str(frame_path)],
             capture_output=True,
             text=True
         )
 
-        if result.returncode != 0:
+        if result.returncode != 0 or not frame_path.exists():
             print(f"Warning: Failed to capture frame {i} for {emulator}")
             continue
 
-        if frame_path.exists():
-            frames.append(Image.open(frame_path).copy())
-
-        # Wait between frames
-        time.sleep(frame_delay_ms / 1000.0)
-
-        # Progress indicator
-        print(f"  Frame {i+1}/{num_frames}", end="\r")
-
-    print(f"  Captured {len(frames)} frames for {emulator}")
-
-    # Cleanup temp files
-    for f in temp_dir.glob(f"frame_{emulator}_*.png"):
-        f.unlink()
-
-    try:
-        temp_dir.rmdir()
-    except OSError:
-        pass  # Directory not empty, other platform frames may exist
-
-    return frames
-
-
-def create_gif(frames: list, output_path: Path, frame_duration_ms: int = 200):
-    """Create animated GIF from frames"""
+        futures.append(decode_pool.submit(load_frame, frame_path))
+
+    print(f"  Captured {len(futures)}/{num_frames} frames for {emulator}")
+    return futures
+
+
+# ============================================================================
+# GIF ENCODING
+# ============================================================================
+
+def index_frames(frames: list, bw: bool):
+    """Index every frame against one shared palette.
+
+    Returns (palette as RGB tuples, one bytes of indices per frame). bw maps
+    to black and white by luma, as the 1-bit display shows it.
+    """
+    rgbs = [frame.tobytes() for frame in frames]
+    if bw:
+        palette = [(0, 0, 0), (255, 255, 255)]
+        return palette, [bytes(1 if r * 299 + g * 587 + b * 114 >= 127500 else 0
+                               for r, g, b in zip(rgb[0::3], rgb[1::3], rgb[2::3])) for rgb in rgbs]
+
+    pixels = [list(zip(rgb[0::3], rgb[1::3], rgb[2::3])) for rgb in rgbs]
+    colors = set().union(*pixels)
+    if len(colors) > MAX_COLORS:
+        rgbs = [rgb.translate(SNAP_LEVEL) for rgb in rgbs]
+        pixels = [list(zip(rgb[0::3], rgb[1::3], rgb[2::3])) for rgb in rgbs]
+        colors = set().union(*pixels)
+    palette = sorted(colors)
+    index_of = {color: i for i, color in enumerate(palette)}
+    return palette, [bytes(map(index_of.__getitem__, px)) for px in pixels]
+
+
+def lzw_encode(indices: bytes, min_code_size: int) -> bytes:
+    """GIF-flavoured LZW: variable code width up to 12 bits, LSB-first"""
+    clear = 1 << min_code_size
+    out = bytearray()
+    bits = 0
+    nbits = 0
+    code_size = min_code_size + 1
+    next_code = clear + 2
+    table = {}
+
+    def emit(code):
+        nonlocal bits, nbits
+        bits |= code << nbits
+        nbits += code_size
+        while nbits >= 8:
+            out.append(bits & 0xFF)
+            bits >>= 8
+            nbits -= 8
+
+    emit(clear)
+    prefix = indices[0]
+    for c in indices[1:]:
+        key = prefix << 8 | c
+        code = table.get(key)
+        if code is not None:
+            prefix = code
+            continue
+        emit(prefix)
+        table[key] = next_code
+        next_code += 1
+        if next_code == LZW_MAX_CODE:
+            emit(clear)
+            table.clear()
+            next_code = clear + 2
+            code_size = min_code_size + 1
+        elif next_code > 1 << code_size:
+            code_size += 1
+        prefix = c
+    emit(prefix)
+    emit(clear + 1)
+    if nbits:
+        out.append(bits & 0xFF)
+    return bytes(out)
+
+
+def changed_box(cur: bytes, prev: bytes, width: int, height: int):
+    """Bounding box (x, y, w, h) of pixels that differ, or None"""
+    rows = [y for y in range(height) if cur[y * width:(y + 1) * width] != prev[y * width:(y + 1) * width]]
+    if not rows:
+        return None
+    left, right = width, -1
+    for y in rows:
+        row = y * width
+        x = 0
+        while cur[row + x] == prev[row + x]:
+            x += 1
+        left = min(left, x)
+        x = width - 1
+        while cur[row + x] == prev[row + x]:
+            x -= 1
+        right = max(right, x)
+    return left, rows[0], right - left + 1, rows[-1] - rows[0] + 1
+
+
+def delta_pixels(cur: bytes, prev: bytes, width: int, box, transparent: int) -> bytes:
+    """The box's pixels, with the ones already on screen made transparent"""
+    x, y, w, h = box
+    out = bytearray()
+    for row in range((y * width) + x, (y + h) * width, width):
+        out += bytes(c if c != p else transparent
+                     for c, p in zip(cur[row:row + w], prev[row:row + w]))
+    return bytes(out)
+
+
+def create_gif(frames: list, output_path: Path, frame_duration_ms=200, bw: bool = False):
+    """Create an animated GIF from RGB frames.
+
+    frame_duration_ms is one duration for every frame or a list, one per
+    frame. bw reduces to black and white (aplite, diorite).
+    """
     if not frames:
         print(f"No frames to create GIF: {output_path}")
         return False
 
-    # Save as animated GIF
-    frames[0].save(
-        output_path,
-        save_all=True,
-        append_images=frames[1:],
-        duration=frame_duration_ms,
-        loop=0  # Loop forever
-    )
-    print(f"Created: {output_path}")
+    width, height = frames[0].size
+    durations = (list(frame_duration_ms) if isinstance(frame_duration_ms, (list, tuple))
+                 else [frame_duration_ms] * len(frames))
+    palette, indexed = index_frames(frames, bw)
+
+    # Global color table: the palette, one transparent slot, padded to 2^depth
+    transparent = len(palette)
+    depth = max(1, transparent.bit_length())
+    color_table = bytes(c for color in palette for c in color) + bytes(3 * ((1 << depth) - len(palette)))
+
+    # (box, pixels, duration); a frame with nothing new lengthens the last one
+    chunks = []
+    prev = None
+    for cur, duration in zip(indexed, durations):
+        if prev is None:
+            chunks.append([(0, 0, width, height), cur, duration])
+        else:
+            box = changed_box(cur, prev, width, height)
+            if box is None:
+                chunks[-1][2] += duration
+            else:
+                chunks.append([box, delta_pixels(cur, prev, width, box, transparent), duration])
+        prev = cur
+
+    min_code_size = max(2, depth)
+    gif = bytearray(b"GIF89a")
+    gif += struct.pack("<HHBBB", width, height, 0x80 | (depth - 1) << 4 | (depth - 1), 0, 0)
+    gif += color_table
+    gif += b"\x21\xFF\x0BNETSCAPE2.0\x03\x01\x00\x00\x00"     # Loop forever
+
+    elapsed_ms = 0
+    for (x, y, w, h), pixels, duration in chunks:
+        # Delays are whole centiseconds; round the running total so they
+        # don't drift
+        delay = round((elapsed_ms + duration) / 10) - round(elapsed_ms / 10)
+        elapsed_ms += duration
+        # Disposal 1 (leave in place) with the transparent index set
+        gif += struct.pack("<BBBBHBB", 0x21, 0xF9, 4, 0x05, max(MIN_DELAY_CS, delay), transparent, 0)
+        gif += struct.pack("<BHHHHB", 0x2C, x, y, w, h, 0)
+        gif.append(min_code_size)
+        data = lzw_encode(pixels, min_code_size)
+        for i in range(0, len(data), 255):
+            block = data[i:i + 255]
+            gif.append(len(block))
+            gif += block
+        gif.append(0)
+    gif.append(0x3B)
+
+    output_path.write_bytes(gif)
+    print(f"Created: {output_path} ({len(chunks)} frames, {len(gif)} bytes)")
     return True
 
 
-def create_preview_gifs(project_dir: str = ".", num_frames: int = 10, frame_delay_ms: int = 500):
-    """Create animated GIF previews for all platforms"""
-
-    project_path = Path(project_dir)
-    platforms = ["basalt", "aplite", "chalk"]
-
-    print(f"Creating preview GIFs with {num_frames} frames each...")
-    print(f"Frame capture delay: {frame_delay_ms}ms")
-    print()
-
-    for platform in platforms:
-        print(f"\n--- {platform.upper()} ---")
-
-        # Check if emulator is running by trying to capture
-        test_result = subprocess.run(
-            ["pebble", "screenshot", "--emulator", platform, "/dev/null"],
-            capture_output=True,
-            text=True
-        )
+def reencode_gif(gif_path: Path):
+    """Rewrite an existing preview with create_gif, keeping its timing"""
+    frames = []
+    durations = []
+    with Image.open(gif_path) as image:
+        for frame in ImageSequence.Iterator(image):
+            frames.append(frame.convert("RGB"))
+            durations.append(frame.info.get("duration", 200))
+    platform = gif_path.stem.replace("preview_", "")
+    return create_gif(frames, gif_path, durations, bw=platform in BW_PLATFORMS)
+
+
+def encode_gif(frame_futures: list, output_path: Path, temp_dir: Path, emulator: str,
+               frame_duration_ms: int = 200):
+    """Wait for decoded frames, write the GIF and remove the screenshots"""
+    frames = []
+    for future in frame_futures:
+        try:
+            frames.append(future.result())
+        except OSError as e:
+            print(f"Warning: Unreadable frame for {emulator}: {e}")
 
-        if test_result.returncode != 0:
-            print(f"Skipping {platform} - emulator not running")
-            print(f"Start with: pebble install --emulator {platform}")
-            continue
+    for f in temp_dir.glob(f"frame_{emulator}_*.png"):
+        f.unlink()
+    return create_gif(frames, output_path, frame_duration_ms=frame_duration_ms,
+                      bw=emulator in BW_PLATFORMS)
 
-        # Capture frames
-        frames = capture_frames(platform, project_path, num_frames, frame_delay_ms)
 
-        if frames:
-            # Create GIF
-            gif_path = project_path / f"preview_{platform}.gif"
-            create_gif(frames, gif_path, frame_duration_ms=200)
+def create_preview_gifs(project_dir: str = ".", num_frames: int = 10, frame_delay_ms: int = 500,
+                        platforms: list = None, install: bool = False,
+                        decode_pool: ThreadPoolExecutor = None, encode_pool: ThreadPoolExecutor = None,
+                        settle_ms: int = None):
+    """Create animated GIF previews for all platforms at once. With settle_ms
+    set, frames are tap-stepped (CAPTURE=1 builds) and frame_delay_ms is the
+    GIF frame duration.
 
-    print("\nDone!")
+    Returns the encode futures; with pools passed in they keep running after
+    this returns, so the caller can start on the next project.
+    """
+    project_path = Path(project_dir)
+    platforms = platforms or PLATFORMS
+    owns_pools = decode_pool is None
+    if owns_pools:
+        decode_pool = ThreadPoolExecutor(max_workers=DECODE_WORKERS)
+        encode_pool = ThreadPoolExecutor(max_workers=len(platforms))
+
+    if settle_ms is None:
+        print(f"\n--- {project_path.resolve().name}: {num_frames} frames every {frame_delay_ms}ms ---")
+    else:
+        print(f"\n--- {project_path.resolve().name}: {num_frames} tap-stepped frames ---")
+
+    if install:
+        ready = install_on_emulators(project_path, platforms)
+    else:
+        with ThreadPoolExecutor(max_workers=len(platforms)) as probe:
+            running = list(probe.map(emulator_running, platforms))
+        ready = [p for p, ok in zip(platforms, running) if ok]
+        for platform in platforms:
+            if platform not in ready:
+                print(f"Skipping {platform} - emulator not running")
+                print(f"Start with: pebble install --emulator {platform}")
+
+    if not ready:
+        if owns_pools:
+            decode_pool.shutdown()
+            encode_pool.shutdown()
+        return []
+
+    temp_dir = Path(tempfile.mkdtemp(prefix="temp_frames_", dir=project_path))
+    with ThreadPoolExecutor(max_workers=len(ready)) as capture_pool:
+        captures = {
+            platform: capture_pool.submit(capture_frames, platform, temp_dir, num_frames,
+                                          frame_delay_ms, decode_pool, settle_ms)
+            for platform in ready
+        }
+        # Timed captures play back at 200ms a frame, stepped ones at --delay
+        duration_ms = 200 if settle_ms is None else frame_delay_ms
+        encodes = [
+            encode_pool.submit(encode_gif, future.result(),
+                               project_path / f"preview_{platform}.gif", temp_dir, platform, duration_ms)
+            for platform, future in captures.items()
+        ]
+
+    def cleanup(_):
+        if all(e.done() for e in encodes):
+            try:
+                temp_dir.rmdir()
+            except OSError:
+                pass
+    for e in encodes:
+        e.add_done_callback(cleanup)
+
+    if owns_pools:
+        for e in encodes:
+            e.result()
+        decode_pool.shutdown()
+        encode_pool.shutdown()
+        print("\nDone!")
+    return encodes
 
 
 def main():
     parser = argparse.ArgumentParser(description="Create animated GIF previews for Pebble watchfaces")
-    parser.add_argument("project_dir", nargs="?", default=".", help="Project directory")
+    parser.add_argument("project_dirs", nargs="*", default=["."], help="Project directories")
     parser.add_argument("--frames", type=int, default=10, help="Number of frames to capture")
-    parser.add_argument("--delay", type=int, default=500, help="Delay between frames (ms)")
+    parser.add_argument("--delay", type=int, default=500, help="Time between frame starts (ms)")
+    parser.add_argument("--platforms", nargs="+", choices=PLATFORMS, default=PLATFORMS,
+                        help="Emulators to capture from")
+    parser.add_argument("--install", action="store_true",
+                        help="Launch emulators and install each project before capturing")
+    parser.add_argument("--step", action="store_true",
+                        help="Tap-step a CAPTURE=1 build instead of capturing on a timer")
+    parser.add_argument("--settle", type=int, default=100,
+                        help="With --step, wait after each tap before the screenshot (ms)")
+    parser.add_argument("--reencode", nargs="+", type=Path, metavar="GIF",
+                        help="Rewrite existing preview GIFs with the palette/delta encoder and exit")
 
     args = parser.parse_args()
-    create_preview_gifs(args.project_dir, args.frames, args.delay)
+    if args.reencode:
+        with ThreadPoolExecutor(max_workers=DECODE_WORKERS) as pool:
+            ok = all(pool.map(reencode_gif, args.reencode))
+        sys.exit(0 if ok else 1)
+    if len(args.project_dirs) > 1 and not args.install:
+        print("Error: capturing several projects needs --install (each one must be on the emulators)")
+        sys.exit(1)
+
+    start = time.monotonic()
+    encodes = []
+    with ThreadPoolExecutor(max_workers=DECODE_WORKERS) as decode_pool, \
+         ThreadPoolExecutor(max_workers=len(args.platforms)) as encode_pool:
+        for project_dir in args.project_dirs:
+            encodes += create_preview_gifs(project_dir, args.frames, args.delay, args.platforms,
+                                           args.install, decode_pool, encode_pool,
+                                           args.settle if args.step else None)
+        for e in encodes:
+            e.result()
+
+    print(f"\nDone in {time.monotonic() - start:.1f}s")
 
 
 if __name__ == "__main__":
@@ -65,51 +65,9 @@ def create_package_json(project_path, name, display_name, author):
     print(f"  Created package.json")
 
 
-def create_wscript(project_path):
-    """Create wscript build file"""
-    content = """#
-# Pebble wscript build configuration
-#
-
-top = '.'
-out = 'build'
-
-def options(ctx):
-    ctx.load('pebble_sdk')
-
-def configure(ctx):
-    ctx.load('pebble_sdk')
-
-def build(ctx):
-    ctx.load('pebble_sdk')
-
-    build_worker = 'worker_src' in ctx.path.ant_glob('worker_src/**/*.c')
-
-    binaries = []
-
-    for p in ctx.env.TARGET_PLATFORMS:
-        ctx.set_env(ctx.all_envs[p])
-        ctx.set_group(ctx.env.PLATFORM_NAME)
-
-        app_elf = '{}/pebble-app.elf'.format(ctx.env.BUILD_DIR)
-        ctx.pbl_program(source=ctx.path.ant_glob('src/c/**/*.c'), target=app_elf)
-
-        if build_worker:
-            worker_elf = '{}/pebble-worker.elf'.format(ctx.env.BUILD_DIR)
-            ctx.pbl_worker(source=ctx.path.ant_glob('worker_src/**/*.c'), target=worker_elf)
-            binaries.append({'platform': p, 'app_elf': app_elf, 'worker_elf': worker_elf})
-        else:
-            binaries.append({'platform': p, 'app_elf': app_elf})
-
-    ctx.set_group('bundle')
-    ctx.pbl_bundle(
-        binaries=binaries,
-        js=ctx.path.ant_glob(['src/js/**/*.js', 'src/js/**/*.json', 'src/common/**/*.js', 'src/common/**/*.json'])
-    )
-"""
-    with open(project_path / 'wscript', 'w') as f:
-        f.write(content)
-
+def create_wscript(project_path, skill_path):
+    """Copy the wscript build file from templates/wscript.template"""
+    shutil.copy(skill_path / 'templates' / 'wscript.template', project_path / 'wscript')
     print(f"  Created wscript")
 
 
@@ -176,6 +134,12 @@ def copy_template(project_path, template_type, skill_path):
                 f.write('#include <pebble.h>\n\nint main(void) {\n    app_event_loop();\n    return 0;\n}\n')
             print(f"  Created src/c/main.c (minimal)")
 
+        # Shared rendering helpers (bg_cache, ...) used by the C templates
+        lib_path = skill_path / 'templates' / 'lib'
+        if lib_path.is_dir():
+            shutil.copytree(lib_path, c_dir / 'lib', dirs_exist_ok=True)
+            print(f"  Created src/c/lib/ from templates/lib")
+
 
 def main():
     parser = argparse.ArgumentParser(description='Create a new Pebble watchface project')
@@ -222,7 +186,7 @@ def main():
 
     # Create files
     create_package_json(project_path, args.name, display_name, args.author)
-    create_wscript(project_path)
+    create_wscript(project_path, skill_path)
     create_gitignore(project_path)
     copy_template(project_path, template_type, skill_path)
 
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""
+Pebble Sprite Atlas Baker
+
+Pre-renders a face's complex vector characters into a packed sprite sheet.
+The face's own drawing code is compiled for the host (see host/host_bake.c)
+with SPRITE_ATLAS_BAKE defined and every pose in its SpriteBake is rendered
+for color (basalt), then shelf-packed into one sheet and its frame table.
+
+Writes into the project:
+    resources/images/<name>~color.png   color sheet (basalt, chalk, emery)
+    src/c/<name>_atlas.h                <NAME>_FRAMES / <NAME>_COUNT
+    package.json                        bitmap resource <NAME>, color platforms only
+
+Black & white platforms get no sheet and keep drawing vectors. Aplite's
+1-bit bitmaps have no alpha, and GCompOpSet there only ORs in white pixels,
+so the sprites' black outlines would drop out.
+
+See templates/lib/sprite_atlas.h for the runtime side. Re-run after
+changing the drawing code, or build with SPRITE_ATLAS set so wscript does
+it on every `pebble build`:
+    SPRITE_ATLAS=/path/to/create_sprite_atlas.py pebble build
+
+Usage:
+    python create_sprite_atlas.py /path/to/watchface
+    python create_sprite_atlas.py /path/to/watchface --padding 2
+
+Requires a C compiler (cc, or set CC).
+
+Exit codes:
+    0 - Atlas written
+    1 - Build, bake or packing failed
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+from benchmark import Colors, compile_face, media_entries, project_sources, write_png
+
+# One sheet per variant, sharing the frame table packed from the union of
+# each sprite's bounds in every render. Color only, see above.
+VARIANTS = {'color': 'basalt'}
+COLOR_PLATFORMS = ['basalt', 'chalk', 'emery']
+BAKE_SOURCES = ['host_graphics.c', 'host_runtime.c', 'host_bake.c']
+MAX_SPRITE_SIDE = 255           # SpriteFrame.w/h are uint8_t
+
+
+def bake_name(project_path):
+    """The SpriteBake .name, read from source so the bake can be bootstrapped"""
+    for source in project_sources(project_path):
+        text = source.read_text(errors='replace')
+        if 'g_sprite_bake' not in text:
+            continue
+        match = re.search(r'\.name\s*=\s*"(\w+)"', text)
+        if match:
+            return match.group(1)
+    return None
+
+
+def bake(project_path, name, platform, out_dir, cc):
+    """Render every pose on one platform: [(dx, dy, w, h, clipped, rows)]"""
+    # The face includes <name>_atlas.h, which doesn't exist before the first
+    # bake; give it an empty table from the build directory
+    stub = out_dir / f"{name}_atlas.h"
+    stub.write_text(atlas_header(name, []))
+    src = project_path / 'src' / 'c'
+    flags = ['-DSPRITE_ATLAS_BAKE', '-I', str(src), '-I', str(src / 'lib'), '-I', str(out_dir)]
+    if not any(entry.get('name') == name.upper() for entry in media_entries(project_path)):
+        flags.append(f"-DRESOURCE_ID_{name.upper()}=0")
+
+    binary = compile_face(project_path, platform, out_dir, cc, BAKE_SOURCES, flags)
+    output = subprocess.run([str(binary)], check=True, capture_output=True, text=True, timeout=60).stdout
+
+    lines = output.splitlines()
+    _, baked_name, count, _, _ = lines[0].split()
+    if baked_name != name:
+        raise ValueError(f"g_sprite_bake.name is '{baked_name}', expected '{name}'")
+    sprites, pos = [], 1
+    for _ in range(int(count)):
+        _, _, dx, dy, w, h, clipped = lines[pos].split()
+        dx, dy, w, h = int(dx), int(dy), int(w), int(h)
+        rows = [bytes.fromhex(line) for line in lines[pos + 1:pos + 1 + h]]
+        sprites.append((dx, dy, w, h, clipped == '1', rows))
+        pos += 1 + h
+    return sprites
+
+
+def merge_bounds(variants):
+    """Per-sprite union of the variants' bounds: [(dx, dy, w, h)]"""
+    bounds = []
+    for renders in zip(*variants.values()):
+        drawn = [r for r in renders if r[2] and r[3]]
+        if not drawn:
+            bounds.append((0, 0, 0, 0))
+            continue
+        x0 = min(r[0] for r in drawn)
+        y0 = min(r[1] for r in drawn)
+        x1 = max(r[0] + r[2] for r in drawn)
+        y1 = max(r[1] + r[3] for r in drawn)
+        bounds.append((x0, y0, x1 - x0, y1 - y0))
+    return bounds
+
+
+def shelf_pack_width(bounds, padding, sheet_w):
+    """Place sprites tallest first in rows: ([(x, y)], sheet_w, sheet_h)"""
+    places = [(0, 0)] * len(bounds)
+    x = y = shelf_h = 0
+    for i in sorted(range(len(bounds)), key=lambda i: -bounds[i][3]):
+        w, h = bounds[i][2], bounds[i][3]
+        if not w or not h:
+            continue
+        if x + w > sheet_w:
+            x, y, shelf_h = 0, y + shelf_h + padding, 0
+        places[i] = (x, y)
+        x += w + padding
+        shelf_h = max(shelf_h, h)
+    return places, sheet_w, max(y + shelf_h, 1)
+
+
+def shelf_pack(bounds, padding):
+    """Shelf pack at the sheet width (multiple of 8) with the least area"""
+    widest = max((w for _, _, w, _ in bounds), default=1)
+    total = sum(w + padding for _, _, w, _ in bounds)
+    widths = range((widest + 7) // 8 * 8, max(total, widest) + 8, 8)
+    return min((shelf_pack_width(bounds, padding, w) for w in widths), key=lambda p: p[1] * p[2])
+
+
+def runtime_bytes(width, height, sheet):
+    """Approximate heap for the sheet: palettized to the fewest bits that fit"""
+    colors = {px for row in sheet for px in row}
+    bits = next(b for b in (1, 2, 4, 8) if len(colors) <= 1 << b)
+    return (width * bits + 7) // 8 * height
+
+
+def gcolor_rgba(argb):
+    """GColor8 byte (2 bits each of a, r, g, b) to an RGBA tuple"""
+    if argb >> 6 == 0:
+        return (0, 0, 0, 0)
+    return ((argb >> 4 & 3) * 85, (argb >> 2 & 3) * 85, (argb & 3) * 85, 255)
+
+
+def render_sheet(sprites, bounds, places, sheet_w, sheet_h):
+    """Blit one variant's sprites into their packed slots"""
+    sheet = [[(0, 0, 0, 0)] * sheet_w for _ in range(sheet_h)]
+    for (dx, dy, w, h, _, rows), (bx, by, _, _), (px, py) in zip(sprites, bounds, places):
+        for y, row in enumerate(rows):
+            for x, argb in enumerate(row):
+                sheet[py + dy - by + y][px + dx - bx + x] = gcolor_rgba(argb)
+    return sheet
+
+
+def atlas_header(name, frames):
+    """src/c/<name>_atlas.h with the frame table"""
+    upper = name.upper()
+    lines = [
+        "// Generated by create_sprite_atlas.py from g_sprite_bake - do not edit",
+        "#pragma once",
+        "",
+        '#include "lib/sprite_atlas.h"',
+        "",
+        f"#define {upper}_COUNT {len(frames)}",
+        "",
+        f"static const SpriteFrame {upper}_FRAMES[{max(len(frames), 1)}] = {{",
+    ]
+    for i, (x, y, w, h, dx, dy) in enumerate(frames):
+        lines.append(f"    {{ {x:3d}, {y:3d}, {w:3d}, {h:3d}, {dx:4d}, {dy:4d} }},  // {i}")
+    lines.append("};")
+    return '\n'.join(lines) + '\n'
+
+
+def add_media_entry(project_path, name):
+    """Register the sheet as a color-only bitmap resource; True if package.json changed"""
+    pkg_path = project_path / 'package.json'
+    pkg = json.loads(pkg_path.read_text())
+    targets = pkg.get('pebble', {}).get('targetPlatforms', COLOR_PLATFORMS)
+    platforms = [p for p in COLOR_PLATFORMS if p in targets]
+    resources = pkg.setdefault('pebble', {}).setdefault('resources', {})
+    media = resources.setdefault('media', [])
+    entry = next((e for e in media if e.get('name') == name.upper()), None)
+    if entry is None:
+        media.append({'type': 'bitmap', 'name': name.upper(), 'file': f"images/{name}.png",
+                      'targetPlatforms': platforms})
+    elif entry.get('targetPlatforms') != platforms:
+        entry['targetPlatforms'] = platforms
+    else:
+        return False
+    pkg_path.write_text(json.dumps(pkg, indent=2) + '\n')
+    return True
+
+
+def create_sprite_atlas(project_path, padding, cc):
+    """Bake, pack and write the atlas; returns True on success"""
+    name = bake_name(project_path)
+    if not name:
+        print(f"{Colors.RED}✗{Colors.RESET} No g_sprite_bake with a .name found under src/c/")
+        return False
+
+    variants = {}
+    with tempfile.TemporaryDirectory(prefix='pebble-bake-') as tmp:
+        for variant, platform in VARIANTS.items():
+            out_dir = Path(tmp) / platform
+            out_dir.mkdir()
+            try:
+                variants[variant] = bake(project_path, name, platform, out_dir, cc)
+            except subprocess.CalledProcessError as e:
+                print(f"{Colors.RED}✗{Colors.RESET} {platform}: bake failed")
+                print('\n'.join('    ' + line for line in (e.stderr or '').strip().splitlines()[:20]))
+                return False
+            except (ValueError, IndexError, subprocess.TimeoutExpired) as e:
+                print(f"{Colors.RED}✗{Colors.RESET} {platform}: bad bake output ({e})")
+                return False
+
+    counts = {len(sprites) for sprites in variants.values()}
+    if len(counts) != 1:
+        print(f"{Colors.RED}✗{Colors.RESET} Sprite count differs between variants: {counts}")
+        return False
+
+    for variant, sprites in variants.items():
+        for i, sprite in enumerate(sprites):
+            if sprite[4]:
+                print(f"{Colors.YELLOW}⚠{Colors.RESET} {variant} sprite {i} touches the canvas edge "
+                      "and may be cut off; move g_sprite_bake.anchor")
+            if not sprite[2]:
+                print(f"{Colors.YELLOW}⚠{Colors.RESET} {variant} sprite {i} drew nothing")
+
+    bounds = merge_bounds(variants)
+    too_big = [i for i, (_, _, w, h) in enumerate(bounds) if w > MAX_SPRITE_SIDE or h > MAX_SPRITE_SIDE]
+    if too_big:
+        print(f"{Colors.RED}✗{Colors.RESET} Sprites larger than {MAX_SPRITE_SIDE}px: {too_big}")
+        return False
+
+    places, sheet_w, sheet_h = shelf_pack(bounds, padding)
+    images = project_path / 'resources' / 'images'
+    images.mkdir(parents=True, exist_ok=True)
+    sizes = {}
+    for variant, sprites in variants.items():
+        sheet = render_sheet(sprites, bounds, places, sheet_w, sheet_h)
+        write_png(images / f"{name}~{variant}.png", sheet_w, sheet_h, sheet)
+        sizes[variant] = runtime_bytes(sheet_w, sheet_h, sheet)
+
+    frames = [(x, y, w, h, dx, dy) for (x, y), (dx, dy, w, h) in zip(places, bounds)]
+    (project_path / 'src' / 'c' / f"{name}_atlas.h").write_text(atlas_header(name, frames))
+    added = add_media_entry(project_path, name)
+
+    print(f"{Colors.GREEN}✓{Colors.RESET} {name}: {len(frames)} sprites in {sheet_w}x{sheet_h} "
+          f"(~{sizes['color'] // 1024 + 1}KB at runtime)")
+    print(f"  resources/images/{name}~color.png, src/c/{name}_atlas.h"
+          + (", package.json" if added else ""))
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Bake vector character poses into a sprite sheet')
+    parser.add_argument('project', type=Path, help='Project directory')
+    parser.add_argument('--padding', type=int, default=1, help='Pixels between packed sprites (default 1)')
+    args = parser.parse_args()
+
+    cc = os.environ.get('CC', 'cc')
+    if not shutil.which(cc):
+        print(f"{Colors.RED}No C compiler found ({cc}); set CC{Colors.RESET}")
+        sys.exit(1)
+
+    sys.exit(0 if create_sprite_atlas(args.project.resolve(), args.padding, cc) else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Generate templates/lib/fixed_tables.c - lookup tables for fixed_tables.h
+
+C has no constexpr, so the tables are computed here and committed as const
+arrays (they live in flash with the code, not on the heap). Re-run after
+changing a table size or curve, then copy the file to each project's
+src/c/lib/.
+
+Usage:
+    python generate_fixed_tables.py            # writes ../templates/lib/fixed_tables.c
+    python generate_fixed_tables.py -o out.c
+"""
+
+import argparse
+import math
+from pathlib import Path
+
+SIN_STEPS = 256      # Must match FIXED_SIN_STEPS
+SIN_ONE = 127        # Q7: 1.0 (int8 can't hold 128)
+EASE_STEPS = 101     # Progress 0..100 inclusive
+
+
+def sin_table():
+    return [round(math.sin(2 * math.pi * i / SIN_STEPS) * SIN_ONE) for i in range(SIN_STEPS)]
+
+
+def ease_in_out_table():
+    # Cosine ease: 50 - 50 * cos(p * pi / 100)
+    return [round(50 - 50 * math.cos(math.pi * p / 100)) for p in range(EASE_STEPS)]
+
+
+def ease_out_table():
+    # Quadratic ease out: 100 - (100 - p)^2 / 100, integer divide as on the watch
+    return [100 - (100 - p) ** 2 // 100 for p in range(EASE_STEPS)]
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = [f"const {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join(f"{v:4d}" for v in values[i:i + per_line])
+        lines.append(f"    {chunk},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def render():
+    parts = [
+        "/**",
+        " * Fixed-Point Tables - see fixed_tables.h",
+        " *",
+        " * Generated by scripts/generate_fixed_tables.py - do not edit by hand.",
+        " */",
+        "",
+        "#include <pebble.h>",
+        '#include "fixed_tables.h"',
+        "",
+        "// sin(2*pi*i/256) * 127; cosine reads the same table a quarter turn ahead",
+        c_array("int8_t", "FIXED_SIN_Q7", sin_table()),
+        "",
+        "// 50 - 50*cos(p*pi/100)",
+        c_array("uint8_t", "FIXED_EASE_IN_OUT", ease_in_out_table(), per_line=17),
+        "",
+        "// 100 - (100-p)^2/100",
+        c_array("uint8_t", "FIXED_EASE_OUT", ease_out_table(), per_line=17),
+        "",
+    ]
+    return "\n".join(parts)
+
+
+def main():
+    default_out = Path(__file__).resolve().parent.parent / 'templates' / 'lib' / 'fixed_tables.c'
+    parser = argparse.ArgumentParser(description='Generate fixed-point lookup tables')
+    parser.add_argument('-o', '--output', type=Path, default=default_out, help='Output .c file')
+    args = parser.parse_args()
+
+    args.output.write_text(render())
+    print(f"Wrote {args.output}")
+
+
+if __name__ == '__main__':
+    main()
@@ -5,20 +5,60 @@ Pebble Watchface Project Validator
 Validates the structure and configuration of a Pebble watchface project
 before building. Checks for common issues and provides helpful feedback.
 
+After `pebble build`, also reads each platform's build/<platform>/pebble-app.elf
+(and the linker map, if there is one) and reports text/data/bss, the largest
+static variables and the RAM left for the heap under the platform's app limit.
+
 Usage:
     python validate_project.py /path/to/watchface
+    python validate_project.py /path/to/watchface --min-headroom 4096
 
 Exit codes:
     0 - All validations passed
-    1 - Validation errors found
+    1 - Validation errors found (including heap headroom below --min-headroom)
 """
 
+import argparse
 import os
 import sys
 import json
 import re
+import struct
 from pathlib import Path
 
+# App RAM per platform: code, statics and heap all come out of this
+APP_RAM_LIMITS = {
+    'aplite': 24 * 1024,
+    'basalt': 64 * 1024,
+    'chalk': 64 * 1024,
+    'diorite': 64 * 1024,
+    'emery': 128 * 1024,
+}
+DEFAULT_MIN_HEADROOM = 2048    # Bytes of heap that must remain after the image
+TOP_SYMBOLS = 5
+
+# Callbacks that run every frame, by the API that registers them and the
+# argument position of the callback
+FRAME_ROOT_APIS = {
+    'layer_set_update_proc': 1,
+    'app_timer_register': 1,
+    'dirty_tracker_create': 2,
+    'frame_governor_create': 1,
+}
+
+# Too slow or allocating for a per-frame path (prefix match for *)
+FRAME_PATH_OFFENDERS = [
+    'gpath_create', 'gbitmap_create*', 'fonts_load_custom_font', 'persist_write_*',
+    'malloc', 'calloc', 'realloc', 'snprintf', 'strftime', 'text_layer_set_text',
+]
+C_KEYWORDS = {'if', 'for', 'while', 'switch', 'return', 'sizeof', 'do', 'else'}
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+STT_OBJECT = 1
+
 
 class Colors:
     """ANSI color codes for terminal output"""
@@ -188,6 +228,269 @@ def validate_c_source(project_path):
     return warnings
 
 
+def read_elf_sections(elf_path):
+    """Section sizes and object symbols of an ELF file.
+
+    Returns (sections, symbols): sections as (name, type, flags, size),
+    symbols as (name, size, section_name) for data objects. Handles 32 and
+    64-bit little-endian files, so host builds can be read too.
+    """
+    data = elf_path.read_bytes()
+    if data[:4] != b'\x7fELF' or data[5] != 1:
+        raise ValueError('not a little-endian ELF file')
+    is64 = data[4] == 2
+
+    if is64:
+        shoff, = struct.unpack_from('<Q', data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x3A)
+    else:
+        shoff, = struct.unpack_from('<I', data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+
+    headers = []
+    for i in range(shnum):
+        off = shoff + i * shentsize
+        if is64:
+            name, kind, flags, _, offset, size, link, _, _, entsize = \
+                struct.unpack_from('<IIQQQQIIQQ', data, off)
+        else:
+            name, kind, flags, _, offset, size, link, _, _, entsize = \
+                struct.unpack_from('<IIIIIIIIII', data, off)
+        headers.append((name, kind, flags, offset, size, link, entsize))
+
+    def c_string(table_offset, index):
+        start = table_offset + index
+        return data[start:data.index(b'\0', start)].decode('ascii', 'replace')
+
+    names_offset = headers[shstrndx][3]
+    sections = [(c_string(names_offset, h[0]), h[1], h[2], h[4]) for h in headers]
+
+    symbols = []
+    for name, kind, flags, offset, size, link, entsize in headers:
+        if kind != SHT_SYMTAB or not entsize:
+            continue
+        strings_offset = headers[link][3]
+        for off in range(offset, offset + size, entsize):
+            if is64:
+                st_name, st_info, _, st_shndx, _, st_size = struct.unpack_from('<IBBHQQ', data, off)
+            else:
+                st_name, _, st_size, st_info, _, st_shndx = struct.unpack_from('<IIIBBH', data, off)
+            if st_info & 0xF == STT_OBJECT and st_size and 0 < st_shndx < len(sections):
+                symbols.append((c_string(strings_offset, st_name), st_size, sections[st_shndx][0]))
+    return sections, symbols
+
+
+def read_map_statics(map_path):
+    """Static RAM (.data + .bss) per object file from a GNU ld map"""
+    per_object = {}
+    text = map_path.read_text(errors='replace')
+    # Input sections: " .bss.name  0xADDR  0xSIZE file.o", long names wrap the line
+    pattern = re.compile(r'^ (\.(?:data|bss)\S*)\s+0x[0-9a-f]+\s+0x([0-9a-f]+)\s+(\S+\.o)\b',
+                         re.MULTILINE)
+    for match in pattern.finditer(text):
+        size = int(match.group(2), 16)
+        if size:
+            obj = Path(match.group(3)).name
+            per_object[obj] = per_object.get(obj, 0) + size
+    return per_object
+
+
+def validate_memory(project_path, min_headroom):
+    """Report RAM use of each built platform; errors below min_headroom"""
+    errors = []
+    build_path = project_path / 'build'
+    elves = sorted(build_path.glob('*/pebble-app.elf')) if build_path.exists() else []
+    if not elves:
+        print_status('info', 'No build/<platform>/pebble-app.elf yet (run pebble build for a memory report)')
+        return errors
+
+    for elf_path in elves:
+        platform = elf_path.parent.name
+        limit = APP_RAM_LIMITS.get(platform)
+        try:
+            sections, symbols = read_elf_sections(elf_path)
+        except (OSError, ValueError, struct.error, IndexError) as e:
+            print_status('warning', f'{platform}: cannot read {elf_path.name}: {e}')
+            continue
+
+        text = data = bss = 0
+        for name, kind, flags, size in sections:
+            if not flags & SHF_ALLOC:
+                continue
+            if kind == SHT_NOBITS:
+                bss += size
+            elif flags & SHF_WRITE:
+                data += size
+            else:
+                text += size
+        image = text + data + bss
+
+        sizes = f'text {text}, data {data}, bss {bss}'
+        if limit is None:
+            print_status('info', f'{platform}: {sizes} (unknown RAM limit)')
+        else:
+            headroom = limit - image
+            summary = f'{platform}: {sizes} -> {headroom} bytes of {limit} left for the heap'
+            if headroom < min_headroom:
+                message = f'{platform}: only {headroom} bytes heap headroom (minimum {min_headroom})'
+                print_status('error', summary)
+                errors.append(message)
+            elif headroom < 2 * min_headroom:
+                print_status('warning', summary)
+            else:
+                print_status('ok', summary)
+
+        statics = sorted((s for s in symbols if s[2].startswith(('.data', '.bss'))),
+                         key=lambda s: -s[1])[:TOP_SYMBOLS]
+        if statics:
+            listing = ', '.join(f'{name} {size}' for name, size, _ in statics)
+            print(f"      largest statics: {listing}")
+
+        maps = sorted(elf_path.parent.glob('*.map'))
+        if maps:
+            per_object = read_map_statics(maps[0])
+            top = sorted(per_object.items(), key=lambda kv: -kv[1])[:TOP_SYMBOLS]
+            if top:
+                print(f"      statics by file: {', '.join(f'{obj} {size}' for obj, size in top)}")
+
+    print_status('info', 'Heap headroom must also hold runtime allocations (bg_cache bitmaps, layers, GPaths)')
+    return errors
+
+
+def strip_c_noise(code):
+    """Blank out comments, string/char literals and preprocessor lines,
+    keeping line breaks so positions still make sense"""
+    pattern = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'|^[ \t]*#[^\n]*',
+                         re.DOTALL | re.MULTILINE)
+    return pattern.sub(lambda m: re.sub(r'[^\n]', ' ', m.group(0)), code)
+
+
+def parse_functions(code):
+    """Top-level function definitions: {name: body}"""
+    functions = {}
+    header = re.compile(r'(\w+)\s*\([^;{}()]*(?:\([^;{}()]*\)[^;{}()]*)*\)\s*$')
+    depth = 0
+    start = 0        # Where the text before the next top-level brace begins
+    body_start = None
+    name = None
+    for i, ch in enumerate(code):
+        if ch == '{':
+            if depth == 0:
+                match = header.search(code[start:i])
+                name = match.group(1) if match and match.group(1) not in C_KEYWORDS else None
+                body_start = i + 1
+            depth += 1
+        elif ch == '}':
+            depth -= 1
+            if depth == 0:
+                if name:
+                    functions[name] = code[body_start:i]
+                name = None
+                start = i + 1
+        elif ch == ';' and depth == 0:
+            start = i + 1
+    return functions
+
+
+def split_args(text):
+    """Top-level comma-separated arguments of the call starting at text[0] == '('"""
+    args, depth, current = [], 0, ''
+    for ch in text:
+        if ch == '(':
+            depth += 1
+            if depth == 1:
+                continue
+        elif ch == ')':
+            depth -= 1
+            if depth == 0:
+                args.append(current.strip())
+                return args
+        elif ch == ',' and depth == 1:
+            args.append(current.strip())
+            current = ''
+            continue
+        current += ch
+    return args
+
+
+def find_frame_roots(code):
+    """Functions registered as update procs or frame/timer callbacks"""
+    roots = set()
+    for api, position in FRAME_ROOT_APIS.items():
+        for match in re.finditer(r'\b' + api + r'\s*(?=\()', code):
+            args = split_args(code[match.end():])
+            if position < len(args) and re.fullmatch(r'\w+', args[position]):
+                roots.add(args[position])
+    return roots
+
+
+def offender_calls(body):
+    """Offending API names called in a function body"""
+    found = []
+    for offender in FRAME_PATH_OFFENDERS:
+        name = offender.rstrip('*') + (r'\w*' if offender.endswith('*') else '')
+        for match in re.finditer(r'\b(' + name + r')\s*\(', body):
+            if match.group(1) not in found:
+                found.append(match.group(1))
+    return found
+
+
+def validate_frame_path(project_path):
+    """Flag allocations and slow calls reachable from per-frame callbacks.
+
+    Builds a call graph of the project's own functions (src/c/lib/ is
+    treated as vetted and left out) starting from every update proc, timer
+    callback and frame governor / dirty tracker proc. A function is linked
+    to every project function it names, so callbacks passed along count.
+    """
+    warnings = []
+    functions = {}
+    roots = set()
+    for source_file in sorted((project_path / 'src').rglob('*.c')):
+        if 'lib' in source_file.relative_to(project_path / 'src').parts:
+            continue
+        try:
+            code = strip_c_noise(source_file.read_text())
+        except OSError as e:
+            warnings.append(f'Could not analyze {source_file.name}: {e}')
+            continue
+        functions.update(parse_functions(code))
+        roots |= find_frame_roots(code)
+
+    roots &= set(functions)
+    if not roots:
+        print_status('info', 'No update procs or frame callbacks found')
+        return warnings
+
+    names = set(functions)
+    edges = {name: sorted(set(re.findall(r'\b\w+\b', body)) & names - {name})
+             for name, body in functions.items()}
+
+    # Breadth-first from the roots, remembering how each function was reached
+    parent = {root: None for root in sorted(roots)}
+    queue = sorted(roots)
+    while queue:
+        current = queue.pop(0)
+        for callee in edges[current]:
+            if callee not in parent:
+                parent[callee] = current
+                queue.append(callee)
+
+    for name in parent:
+        for call in offender_calls(functions[name]):
+            chain = [name]
+            while parent[chain[-1]]:
+                chain.append(parent[chain[-1]])
+            warnings.append(f"{call}() on the per-frame path: {' -> '.join(reversed(chain))}")
+
+    if warnings:
+        for warning in warnings:
+            print_status('warning', warning)
+    else:
+        print_status('ok', f"No allocations or slow calls reachable from {', '.join(sorted(roots))}")
+    return warnings
+
+
 def validate_resources(project_path):
     """Check resources directory"""
     resources_path = project_path / 'resources'
@@ -209,11 +512,13 @@ def validate_resources(project_path):
 
 
 def main():
-    if len(sys.argv) < 2:
-        print(f"Usage: {sys.argv[0]} /path/to/watchface/project")
-        sys.exit(1)
+    parser = argparse.ArgumentParser(description='Validate a Pebble watchface project')
+    parser.add_argument('project', type=Path, help='Project directory')
+    parser.add_argument('--min-headroom', type=int, default=DEFAULT_MIN_HEADROOM,
+                        help=f'Fail when a built platform leaves fewer heap bytes (default {DEFAULT_MIN_HEADROOM})')
+    args = parser.parse_args()
 
-    project_path = Path(sys.argv[1]).resolve()
+    project_path = args.project.resolve()
 
     print(f"\n{Colors.BOLD}Validating Pebble Watchface Project{Colors.RESET}")
     print(f"Project: {project_path}\n")
@@ -248,10 +553,18 @@ def main():
     print(f"\n{Colors.BOLD}Analyzing C source code...{Colors.RESET}")
     validate_c_source(project_path)
 
+    print(f"\n{Colors.BOLD}Checking per-frame code paths...{Colors.RESET}")
+    validate_frame_path(project_path)
+
     # Resources check
     print(f"\n{Colors.BOLD}Checking resources...{Colors.RESET}")
     validate_resources(project_path)
 
+    # Memory budget of the last build
+    print(f"\n{Colors.BOLD}Checking memory budget...{Colors.RESET}")
+    errors = validate_memory(project_path, args.min_headroom)
+    all_errors.extend(errors)
+
     # Summary
     print(f"\n{Colors.BOLD}Summary{Colors.RESET}")
     if all_errors:
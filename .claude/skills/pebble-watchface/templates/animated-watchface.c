@@ -10,6 +10,15 @@
  */
 
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/dirty_tracker.h"
+#include "lib/draw_batch.h"
+#include "lib/entity_pool.h"
+#include "lib/frame_governor.h"
+#include "lib/path_pool.h"
+#include "lib/profiler.h"
+#include "lib/round_mask.h"
+#include "lib/time_text.h"
 
 // ============================================================================
 // CONFIGURATION - Customize these values
@@ -17,32 +26,31 @@
 
 #define WATCHFACE_NAME "My Animated Watch"
 
-// Animation settings
-#define ANIMATION_INTERVAL 50           // Normal: 50ms = 20 FPS
-#define ANIMATION_INTERVAL_LOW_POWER 100 // Low battery: 100ms = 10 FPS
-#define LOW_BATTERY_THRESHOLD 20        // Throttle below 20%
+// Animation settings (the frame governor picks the actual interval)
+#define ANIMATION_INTERVAL 50           // Full activity: 50ms = 20 FPS
+#define ANIMATION_INTERVAL_IDLE 500     // Nothing moving: 2 FPS
+#define ANIMATION_INTERVAL_MAX 1000     // Cap under low battery / overload
+#define LOW_BATTERY_THRESHOLD 20        // Intervals double at or below 20%
 
-// Element counts - adjust based on your design
+// Element counts - adjust based on your design. Particles are cheap (6
+// bytes each, dead slots skipped 32 at a time): snow or rain can use a few
+// hundred, reported to the dirty tracker as one union box, not a slot each
 #define MAX_PARTICLES 8
 #define MAX_MOVING_OBJECTS 4
+#define PARTICLE_SPAWN_PERCENT 16       // Chance per frame of a new particle
 
-// ============================================================================
-// DATA STRUCTURES - Define your animated elements
-// ============================================================================
+// Dirty-rect slots: one per animated element
+#define DIRTY_OBJECT_BASE 0
+#define DIRTY_PARTICLE_BASE (DIRTY_OBJECT_BASE + MAX_MOVING_OBJECTS)
+#define DIRTY_BACKGROUND_ELEMENT (DIRTY_PARTICLE_BASE + MAX_PARTICLES)
+#define NUM_DIRTY_SLOTS (DIRTY_BACKGROUND_ELEMENT + 1)
 
-typedef struct {
-    GPoint pos;
-    int direction;  // 1 or -1
-    int speed;
-    bool active;
-} MovingObject;
+// Sprite commands per frame: a circle per particle, circle + tail per object
+#define SPRITE_BATCH_SIZE (MAX_PARTICLES + 2 * MAX_MOVING_OBJECTS)
 
-typedef struct {
-    GPoint pos;
-    int size;
-    int speed;
-    bool active;
-} Particle;
+// Profiler sections (only active when built with PROFILE=1, see profiler.h)
+enum { PROF_UPDATE, PROF_SCENERY, PROF_SPRITES, NUM_PROF };
+static const char *const PROF_NAMES[NUM_PROF] = { "update", "scenery", "sprites" };
 
 // ============================================================================
 // GLOBAL STATE
@@ -54,26 +62,60 @@ static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
 static Layer *s_battery_layer;
-static AppTimer *s_animation_timer;
 
-// Battery state
-static int s_battery_level = 100;
-static bool s_is_charging = false;
+// Owns the animation timer (see frame_governor.h)
+static FrameGovernor *s_governor;
+
+// Static scenery, rendered once and blitted every frame
+static BgCache *s_bg_cache;
+
+// Repaints only around elements that moved (see dirty_tracker.h)
+static DirtyTracker *s_dirty;
+
+// Part of the screen not covered by Timeline Quick View. The scene is laid
+// out inside it and nothing below it is repainted.
+static GRect s_visible;
+
+// Time and date strings, set only when they change (see time_text.h)
+static TimeText *s_time_text;
 
-// Animated elements
-static MovingObject s_objects[MAX_MOVING_OBJECTS];
-static Particle s_particles[MAX_PARTICLES];
+// Animated elements, struct-of-arrays: the pools track live slots, the
+// arrays hold each field indexed by slot (see entity_pool.h)
+static EntityPool *s_object_pool;
+static int16_t s_object_x[MAX_MOVING_OBJECTS];
+static int16_t s_object_y[MAX_MOVING_OBJECTS];
+static int8_t s_object_dir[MAX_MOVING_OBJECTS];        // 1 or -1
+static uint8_t s_object_speed[MAX_MOVING_OBJECTS];
+
+static EntityPool *s_particle_pool;
+static int16_t s_particle_x[MAX_PARTICLES];
+static int16_t s_particle_y[MAX_PARTICLES];
+static uint8_t s_particle_size[MAX_PARTICLES];
+static uint8_t s_particle_speed[MAX_PARTICLES];
 
 // Animation state
 static int32_t s_animation_phase = 0;
 
-// Pre-allocated paths (for complex shapes)
-static GPath *s_shape_path = NULL;
-static GPoint s_shape_points[4];
-static GPathInfo s_shape_info = {
-    .num_points = 4,
-    .points = s_shape_points
-};
+// Pre-allocated paths (for complex shapes): never gpath_create() per frame.
+// Fixed shapes use path_pool_add(); PATH_SHAPE's points can change per frame
+// with path_pool_set_points(), then path_pool_fill(s_paths, ctx, PATH_SHAPE, pos, angle).
+static PathPool *s_paths = NULL;
+enum { PATH_SHAPE, NUM_PATHS };
+
+// Small primitives queued with their color and flushed once per update proc,
+// one color change per group (see lib/draw_batch.h)
+static DrawBatch *s_sprites = NULL;
+
+// Startup runs in stages so the first frame is on screen before entity
+// init and the non-essential subscriptions (see STARTUP below)
+typedef enum {
+    STARTUP_FIRST_FRAME,    // Window loaded, waiting for the first render
+    STARTUP_SCENE,          // Spawn the animated elements, start the governor
+    STARTUP_SERVICES,       // Battery, Quick View
+    STARTUP_DONE,
+} StartupStage;
+static StartupStage s_startup_stage;
+static AppTimer *s_startup_timer;
 
 // ============================================================================
 // UTILITY FUNCTIONS
@@ -85,52 +127,95 @@ static int random_in_range(int min, int max) {
     return min + (rand() % range);
 }
 
+// Horizon, 8px above the bottom of the visible area
+static int16_t ground_y(void) {
+    return s_visible.size.h - 8;
+}
+
+// `rect` cut to the visible area (it always starts at the top of the screen)
+static GRect visible_part(GRect rect) {
+    int16_t bottom = rect.origin.y + rect.size.h;
+    if (bottom > s_visible.size.h) bottom = s_visible.size.h;
+    if (bottom <= rect.origin.y) return GRectZero;
+    rect.size.h = bottom - rect.origin.y;
+    return rect;
+}
+
 // ============================================================================
 // INITIALIZATION FUNCTIONS
 // ============================================================================
 
-static void init_moving_object(MovingObject *obj) {
-    obj->pos.y = random_in_range(30, 130);
-    obj->direction = (random_in_range(0, 1) * 2) - 1;
-    obj->speed = random_in_range(1, 3);
-    obj->pos.x = (obj->direction == 1) ? -10 : 154;
-    obj->active = true;
+// Objects enter and leave just past the edge, fully outside the screen, so
+// object_bbox() misses it and nothing is drawn while they're off it
+#define OBJECT_MARGIN 12
+
+static void init_moving_object(int i) {
+    s_object_y[i] = random_in_range(30, ground_y() - 30);
+    s_object_dir[i] = (random_in_range(0, 1) * 2) - 1;
+    s_object_speed[i] = random_in_range(1, 3);
+    s_object_x[i] = (s_object_dir[i] == 1) ? -OBJECT_MARGIN : s_visible.size.w + OBJECT_MARGIN;
 }
 
-static void init_particle(Particle *p) {
-    p->pos.x = random_in_range(10, 134);
-    p->pos.y = 168;  // Start at bottom
-    p->size = random_in_range(1, 3);
-    p->speed = random_in_range(1, 3);
-    p->active = true;
+static void spawn_particle(void) {
+    int i = entity_pool_spawn(s_particle_pool);
+    if (i < 0) return;  // Pool full
+    s_particle_x[i] = random_in_range(s_visible.origin.x + 10, s_visible.origin.x + s_visible.size.w - 10);
+    s_particle_y[i] = s_visible.size.h;  // Start at the visible bottom
+    s_particle_size[i] = random_in_range(1, 3);
+    s_particle_speed[i] = random_in_range(1, 3);
+}
+
+// ============================================================================
+// BOUNDING BOXES - Must cover everything the draw functions touch
+// ============================================================================
+
+static GRect object_bbox(int i) {
+    // Body radius 5 (+1 rounding), tail 10px behind it on the trailing side
+    int16_t left = (s_object_dir[i] == 1) ? s_object_x[i] - 11 : s_object_x[i] - 6;
+    return GRect(left, s_object_y[i] - 6, 18, 13);
+}
+
+static GRect particle_bbox(int i) {
+    int16_t size = s_particle_size[i];
+    return GRect(s_particle_x[i] - size - 1, s_particle_y[i] - size - 1, 2 * size + 3, 2 * size + 3);
+}
+
+static GRect background_element_bbox(void) {
+    // Line from (20, ground) to (20 +/- 10, ground - 20), 2px wide
+    return GRect(8, ground_y() - 22, 25, 25);
 }
 
 // ============================================================================
 // DRAWING FUNCTIONS - Customize your visuals here
 // ============================================================================
 
-static void draw_moving_object(GContext *ctx, const MovingObject *obj) {
-    if (!obj || !obj->active) return;
+// Everything that doesn't move goes here. It is cached by bg_cache and only
+// redrawn when the cache is invalidated (new hour, obstruction change).
+// Only the visible area is painted; the rest is never blitted.
+static void draw_static_scenery(GContext *ctx, GRect bounds) {
+    graphics_context_set_fill_color(ctx, GColorBlack);
+    graphics_fill_rect(ctx, s_visible, 0, GCornerNone);
 
-    graphics_context_set_fill_color(ctx, GColorWhite);
+    // Example: Horizon line
+    graphics_context_set_stroke_color(ctx, GColorWhite);
+    graphics_draw_line(ctx, GPoint(0, ground_y()), GPoint(bounds.size.w, ground_y()));
+}
+
+// Sprites are queued into s_sprites and drawn grouped by color on flush
+static void draw_moving_object(DrawBatch *batch, int i) {
+    GPoint pos = GPoint(s_object_x[i], s_object_y[i]);
 
     // Example: Draw a simple circle
-    graphics_fill_circle(ctx, obj->pos, 5);
+    draw_batch_fill_circle(batch, pos, 5, GColorWhite);
 
     // Example: Draw a directional tail
-    GPoint tail_end = {
-        obj->pos.x - (obj->direction * 10),
-        obj->pos.y
-    };
-    graphics_context_set_stroke_color(ctx, GColorWhite);
-    graphics_draw_line(ctx, obj->pos, tail_end);
+    GPoint tail_end = GPoint(pos.x - (s_object_dir[i] * 10), pos.y);
+    draw_batch_line(batch, pos, tail_end, GColorWhite, 1);
 }
 
-static void draw_particle(GContext *ctx, const Particle *p) {
-    if (!p || !p->active) return;
-
-    graphics_context_set_stroke_color(ctx, GColorWhite);
-    graphics_draw_circle(ctx, p->pos, p->size);
+static void draw_particle(DrawBatch *batch, int i) {
+    draw_batch_draw_circle(batch, GPoint(s_particle_x[i], s_particle_y[i]), s_particle_size[i],
+                           GColorWhite, 1);
 }
 
 static void draw_background_element(GContext *ctx, int32_t phase) {
@@ -140,8 +225,8 @@ static void draw_background_element(GContext *ctx, int32_t phase) {
     graphics_context_set_stroke_color(ctx, GColorWhite);
     graphics_context_set_stroke_width(ctx, 2);
 
-    GPoint start = {20, 160};
-    GPoint end = {20 + offset, 140};
+    GPoint start = {20, ground_y()};
+    GPoint end = {20 + offset, ground_y() - 20};
     graphics_draw_line(ctx, start, end);
 
     // Add more background elements as needed
@@ -152,43 +237,43 @@ static void draw_background_element(GContext *ctx, int32_t phase) {
 // ============================================================================
 
 static void update_moving_objects(void) {
-    for (int i = 0; i < MAX_MOVING_OBJECTS; i++) {
-        if (!s_objects[i].active) continue;
-
-        s_objects[i].pos.x += s_objects[i].direction * s_objects[i].speed;
+    ENTITY_POOL_FOREACH(s_object_pool, i) {
+        s_object_x[i] += s_object_dir[i] * s_object_speed[i];
 
         // Reset when off screen
-        if ((s_objects[i].direction == 1 && s_objects[i].pos.x > 154) ||
-            (s_objects[i].direction == -1 && s_objects[i].pos.x < -10)) {
-            init_moving_object(&s_objects[i]);
+        if ((s_object_dir[i] == 1 && s_object_x[i] > s_visible.size.w + OBJECT_MARGIN) ||
+            (s_object_dir[i] == -1 && s_object_x[i] < -OBJECT_MARGIN)) {
+            init_moving_object(i);
         }
     }
 }
 
 static void update_particles(void) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (s_particles[i].active) {
-            s_particles[i].pos.y -= s_particles[i].speed;
+    // Only live slots are visited
+    ENTITY_POOL_FOREACH(s_particle_pool, i) {
+        s_particle_y[i] -= s_particle_speed[i];
 
-            // Slight horizontal wobble
-            if (random_in_range(0, 2) == 0) {
-                s_particles[i].pos.x += random_in_range(-1, 1);
-            }
+        // Slight horizontal wobble
+        if (random_in_range(0, 2) == 0) {
+            s_particle_x[i] += random_in_range(-1, 1);
+        }
 
-            // Deactivate when off screen
-            if (s_particles[i].pos.y < 0) {
-                s_particles[i].active = false;
-            }
-        } else {
-            // Random chance to spawn
-            if (random_in_range(0, 100) < 2) {
-                init_particle(&s_particles[i]);
-            }
+        // Free the slot when off screen; its old box is erased once more
+        if (s_particle_y[i] < 0) {
+            entity_pool_kill(s_particle_pool, i);
+            dirty_tracker_set_bbox(s_dirty, DIRTY_PARTICLE_BASE + i, GRectZero);
         }
     }
+
+    // Random chance to spawn
+    if (random_in_range(0, 99) < PARTICLE_SPAWN_PERCENT) {
+        spawn_particle();
+    }
 }
 
 static void animation_update(void) {
+    PROFILE_BEGIN(PROF_UPDATE);
+
     // Update animation phase with overflow protection
     s_animation_phase = (s_animation_phase + 200) % TRIG_MAX_ANGLE;
 
@@ -196,34 +281,73 @@ static void animation_update(void) {
     update_moving_objects();
     update_particles();
 
-    // Request redraw
-    if (s_canvas_layer) {
-        layer_mark_dirty(s_canvas_layer);
+    // Request redraw of the areas that changed (dead slots were cleared on
+    // kill). Whatever Quick View covers isn't repainted, so sprites under it
+    // cost nothing.
+    ENTITY_POOL_FOREACH(s_object_pool, i) {
+        dirty_tracker_set_bbox(s_dirty, DIRTY_OBJECT_BASE + i, visible_part(object_bbox(i)));
+    }
+    ENTITY_POOL_FOREACH(s_particle_pool, i) {
+        dirty_tracker_set_bbox(s_dirty, DIRTY_PARTICLE_BASE + i, visible_part(particle_bbox(i)));
     }
+    dirty_tracker_set_bbox(s_dirty, DIRTY_BACKGROUND_ELEMENT, visible_part(background_element_bbox()));
+
+    // A cache rebuild has to repaint everything that can be seen
+    if (!bg_cache_is_valid(s_bg_cache)) {
+        dirty_tracker_add_rect(s_dirty, s_visible);
+    }
+    dirty_tracker_commit(s_dirty);
+
+    PROFILE_END(PROF_UPDATE);
 }
 
 // ============================================================================
 // LAYER UPDATE PROCEDURES
 // ============================================================================
 
+static void startup_step(void *context);
+
+// Runs once per dirty clip layer; drawing is clipped to that layer's frame.
+// Everything overlapping the clip must be redrawn, moving or not.
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
-    GRect bounds = layer_get_bounds(layer);
+    GRect bounds = layer_get_bounds(s_canvas_layer);
+    frame_governor_render_begin(s_governor);
 
-    // Clear background
-    graphics_context_set_fill_color(ctx, GColorBlack);
-    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    // Restore cached static scenery under the clip (rebuilt on demand)
+    PROFILE_BEGIN(PROF_SCENERY);
+    bg_cache_draw(s_bg_cache, ctx, bounds);
+    PROFILE_END(PROF_SCENERY);
 
-    // Draw background elements
-    draw_background_element(ctx, s_animation_phase);
+    PROFILE_BEGIN(PROF_SPRITES);
 
-    // Draw particles
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        draw_particle(ctx, &s_particles[i]);
+    // Draw animated background elements
+    if (dirty_tracker_overlaps(layer, background_element_bbox())) {
+        draw_background_element(ctx, s_animation_phase);
     }
 
-    // Draw moving objects
-    for (int i = 0; i < MAX_MOVING_OBJECTS; i++) {
-        draw_moving_object(ctx, &s_objects[i]);
+    // Draw particles, then moving objects on top (batch layer 1)
+    draw_batch_begin(s_sprites, ctx);
+    ENTITY_POOL_FOREACH(s_particle_pool, i) {
+        if (dirty_tracker_overlaps(layer, particle_bbox(i))) {
+            draw_particle(s_sprites, i);
+        }
+    }
+
+    draw_batch_set_layer(s_sprites, 1);
+    ENTITY_POOL_FOREACH(s_object_pool, i) {
+        if (dirty_tracker_overlaps(layer, object_bbox(i))) {
+            draw_moving_object(s_sprites, i);
+        }
+    }
+    draw_batch_flush(s_sprites);
+
+    PROFILE_END(PROF_SPRITES);
+    frame_governor_render_end(s_governor);
+
+    if (s_startup_stage == STARTUP_FIRST_FRAME) {
+        PROFILE_STARTUP_MARK("first frame");
+        s_startup_stage = STARTUP_SCENE;
+        s_startup_timer = app_timer_register(0, startup_step, NULL);
     }
 }
 
@@ -249,38 +373,82 @@ static void battery_update_proc(Layer *layer, GContext *ctx) {
 // TIME HANDLING
 // ============================================================================
 
-static void update_time(void) {
-    time_t temp = time(NULL);
-    struct tm *tick_time = localtime(&temp);
+static const TimeTextConfig TIME_TEXT_CONFIG = {
+    .date_format = "%a, %b %d",
+};
 
-    if (!tick_time || !s_time_layer || !s_date_layer) return;
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+    uint8_t changed = time_text_update(s_time_text, tick_time, units_changed);
+
+    // Rebuild time-of-day scenery (e.g. the sky) on the hour; otherwise
+    // only repaint under the text that changed
+    if (units_changed & HOUR_UNIT) {
+        bg_cache_invalidate(s_bg_cache);
+        dirty_tracker_mark_all(s_dirty);
+    } else if (changed) {
+        if (changed & TIME_TEXT_TIME) {
+            dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_time_layer)));
+        }
+        if (changed & TIME_TEXT_DATE) {
+            dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_date_layer)));
+        }
+    } else {
+        return;
+    }
 
-    static char time_buffer[8];
-    strftime(time_buffer, sizeof(time_buffer), "%I:%M", tick_time);
-    text_layer_set_text(s_time_layer, time_buffer);
+    // Commit now: the text layers redraw this render pass, and the next
+    // animation frame may be far off (asleep, or a CAPTURE build)
+    dirty_tracker_commit(s_dirty);
+}
 
-    static char date_buffer[24];
-    strftime(date_buffer, sizeof(date_buffer), "%a, %b %d", tick_time);
-    text_layer_set_text(s_date_layer, date_buffer);
+// Fits the scene into the area Quick View leaves uncovered
+static void layout_scene(Layer *window_layer) {
+    GRect bounds = layer_get_bounds(window_layer);
+#if PBL_API_EXISTS(layer_get_unobstructed_bounds)
+    s_visible = layer_get_unobstructed_bounds(window_layer);
+#else
+    s_visible = bounds;
+#endif
+
+    // Time and date keep their place relative to the visible height
+    int16_t time_y = 50 * s_visible.size.h / bounds.size.h;
+    layer_set_frame(text_layer_get_layer(s_time_layer), GRect(0, time_y, bounds.size.w, 34));
+    layer_set_frame(text_layer_get_layer(s_date_layer), GRect(0, time_y + 34, bounds.size.w, 20));
 }
 
-static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-    update_time();
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+// Once the slide has finished: relayout, rebuild the cache and repaint
+// what is now visible, once. Nothing is done per step of the slide.
+static void unobstructed_did_change(void *context) {
+    layout_scene(window_get_root_layer(s_main_window));
+    bg_cache_invalidate(s_bg_cache);
+    dirty_tracker_add_rect(s_dirty, s_visible);
+    dirty_tracker_commit(s_dirty);
 }
+#endif
 
 // ============================================================================
 // TIMER HANDLING
 // ============================================================================
 
-static void animation_timer_callback(void *data) {
-    animation_update();
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+    .interval_ms = ANIMATION_INTERVAL,
+    .idle_interval_ms = ANIMATION_INTERVAL_IDLE,
+    .max_interval_ms = ANIMATION_INTERVAL_MAX,
+    .low_battery_percent = LOW_BATTERY_THRESHOLD,
+};
 
-    // Schedule next frame (battery-aware)
-    uint32_t interval = (s_battery_level <= LOW_BATTERY_THRESHOLD && !s_is_charging)
-                        ? ANIMATION_INTERVAL_LOW_POWER
-                        : ANIMATION_INTERVAL;
+// 0-100: how much is moving. Return less while the scene is calm (every
+// sprite resting) so the governor can drop towards ANIMATION_INTERVAL_IDLE.
+static uint8_t scene_activity(void) {
+    return 100;
+}
 
-    s_animation_timer = app_timer_register(interval, animation_timer_callback, NULL);
+// Called by the governor, which re-arms the timer afterwards
+static void animation_frame(void *context) {
+    animation_update();
+    frame_governor_set_activity(s_governor, scene_activity());
+    PROFILE_FRAME(frame_governor_interval(s_governor));
 }
 
 // ============================================================================
@@ -288,10 +456,12 @@ static void animation_timer_callback(void *data) {
 // ============================================================================
 
 static void battery_callback(BatteryChargeState state) {
-    s_battery_level = state.charge_percent;
-    s_is_charging = state.is_charging;
+    frame_governor_set_battery(s_governor, state);
 
+    // The battery layer draws over whatever is below it: restore that first
     if (s_battery_layer) {
+        dirty_tracker_add_rect(s_dirty, layer_get_frame(s_battery_layer));
+        dirty_tracker_commit(s_dirty);
         layer_mark_dirty(s_battery_layer);
     }
 }
@@ -304,10 +474,14 @@ static void main_window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
     GRect bounds = layer_get_bounds(window_layer);
 
-    // Canvas layer (full screen for animations)
+    // Canvas layer (full screen for animations). It has no update proc of
+    // its own: the dirty tracker's clip layers inside it do the drawing.
     s_canvas_layer = layer_create(bounds);
-    layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
+    s_dirty = dirty_tracker_create(s_canvas_layer, NUM_DIRTY_SLOTS, canvas_update_proc);
+
+    // Static scenery cache (bitmap is allocated on first draw)
+    s_bg_cache = bg_cache_create(draw_static_scenery);
 
     // Time layer
     GRect time_frame = {{0, 50}, {bounds.size.w, 34}};
@@ -326,42 +500,83 @@ static void main_window_load(Window *window) {
     text_layer_set_font(s_date_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18));
     text_layer_set_text_alignment(s_date_layer, GTextAlignmentCenter);
     layer_add_child(window_layer, text_layer_get_layer(s_date_layer));
+    s_time_text = time_text_create(&TIME_TEXT_CONFIG, s_time_layer, s_date_layer);
+    layout_scene(window_layer);
 
-    // Battery layer
-    GRect battery_frame = {{bounds.size.w - 25, 5}, {20, 8}};
+    // Battery layer (pulled in from the masked-off corner on round)
+    GRect battery_frame = round_mask_fit_rect(bounds, GRect(bounds.size.w - 25, 5, 20, 8));
     s_battery_layer = layer_create(battery_frame);
     layer_set_update_proc(s_battery_layer, battery_update_proc);
     layer_add_child(window_layer, s_battery_layer);
 
-    // Initialize animated elements
-    for (int i = 0; i < MAX_MOVING_OBJECTS; i++) {
-        init_moving_object(&s_objects[i]);
+    // Frame timing (compiled out unless profiling)
+    PROFILE_INIT(PROF_NAMES, NUM_PROF);
+    PROFILE_HUD_ATTACH(window_layer, GRect(0, bounds.size.h - 42, bounds.size.w, 42));
+
+    // Empty entity pools, pre-allocated paths and the sprite batch; the
+    // elements themselves spawn after the first frame
+    s_object_pool = entity_pool_create(MAX_MOVING_OBJECTS);
+    s_particle_pool = entity_pool_create(MAX_PARTICLES);
+    s_paths = path_pool_create(NUM_PATHS);
+    path_pool_add_scratch(s_paths, 4);
+    s_sprites = draw_batch_create(SPRITE_BATCH_SIZE);
+
+    // First frame: scenery and time only, painted on this event-loop turn
+    time_text_refresh(s_time_text);
+    s_startup_stage = STARTUP_FIRST_FRAME;
+    dirty_tracker_commit(s_dirty);
+}
+
+static void main_window_unload(Window *window) {
+    // Unloaded mid-startup: the next stage would find nothing to start
+    if (s_startup_timer) {
+        app_timer_cancel(s_startup_timer);
+        s_startup_timer = NULL;
     }
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        s_particles[i].active = false;
+    s_startup_stage = STARTUP_DONE;
+
+    // Stop animation timer
+    if (s_governor) {
+        frame_governor_destroy(s_governor);
+        s_governor = NULL;
     }
 
-    // Create pre-allocated paths
-    s_shape_path = gpath_create(&s_shape_info);
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+#endif
 
-    // Start animation timer
-    s_animation_timer = app_timer_register(ANIMATION_INTERVAL, animation_timer_callback, NULL);
+    PROFILE_DEINIT();
 
-    // Initial time update
-    update_time();
-}
+    // Destroy entity pools
+    if (s_object_pool) {
+        entity_pool_destroy(s_object_pool);
+        s_object_pool = NULL;
+    }
+    if (s_particle_pool) {
+        entity_pool_destroy(s_particle_pool);
+        s_particle_pool = NULL;
+    }
 
-static void main_window_unload(Window *window) {
-    // Cancel animation timer
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
+    // Destroy paths and the sprite batch
+    if (s_paths) {
+        path_pool_destroy(s_paths);
+        s_paths = NULL;
+    }
+    if (s_sprites) {
+        draw_batch_destroy(s_sprites);
+        s_sprites = NULL;
     }
 
-    // Destroy paths
-    if (s_shape_path) {
-        gpath_destroy(s_shape_path);
-        s_shape_path = NULL;
+    // Destroy background cache
+    if (s_bg_cache) {
+        bg_cache_destroy(s_bg_cache);
+        s_bg_cache = NULL;
+    }
+
+    // Destroy dirty tracker (owns clip layers inside the canvas)
+    if (s_dirty) {
+        dirty_tracker_destroy(s_dirty);
+        s_dirty = NULL;
     }
 
     // Destroy layers
@@ -369,6 +584,8 @@ static void main_window_unload(Window *window) {
         layer_destroy(s_canvas_layer);
         s_canvas_layer = NULL;
     }
+    time_text_destroy(s_time_text);
+    s_time_text = NULL;
     if (s_time_layer) {
         text_layer_destroy(s_time_layer);
         s_time_layer = NULL;
@@ -383,27 +600,74 @@ static void main_window_unload(Window *window) {
     }
 }
 
+// ============================================================================
+// STARTUP
+// ============================================================================
+
+// One stage per event-loop turn after the first frame, so input and
+// rendering get a turn in between. Keep the first frame's work (window
+// load) to what that frame shows; everything else goes here.
+static void startup_step(void *context) {
+    s_startup_timer = NULL;
+
+    switch (s_startup_stage) {
+        case STARTUP_SCENE: {
+            // All objects live, particles spawn later
+            int slot;
+            while ((slot = entity_pool_spawn(s_object_pool)) >= 0) {
+                init_moving_object(slot);
+            }
+
+            // Start animation timer
+            s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
+            frame_governor_set_battery(s_governor, battery_state_service_peek());
+            frame_governor_run(s_governor, true);
+            break;
+        }
+
+        case STARTUP_SERVICES:
+            battery_state_service_subscribe(battery_callback);
+
+            // Rebuild the cache when Timeline Quick View slides in or out
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+            unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+                .did_change = unobstructed_did_change
+            }, NULL);
+#endif
+            PROFILE_STARTUP_MARK("ready");
+            PROFILE_STARTUP_LOG();
+            break;
+
+        default:
+            return;
+    }
+
+    s_startup_stage++;
+    if (s_startup_stage != STARTUP_DONE) {
+        s_startup_timer = app_timer_register(0, startup_step, NULL);
+    }
+}
+
 // ============================================================================
 // APPLICATION LIFECYCLE
 // ============================================================================
 
 static void init(void) {
+    PROFILE_STARTUP_BEGIN();
     srand(time(NULL));
 
     s_main_window = window_create();
+    // Clear background keeps the previous frame for dirty-rect updates
+    window_set_background_color(s_main_window, GColorClear);
     window_set_window_handlers(s_main_window, (WindowHandlers) {
         .load = main_window_load,
         .unload = main_window_unload
     });
     window_stack_push(s_main_window, true);
 
+    // The time must stay current from the first frame; the rest waits
+    // for startup_step()
     tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
-    battery_state_service_subscribe(battery_callback);
-
-    // Get initial battery state
-    BatteryChargeState state = battery_state_service_peek();
-    s_battery_level = state.charge_percent;
-    s_is_charging = state.is_charging;
 }
 
 static void deinit(void) {
@@ -0,0 +1,62 @@
+/**
+ * Cull
+ *
+ * Skips sprites that can't change the frame: ones entirely off the screen,
+ * and ones entirely under something opaque drawn after them in the same
+ * update proc (a skyline overlay, a searchlight beam, a glow disc).
+ *
+ * The dirty tracker already skips sprites outside this frame's clip. Cull
+ * covers what it can't: faces that repaint everything, full repaints with
+ * sprites still beyond the edge, and sprites that get painted over.
+ *
+ * Occluders are convex - rectangles, filled circles and thick strokes - so
+ * a bounding box is hidden when its four corners are inside one of them.
+ * Circles and strokes are shrunk by a pixel for the rasterizer's rounding,
+ * so a sprite at their very edge is drawn, never wrongly dropped; rects
+ * fill exactly their pixels and are used as given. Only register shapes
+ * that are fully opaque where they are drawn.
+ *
+ * Usage:
+ *     s_cull = cull_create(layer_get_bounds(window_layer), 8);    // window load
+ *
+ *     // update proc, before the sprites; occluders are drawn after them
+ *     cull_clear(s_cull);
+ *     cull_add_stroke(s_cull, beam_start, beam_end, BEAM_WIDTH);
+ *     cull_add_rect(s_cull, skyline_rect);
+ *     for (int i = 0; i < NUM_STARS; i++) {
+ *         if (cull_visible(s_cull, star_bbox(i))) draw_star(ctx, i);
+ *     }
+ *     draw_beam(ctx);
+ *     draw_skyline(ctx);
+ *
+ *     cull_destroy(s_cull);                                        // window unload
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+typedef struct Cull Cull;
+
+// `screen` is the area sprites can show in; at most `max_occluders` shapes
+// per frame (extra ones are ignored, which only culls less)
+Cull *cull_create(GRect screen, uint8_t max_occluders);
+void cull_destroy(Cull *cull);
+
+// The visible area changed (unobstructed area, rotation of a round face)
+void cull_set_screen(Cull *cull, GRect screen);
+
+// Drop every occluder; call when the scene changes, usually once per frame
+void cull_clear(Cull *cull);
+
+void cull_add_rect(Cull *cull, GRect rect);
+void cull_add_circle(Cull *cull, GPoint center, uint16_t radius);
+
+// A graphics_draw_line() with stroke width `width`
+void cull_add_stroke(Cull *cull, GPoint from, GPoint to, uint8_t width);
+
+// Does any of `bbox` lie on the screen? (the inscribed circle on round)
+bool cull_on_screen(const Cull *cull, GRect bbox);
+
+// On the screen and not entirely under an occluder
+bool cull_visible(const Cull *cull, GRect bbox);
@@ -0,0 +1,61 @@
+/**
+ * Dirty Tracker
+ *
+ * Repaints only the parts of the screen that changed. Each animated entity
+ * reports its bounding box every frame; the tracker unions it with the
+ * entity's box from the previous frame (so its old position gets erased)
+ * and merges the results into a few clip layers. Only those clip layers are
+ * marked dirty, so the update proc only touches pixels near moving sprites.
+ *
+ * Requirements:
+ *   - The window background must be GColorClear so the previous frame
+ *     survives in the frame buffer between renders.
+ *   - The update proc must restore the background under its clip itself,
+ *     e.g. with bg_cache_draw() (drawing is clipped to the layer frame).
+ *   - Coordinates are screen coordinates: each clip layer's bounds are
+ *     offset so drawing code doesn't change.
+ *
+ * Usage:
+ *     s_dirty = dirty_tracker_create(s_canvas_layer, NUM_ENTITIES, canvas_update_proc);
+ *
+ *     // every frame, after updating the entities
+ *     dirty_tracker_set_bbox(s_dirty, i, entity_bbox(&s_entities[i]));
+ *     dirty_tracker_commit(s_dirty);
+ *
+ *     // in canvas_update_proc
+ *     bg_cache_draw(s_bg_cache, ctx, screen_bounds);
+ *     if (dirty_tracker_overlaps(layer, entity_bbox(e))) draw_entity(ctx, e);
+ *
+ * Call dirty_tracker_mark_all() whenever everything must be repainted: the
+ * background cache was invalidated, the app regained focus, text changed.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+// Number of clip layers; more rects = tighter fit but more update proc calls
+#define DIRTY_TRACKER_MAX_RECTS 3
+
+typedef struct DirtyTracker DirtyTracker;
+
+// Creates the clip layers as children of `parent`, which should cover the
+// screen at (0, 0). The first frame is a full repaint.
+DirtyTracker *dirty_tracker_create(Layer *parent, uint16_t num_entities, LayerUpdateProc update_proc);
+void dirty_tracker_destroy(DirtyTracker *tracker);
+
+// Records where entity `index` is drawn this frame. Pass GRectZero for
+// entities that are hidden.
+void dirty_tracker_set_bbox(DirtyTracker *tracker, uint16_t index, GRect bbox);
+
+// Adds a one-off dirty rectangle (battery indicator changed, ...).
+void dirty_tracker_add_rect(DirtyTracker *tracker, GRect rect);
+
+// Repaints the whole parent on the next commit.
+void dirty_tracker_mark_all(DirtyTracker *tracker);
+
+// Turns this frame's dirty rects into clip layers and marks them dirty.
+void dirty_tracker_commit(DirtyTracker *tracker);
+
+// For use in the update proc: does `rect` touch the area `layer` repaints?
+bool dirty_tracker_overlaps(Layer *layer, GRect rect);
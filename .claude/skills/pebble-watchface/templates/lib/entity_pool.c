@@ -0,0 +1,89 @@
+/**
+ * Entity Pool - see entity_pool.h
+ */
+
+#include <pebble.h>
+#include "entity_pool.h"
+
+#define WORD_BITS 32
+
+struct EntityPool {
+    uint16_t capacity;
+    uint16_t count;
+    uint16_t num_words;
+    uint32_t live[];            // Bit i of word w = slot w * 32 + i
+};
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+EntityPool *entity_pool_create(uint16_t capacity) {
+    uint16_t num_words = (capacity + WORD_BITS - 1) / WORD_BITS;
+    EntityPool *pool = calloc(1, sizeof(EntityPool) + num_words * sizeof(uint32_t));
+    if (!pool) return NULL;
+    pool->capacity = capacity;
+    pool->num_words = num_words;
+    return pool;
+}
+
+void entity_pool_destroy(EntityPool *pool) {
+    free(pool);
+}
+
+int entity_pool_spawn(EntityPool *pool) {
+    if (!pool || pool->count == pool->capacity) return -1;
+
+    for (int w = 0; w < pool->num_words; w++) {
+        uint32_t free_bits = ~pool->live[w];
+        if (!free_bits) continue;
+
+        int slot = w * WORD_BITS + __builtin_ctz(free_bits);
+        if (slot >= pool->capacity) return -1;  // Padding bits of the last word
+        pool->live[w] |= 1u << (slot % WORD_BITS);
+        pool->count++;
+        return slot;
+    }
+    return -1;
+}
+
+void entity_pool_kill(EntityPool *pool, uint16_t slot) {
+    if (!entity_pool_is_live(pool, slot)) return;
+    pool->live[slot / WORD_BITS] &= ~(1u << (slot % WORD_BITS));
+    pool->count--;
+}
+
+void entity_pool_clear(EntityPool *pool) {
+    if (!pool) return;
+    memset(pool->live, 0, pool->num_words * sizeof(uint32_t));
+    pool->count = 0;
+}
+
+bool entity_pool_is_live(const EntityPool *pool, uint16_t slot) {
+    return pool && slot < pool->capacity &&
+           (pool->live[slot / WORD_BITS] & (1u << (slot % WORD_BITS)));
+}
+
+uint16_t entity_pool_count(const EntityPool *pool) {
+    return pool ? pool->count : 0;
+}
+
+uint16_t entity_pool_capacity(const EntityPool *pool) {
+    return pool ? pool->capacity : 0;
+}
+
+int entity_pool_next(const EntityPool *pool, int slot) {
+    if (!pool || pool->count == 0) return -1;
+
+    int start = slot + 1;
+    int w = start / WORD_BITS;
+    if (w >= pool->num_words) return -1;
+
+    // Drop the bits at and below `slot` in its word, then skip empty words
+    uint32_t bits = pool->live[w] & (~0u << (start % WORD_BITS));
+    while (!bits) {
+        if (++w >= pool->num_words) return -1;
+        bits = pool->live[w];
+    }
+    return w * WORD_BITS + __builtin_ctz(bits);
+}
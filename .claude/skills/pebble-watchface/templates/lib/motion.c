@@ -0,0 +1,150 @@
+/**
+ * Motion - see motion.h
+ */
+
+#include <pebble.h>
+#include "motion.h"
+
+static const AccelSamplingRate RATES[] = {
+    ACCEL_SAMPLING_10HZ, ACCEL_SAMPLING_25HZ, ACCEL_SAMPLING_50HZ, ACCEL_SAMPLING_100HZ,
+};
+#define NUM_RATES ((int)(sizeof(RATES) / sizeof(RATES[0])))
+
+struct Motion {
+    MotionConfig config;
+    MotionShakeHandler shake_handler;
+    MotionTapHandler tap_handler;
+    void *context;
+
+    AccelSamplingRate rate;
+    uint8_t batch;
+    int32_t threshold_sq;       // threshold_mg squared, compared against x*x+y*y+z*z
+    bool sampling;              // accel_data_service subscribed
+    uint32_t wake_until;
+    uint32_t quiet_until;       // Cooldown end
+};
+
+// Service handlers get no context pointer; one Motion per app
+static Motion *s_motion;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t prv_now_ms(void) {
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t)seconds * 1000 + ms;
+}
+
+// Wrap-safe "a is later than b" for prv_now_ms() values
+static bool prv_after(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+static bool prv_batch_shakes(const Motion *motion, const AccelData *data, uint32_t num_samples) {
+    for (uint32_t i = 0; i < num_samples; i++) {
+        if (data[i].did_vibrate) continue;
+        int32_t x = data[i].x, y = data[i].y, z = data[i].z;
+        if (x * x + y * y + z * z > motion->threshold_sq) return true;
+    }
+    return false;
+}
+
+static void prv_data_handler(AccelData *data, uint32_t num_samples);
+
+static void prv_set_sampling(Motion *motion, bool sampling) {
+    if (motion->sampling == sampling) return;
+    motion->sampling = sampling;
+    if (sampling) {
+        // The rate applies to the current subscription, so set it after
+        accel_data_service_subscribe(motion->batch, prv_data_handler);
+        accel_service_set_sampling_rate(motion->rate);
+    } else {
+        accel_data_service_unsubscribe();
+    }
+}
+
+static void prv_data_handler(AccelData *data, uint32_t num_samples) {
+    Motion *motion = s_motion;
+    if (!motion || !data) return;
+
+    uint32_t now = prv_now_ms();
+    if (!prv_after(motion->quiet_until, now) && prv_batch_shakes(motion, data, num_samples)) {
+        motion->quiet_until = now + motion->config.cooldown_ms;
+        motion_wake(motion);
+        if (motion->shake_handler) motion->shake_handler(motion->context);
+        return;
+    }
+    if (motion->config.idle_ms && prv_after(now, motion->wake_until)) {
+        prv_set_sampling(motion, false);
+    }
+}
+
+static void prv_tap_handler(AccelAxisType axis, int32_t direction) {
+    Motion *motion = s_motion;
+    if (!motion) return;
+    motion_wake(motion);
+    if (motion->tap_handler) motion->tap_handler(axis, direction, motion->context);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+Motion *motion_create(const MotionConfig *config, MotionShakeHandler shake_handler,
+                      MotionTapHandler tap_handler, void *context) {
+    Motion *motion = calloc(1, sizeof(Motion));
+    if (!motion) return NULL;
+
+    motion->config = *config;
+    motion->shake_handler = shake_handler;
+    motion->tap_handler = tap_handler;
+    motion->context = context;
+    motion->threshold_sq = (int32_t)config->threshold_mg * config->threshold_mg;
+
+    // Slowest rate that still samples every peak
+    motion->rate = RATES[NUM_RATES - 1];
+    for (int i = 0; i < NUM_RATES; i++) {
+        if (1000 / RATES[i] <= config->min_peak_ms) {
+            motion->rate = RATES[i];
+            break;
+        }
+    }
+    // Biggest batch the latency allows
+    uint32_t batch = (uint32_t)config->max_latency_ms * motion->rate / 1000;
+    motion->batch = batch < 1 ? 1 : batch > MOTION_MAX_BATCH ? MOTION_MAX_BATCH : batch;
+
+    motion->quiet_until = prv_now_ms();
+    s_motion = motion;
+    accel_tap_service_subscribe(prv_tap_handler);
+    motion_wake(motion);
+    return motion;
+}
+
+void motion_destroy(Motion *motion) {
+    if (!motion) return;
+    prv_set_sampling(motion, false);
+    accel_tap_service_unsubscribe();
+    if (s_motion == motion) s_motion = NULL;
+    free(motion);
+}
+
+void motion_wake(Motion *motion) {
+    if (!motion) return;
+    motion->wake_until = prv_now_ms() + motion->config.idle_ms;
+    prv_set_sampling(motion, true);
+}
+
+bool motion_is_idle(const Motion *motion) {
+    return motion && !motion->sampling;
+}
+
+AccelSamplingRate motion_sampling_rate(const Motion *motion) {
+    return motion ? motion->rate : ACCEL_SAMPLING_25HZ;
+}
+
+uint8_t motion_batch_size(const Motion *motion) {
+    return motion ? motion->batch : 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * Motion
+ *
+ * Shake detection from raw accelerometer samples, with as few wakeups as
+ * the gesture allows, plus wrist flicks from accel_tap_service.
+ *
+ * Sampling is picked from what the shake needs rather than the service
+ * default (25 Hz, one wakeup per batch):
+ *
+ *   - Rate: the lowest of 10/25/50/100 Hz whose sample period is at most
+ *     `min_peak_ms`. A vigorous shake swings past 2 g several times, each
+ *     peak lasting ~100 ms, so 10 Hz still lands samples on them
+ *   - Batch: as many samples as fit in `max_latency_ms` (up to 25). The app
+ *     wakes once per batch; 10 Hz x 5 samples is 2 wakeups/s instead of 5
+ *   - Idle: `idle_ms` after the last motion_wake() (or shake) the data
+ *     service is dropped and only taps are listened to. A shake starts with
+ *     a flick, so the first tap wakes sampling again and the rest of the
+ *     shake is caught within one batch
+ *
+ * The cooldown uses time_ms(), so `cooldown_ms` is honoured to the
+ * millisecond. Samples taken while the motor ran (did_vibrate) are ignored,
+ * so a vibes_short_pulse() in the shake handler can't trigger another.
+ *
+ * Usage:
+ *     static const MotionConfig MOTION_CONFIG = {
+ *         .threshold_mg = 2000, .min_peak_ms = 100, .max_latency_ms = 500,
+ *         .cooldown_ms = 1500, .idle_ms = ANIMATION_BURST_MS,
+ *     };
+ *     s_motion = motion_create(&MOTION_CONFIG, on_shake, on_tap, NULL);  // init
+ *     motion_wake(s_motion);          // scene woke some other way (focus)
+ *     motion_destroy(s_motion);       // deinit
+ *
+ * The accel services take no context pointer: one Motion per app. It owns
+ * the tap subscription, so handle flicks in `tap_handler` rather than
+ * subscribing separately (capture mode's frame_governor_wake() stepping
+ * keeps working from there).
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define MOTION_MAX_BATCH 25     // accel_data_service limit per update
+
+typedef struct {
+    uint16_t threshold_mg;      // Shake when |accel| exceeds this (1000 = gravity at rest)
+    uint16_t min_peak_ms;       // Shortest above-threshold peak that must be sampled
+    uint16_t max_latency_ms;    // Longest wait from a sample to the handler
+    uint16_t cooldown_ms;       // Ignore shakes this long after one fires
+    uint32_t idle_ms;           // Taps only after this long without a wake (0 = never)
+} MotionConfig;
+
+typedef void (*MotionShakeHandler)(void *context);
+typedef void (*MotionTapHandler)(AccelAxisType axis, int32_t direction, void *context);
+
+typedef struct Motion Motion;
+
+// `config` is copied. Subscribes to taps and starts sampling. Either
+// handler may be NULL.
+Motion *motion_create(const MotionConfig *config, MotionShakeHandler shake_handler,
+                      MotionTapHandler tap_handler, void *context);
+void motion_destroy(Motion *motion);
+
+// Restarts the `idle_ms` window, resubscribing to samples if idle. Taps
+// and shakes call this themselves.
+void motion_wake(Motion *motion);
+bool motion_is_idle(const Motion *motion);
+
+// Chosen sampling, for logging and the docs
+AccelSamplingRate motion_sampling_rate(const Motion *motion);
+uint8_t motion_batch_size(const Motion *motion);
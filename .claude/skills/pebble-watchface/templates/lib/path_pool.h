@@ -0,0 +1,51 @@
+/**
+ * Path Pool
+ *
+ * Creates every GPath once at window load and reuses it each frame through
+ * gpath_move_to() / gpath_rotate_to(), instead of a gpath_create() +
+ * gpath_destroy() pair per draw. On aplite that is one less malloc/free
+ * per shape per frame out of ~24 KB of heap.
+ *
+ * Define shapes around their own origin and place them with an offset:
+ *
+ *     static const GPoint POT_POINTS[] = { {-30, -21}, {30, -21}, {22, 0}, {-22, 0} };
+ *     enum { PATH_POT, NUM_PATHS };
+ *
+ *     s_paths = path_pool_create(NUM_PATHS);                        // window load
+ *     path_pool_add(s_paths, POT_POINTS, ARRAY_LENGTH(POT_POINTS));  // in enum order
+ *
+ *     path_pool_fill(s_paths, ctx, PATH_POT, GPoint(cx, y_base), 0); // update proc
+ *     path_pool_destroy(s_paths);                                   // window unload
+ *
+ * Shapes whose points change between frames get a scratch buffer instead;
+ * path_pool_set_points() copies into it without allocating:
+ *
+ *     path_pool_add_scratch(s_paths, 8);
+ *     path_pool_set_points(s_paths, PATH_WAVE, points, count);
+ *
+ * A GPath keeps a pointer to its points, so arrays passed to path_pool_add()
+ * must outlive the pool (static const).
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+typedef struct PathPool PathPool;
+
+PathPool *path_pool_create(uint8_t capacity);
+void path_pool_destroy(PathPool *pool);
+
+// Return the new path's id (their order of addition), or -1 if full / out of memory
+int path_pool_add(PathPool *pool, const GPoint *points, uint16_t num_points);
+int path_pool_add_scratch(PathPool *pool, uint16_t max_points);
+
+// Scratch paths only; extra points beyond max_points are dropped
+void path_pool_set_points(PathPool *pool, int id, const GPoint *points, uint16_t num_points);
+
+// NULL for an unknown id
+GPath *path_pool_get(PathPool *pool, int id);
+
+// Move to `offset`, rotate to `angle` (TRIG_MAX_ANGLE units), then draw
+void path_pool_fill(PathPool *pool, GContext *ctx, int id, GPoint offset, int32_t angle);
+void path_pool_outline(PathPool *pool, GContext *ctx, int id, GPoint offset, int32_t angle);
@@ -0,0 +1,123 @@
+/**
+ * Frame Profiler
+ *
+ * Times named sections of the update/draw code with time_ms() and keeps
+ * rolling min/avg/max/p95 per section over the last PROFILER_WINDOW frames.
+ * Stats are logged over APP_LOG every PROFILER_LOG_FRAMES frames and can be
+ * shown in an on-watch HUD.
+ *
+ * Opt-in at build time; without the flags every macro compiles to nothing:
+ *     PROFILE=1 pebble build      // -DPROFILER: timing + APP_LOG
+ *     PROFILE=hud pebble build    // also -DPROFILER_HUD: on-watch overlay
+ *
+ * Usage:
+ *     enum { PROF_UPDATE, PROF_BG, PROF_SPRITES, NUM_PROF };
+ *     static const char *const PROF_NAMES[] = { "update", "bg", "sprites" };
+ *
+ *     PROFILE_INIT(PROF_NAMES, NUM_PROF);           // window load
+ *     PROFILE_HUD_ATTACH(root_layer, GRect(...));   // optional, window load
+ *
+ *     PROFILE_BEGIN(PROF_BG);                       // around any code
+ *     bg_cache_draw(s_bg_cache, ctx, bounds);
+ *     PROFILE_END(PROF_BG);
+ *
+ *     PROFILE_FRAME(ANIMATION_INTERVAL);            // end of the animation timer
+ *     PROFILE_DEINIT();                             // window unload
+ *
+ * Startup is timed separately, from the top of init() to named marks,
+ * and logged once the app says it is done starting:
+ *     PROFILE_STARTUP_BEGIN();                      // first line of init()
+ *     PROFILE_STARTUP_MARK("first frame");          // end of the first render
+ *     PROFILE_STARTUP_MARK("ready");                // last deferred init step
+ *     PROFILE_STARTUP_LOG();                        // "prof startup: first frame 41 ms ..."
+ * A label is recorded the first time it is marked only, so a mark can sit
+ * in code that runs every frame. Marks also repeat in every periodic log.
+ *
+ * A section may run several times per frame (e.g. once per dirty clip
+ * layer); its times are summed into one sample. Rendering happens after the
+ * timer callback returns, so draw sections land in the following frame's
+ * sample. The "frame" line is the measured timer period against the
+ * requested interval: if it is well above, the hardware can't sustain it.
+ *
+ * Resolution is 1 ms; averages are reported to 0.1 ms.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define PROFILER_MAX_SECTIONS 8
+#define PROFILER_WINDOW 32          // Frames of history per section
+#define PROFILER_MAX_MARKS 4        // Startup marks kept
+
+#ifndef PROFILER_LOG_FRAMES
+#define PROFILER_LOG_FRAMES 128     // 0 = never log
+#endif
+
+typedef struct {
+    uint8_t min;
+    uint8_t max;
+    uint8_t p95;
+    uint16_t avg_x10;               // Average in tenths of a millisecond
+    uint8_t samples;
+} ProfilerStats;
+
+#if defined(PROFILER)
+
+// `names` must outlive the profiler (use a static const array)
+void profiler_init(const char *const *names, int count);
+void profiler_deinit(void);
+
+void profiler_begin(int section);
+void profiler_end(int section);
+
+// Closes the frame: stores section samples and the timer period
+void profiler_frame_end(uint16_t budget_ms);
+
+// Section == count passed to profiler_init() reads the frame period
+bool profiler_get_stats(int section, ProfilerStats *stats);
+
+void profiler_log(void);
+
+// Startup timing; independent of profiler_init(), which may run later
+void profiler_startup_begin(void);
+void profiler_startup_mark(const char *label);   // `label`: a literal
+// Milliseconds from begin to `label`'s mark, or -1 if not marked
+int profiler_startup_ms(const char *label);
+void profiler_startup_log(void);
+
+#define PROFILE_INIT(names, count) profiler_init(names, count)
+#define PROFILE_DEINIT() profiler_deinit()
+#define PROFILE_BEGIN(section) profiler_begin(section)
+#define PROFILE_END(section) profiler_end(section)
+#define PROFILE_FRAME(budget_ms) profiler_frame_end(budget_ms)
+#define PROFILE_STARTUP_BEGIN() profiler_startup_begin()
+#define PROFILE_STARTUP_MARK(label) profiler_startup_mark(label)
+#define PROFILE_STARTUP_LOG() profiler_startup_log()
+
+#else
+
+#define PROFILE_INIT(names, count) ((void)(names), (void)(count))
+#define PROFILE_DEINIT() ((void)0)
+#define PROFILE_BEGIN(section) ((void)0)
+#define PROFILE_END(section) ((void)0)
+#define PROFILE_FRAME(budget_ms) ((void)0)
+#define PROFILE_STARTUP_BEGIN() ((void)0)
+#define PROFILE_STARTUP_MARK(label) ((void)0)
+#define PROFILE_STARTUP_LOG() ((void)0)
+
+#endif
+
+#if defined(PROFILER) && defined(PROFILER_HUD)
+
+// Adds an opaque stats overlay on top of `parent`'s children. It is
+// repainted every frame, so keep it small.
+void profiler_hud_attach(Layer *parent, GRect frame);
+
+#define PROFILE_HUD_ATTACH(parent, frame) profiler_hud_attach(parent, frame)
+
+#else
+
+#define PROFILE_HUD_ATTACH(parent, frame) ((void)0)
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * Round Mask
+ *
+ * Layout and visibility for the circular display (chalk). The frame buffer
+ * only stores the pixels inside the circle, so fills there are already clipped
+ * row by row: a full-screen rect costs no more than the circle. What does cost
+ * is work nobody sees - a battery icon or a star in a corner still pays its
+ * draw call and state changes every frame.
+ *
+ * `screen` is the layer bounds the face is laid out in. On round displays
+ * the visible area is the circle inscribed in it; on rectangular displays
+ * it is the whole rect and every call below is a plain bounds check.
+ *
+ * Usage:
+ *     // window load: pull corner widgets in from the edge on round
+ *     GRect battery = round_mask_fit_rect(bounds, GRect(bounds.size.w - 26, 6, 22, 10));
+ *
+ *     // update proc: skip sprites the mask would swallow
+ *     if (round_mask_rect_visible(bounds, star_bbox(i))) draw_star(ctx, i);
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+// Visible columns of screen row `y`. False when the row is outside `screen`
+// or entirely masked.
+bool round_mask_row_span(GRect screen, int16_t y, int16_t *min_x, int16_t *max_x);
+
+// Can any pixel of `rect` show? Errs on the side of drawing.
+bool round_mask_rect_visible(GRect screen, GRect rect);
+
+// `rect` slid horizontally toward the center until every pixel of it shows
+// (same rows, so it keeps its place above or below the content). Returned
+// unchanged on rectangular displays, or when it's too wide for its rows.
+GRect round_mask_fit_rect(GRect screen, GRect rect);
@@ -0,0 +1,132 @@
+/**
+ * Scheduler - see scheduler.h
+ */
+
+#include <pebble.h>
+#include "scheduler.h"
+
+typedef struct {
+    SchedulerTaskProc proc;
+    void *context;
+    uint32_t period;
+    uint32_t slack;             // How late the task may run
+    uint32_t due;
+} Task;
+
+struct Scheduler {
+    Task tasks[SCHEDULER_MAX_TASKS];
+    AppTimer *timer;
+    uint32_t timer_at;          // When `timer` fires
+    uint32_t wakeups;
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t prv_now_ms(void) {
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t)seconds * 1000 + ms;
+}
+
+// Wrap-safe "a is later than b" for prv_now_ms() values
+static bool prv_after(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+static void prv_timer_callback(void *data) {
+    Scheduler *scheduler = data;
+    scheduler->timer = NULL;
+    scheduler->wakeups++;
+    scheduler_service(scheduler);
+}
+
+// One timer for the earliest deadline any task can't be late past
+static void prv_arm(Scheduler *scheduler, uint32_t now) {
+    bool any = false;
+    uint32_t at = 0;
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        const Task *task = &scheduler->tasks[i];
+        if (!task->proc) continue;
+        uint32_t latest = task->due + task->slack;
+        if (!any || prv_after(at, latest)) at = latest;
+        any = true;
+    }
+
+    if (!any) {
+        if (scheduler->timer) app_timer_cancel(scheduler->timer);
+        scheduler->timer = NULL;
+        return;
+    }
+    if (scheduler->timer && scheduler->timer_at == at) return;
+
+    uint32_t delay = prv_after(at, now) ? at - now : 1;
+    scheduler->timer_at = at;
+    if (!scheduler->timer || !app_timer_reschedule(scheduler->timer, delay)) {
+        scheduler->timer = app_timer_register(delay, prv_timer_callback, scheduler);
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+Scheduler *scheduler_create(void) {
+    return calloc(1, sizeof(Scheduler));
+}
+
+void scheduler_destroy(Scheduler *scheduler) {
+    if (!scheduler) return;
+    if (scheduler->timer) app_timer_cancel(scheduler->timer);
+    free(scheduler);
+}
+
+int scheduler_add(Scheduler *scheduler, uint32_t period_ms, SchedulerPriority priority,
+                  SchedulerTaskProc proc, void *context) {
+    if (!scheduler || !proc || period_ms == 0) return -1;
+
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        Task *task = &scheduler->tasks[i];
+        if (task->proc) continue;
+
+        uint32_t now = prv_now_ms();
+        task->proc = proc;
+        task->context = context;
+        task->period = period_ms;
+        task->slack = priority == SCHEDULER_PRIORITY_LOW ? period_ms
+                    : priority == SCHEDULER_PRIORITY_NORMAL ? period_ms / 4 : 0;
+        task->due = now + period_ms;
+        prv_arm(scheduler, now);
+        return i;
+    }
+    return -1;
+}
+
+void scheduler_remove(Scheduler *scheduler, int task) {
+    if (!scheduler || task < 0 || task >= SCHEDULER_MAX_TASKS) return;
+    scheduler->tasks[task].proc = NULL;
+    prv_arm(scheduler, prv_now_ms());
+}
+
+void scheduler_service(Scheduler *scheduler) {
+    if (!scheduler) return;
+
+    uint32_t now = prv_now_ms();
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        Task *task = &scheduler->tasks[i];
+        if (!task->proc || prv_after(task->due, now)) continue;
+
+        // Keep the phase so tasks with related periods stay aligned; after
+        // a long gap run once and restart from now
+        task->due += task->period;
+        if (!prv_after(task->due, now)) task->due = now + task->period;
+        task->proc(task->context);
+    }
+    prv_arm(scheduler, now);
+}
+
+uint32_t scheduler_wakeups(const Scheduler *scheduler) {
+    return scheduler ? scheduler->wakeups : 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * Scheduler
+ *
+ * Cooperative periodic tasks (water decay, weather refresh, autosave) on
+ * one app_timer, riding along with wakeups the app gets anyway.
+ *
+ * Each task has a period and a priority. The priority is how late it may
+ * run: HIGH on time, NORMAL up to a quarter period, LOW up to a whole
+ * period. The timer is armed for the earliest "latest" deadline, and every
+ * wakeup runs all tasks that are due, so tasks that fall due close together
+ * share it.
+ *
+ * Call scheduler_service() from the animation frame and the tick handler
+ * too: due tasks run there and the scheduler's own timer is pushed back. A
+ * LOW task on a face that animates or ticks every minute never needs a
+ * wakeup of its own.
+ *
+ * Usage:
+ *     s_scheduler = scheduler_create();                                    // init
+ *     scheduler_add(s_scheduler, 60000, SCHEDULER_PRIORITY_LOW, decay_water, NULL);
+ *
+ *     static void animation_frame(void *context) {   // frame governor proc
+ *         ...
+ *         scheduler_service(s_scheduler);
+ *     }
+ *     static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+ *         update_time();
+ *         scheduler_service(s_scheduler);
+ *     }
+ *
+ *     scheduler_destroy(s_scheduler);                                      // deinit
+ *
+ * Tasks run to completion on the app's event loop; keep them short. A task
+ * that missed several periods (the app was suspended) runs once, not once
+ * per missed period; compute from elapsed time if that matters. Adding and
+ * removing tasks from inside a task is safe.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define SCHEDULER_MAX_TASKS 8
+
+typedef enum {
+    SCHEDULER_PRIORITY_HIGH,    // Run on the deadline
+    SCHEDULER_PRIORITY_NORMAL,  // Up to period / 4 late
+    SCHEDULER_PRIORITY_LOW,     // Up to a whole period late
+} SchedulerPriority;
+
+typedef void (*SchedulerTaskProc)(void *context);
+
+typedef struct Scheduler Scheduler;
+
+Scheduler *scheduler_create(void);
+void scheduler_destroy(Scheduler *scheduler);
+
+// First run one period from now. Returns a task id for scheduler_remove(),
+// or -1 when all SCHEDULER_MAX_TASKS slots are taken.
+int scheduler_add(Scheduler *scheduler, uint32_t period_ms, SchedulerPriority priority,
+                  SchedulerTaskProc proc, void *context);
+void scheduler_remove(Scheduler *scheduler, int task);
+
+// Runs the tasks that are due now and re-arms the timer. Call it from any
+// wakeup the app already has.
+void scheduler_service(Scheduler *scheduler);
+
+// Timer wakeups so far (tasks that ran from scheduler_service() calls elsewhere don't count)
+uint32_t scheduler_wakeups(const Scheduler *scheduler);
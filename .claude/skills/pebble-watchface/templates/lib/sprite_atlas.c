@@ -0,0 +1,54 @@
+/**
+ * Sprite Atlas - see sprite_atlas.h
+ */
+
+#include <pebble.h>
+#include "sprite_atlas.h"
+
+struct SpriteAtlas {
+    GBitmap *sheet;
+    const SpriteFrame *frames;
+    uint16_t count;
+};
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+SpriteAtlas *sprite_atlas_create(uint32_t resource_id, const SpriteFrame *frames, uint16_t count) {
+    SpriteAtlas *atlas = calloc(1, sizeof(SpriteAtlas));
+    if (!atlas) return NULL;
+
+    atlas->sheet = gbitmap_create_with_resource(resource_id);
+    if (!atlas->sheet) {
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Sprite atlas %lu not loaded, drawing vectors",
+                (unsigned long)resource_id);
+        free(atlas);
+        return NULL;
+    }
+    atlas->frames = frames;
+    atlas->count = count;
+    return atlas;
+}
+
+void sprite_atlas_destroy(SpriteAtlas *atlas) {
+    if (!atlas) return;
+    gbitmap_destroy(atlas->sheet);
+    free(atlas);
+}
+
+bool sprite_atlas_draw(SpriteAtlas *atlas, GContext *ctx, uint16_t index, GPoint anchor) {
+    if (!atlas || index >= atlas->count) return false;
+
+    const SpriteFrame *frame = &atlas->frames[index];
+    gbitmap_set_bounds(atlas->sheet, GRect(frame->x, frame->y, frame->w, frame->h));
+    graphics_context_set_compositing_mode(ctx, GCompOpSet);
+    graphics_draw_bitmap_in_rect(ctx, atlas->sheet, sprite_frame_rect(atlas->frames, index, anchor));
+    graphics_context_set_compositing_mode(ctx, GCompOpAssign);
+    return true;
+}
+
+GRect sprite_frame_rect(const SpriteFrame *frames, uint16_t index, GPoint anchor) {
+    const SpriteFrame *frame = &frames[index];
+    return GRect(anchor.x + frame->dx, anchor.y + frame->dy, frame->w, frame->h);
+}
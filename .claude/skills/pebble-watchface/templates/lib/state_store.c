@@ -0,0 +1,117 @@
+/**
+ * State Store - see state_store.h
+ */
+
+#include <pebble.h>
+#include "state_store.h"
+
+struct StateStore {
+    StateStoreConfig config;
+    void *data;
+    uint16_t size;
+    bool dirty;
+    AppTimer *timer;            // Pending write, NULL when clean
+    uint8_t *written;           // What flash holds, to skip no-op writes
+    bool written_valid;
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static bool prv_read(const StateStore *store, void *out) {
+    uint8_t blob[PERSIST_DATA_MAX_LENGTH];
+    int total = sizeof(StateStoreHeader) + store->size;
+    if (persist_read_data(store->config.key, blob, total) != total) return false;
+
+    StateStoreHeader header;
+    memcpy(&header, blob, sizeof(header));
+    if (header.version != store->config.version || header.size != store->size) return false;
+    memcpy(out, blob + sizeof(header), store->size);
+    return true;
+}
+
+static bool prv_write(const StateStore *store) {
+    uint8_t blob[PERSIST_DATA_MAX_LENGTH];
+    int total = sizeof(StateStoreHeader) + store->size;
+
+    StateStoreHeader header = { .version = store->config.version, .size = store->size };
+    memcpy(blob, &header, sizeof(header));
+    memcpy(blob + sizeof(header), store->data, store->size);
+    return persist_write_data(store->config.key, blob, total) == total;
+}
+
+static void prv_timer_callback(void *context) {
+    StateStore *store = context;
+    store->timer = NULL;
+    state_store_flush(store);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+StateStore *state_store_create(const StateStoreConfig *config, void *data, uint16_t size) {
+    if (!data || size > STATE_STORE_MAX_SIZE) return NULL;
+    StateStore *store = calloc(1, sizeof(StateStore));
+    if (!store) return NULL;
+
+    store->written = malloc(size);
+    if (!store->written) {
+        free(store);
+        return NULL;
+    }
+    store->config = *config;
+    store->data = data;
+    store->size = size;
+    return store;
+}
+
+void state_store_destroy(StateStore *store) {
+    if (!store) return;
+    state_store_flush(store);
+    if (store->timer) app_timer_cancel(store->timer);  // Re-armed by a failed write
+    free(store->written);
+    free(store);
+}
+
+bool state_store_load(StateStore *store) {
+    if (!store) return false;
+    if (!prv_read(store, store->written)) return false;
+    memcpy(store->data, store->written, store->size);
+    store->written_valid = true;
+    return true;
+}
+
+void state_store_mark_dirty(StateStore *store) {
+    if (!store) return;
+    store->dirty = true;
+    if (!store->timer) {
+        store->timer = app_timer_register(store->config.interval_ms, prv_timer_callback, store);
+    }
+}
+
+bool state_store_flush(StateStore *store) {
+    if (!store || !store->dirty) return false;
+    store->dirty = false;
+    if (store->timer) {
+        app_timer_cancel(store->timer);
+        store->timer = NULL;
+    }
+
+    if (store->written_valid && memcmp(store->written, store->data, store->size) == 0) {
+        return false;
+    }
+    if (!prv_write(store)) {
+        state_store_mark_dirty(store);  // Flash full or busy: try again later
+        return false;
+    }
+    memcpy(store->written, store->data, store->size);
+    store->written_valid = true;
+    if (store->config.did_write) store->config.did_write(store->data);
+    return true;
+}
+
+bool state_store_is_dirty(const StateStore *store) {
+    return store && store->dirty;
+}
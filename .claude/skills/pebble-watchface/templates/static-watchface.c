@@ -9,6 +9,7 @@
  */
 
 #include <pebble.h>
+#include "lib/round_mask.h"
 
 // ============================================================================
 // CONFIGURATION
@@ -268,8 +269,8 @@ static void main_window_load(Window *window) {
     text_layer_set_text_alignment(s_date_layer, GTextAlignmentCenter);
     layer_add_child(window_layer, text_layer_get_layer(s_date_layer));
 
-    // Battery layer
-    GRect battery_frame = {{bounds.size.w - 27, 5}, {22, 8}};
+    // Battery layer (pulled in from the masked-off corner on round)
+    GRect battery_frame = round_mask_fit_rect(bounds, GRect(bounds.size.w - 27, 5, 22, 8));
     s_battery_layer = layer_create(battery_frame);
     layer_set_update_proc(s_battery_layer, battery_update_proc);
     layer_add_child(window_layer, s_battery_layer);
@@ -0,0 +1,165 @@
+/**
+ * Cull - see cull.h
+ */
+
+#include <pebble.h>
+#include "cull.h"
+
+typedef enum {
+    OCCLUDER_RECT,
+    OCCLUDER_CIRCLE,
+    OCCLUDER_STROKE,
+} OccluderKind;
+
+typedef struct {
+    OccluderKind kind;
+    GPoint a;                   // Rect origin, circle center, stroke start
+    GPoint b;                   // Rect far corner (inclusive), stroke end
+    int32_t radius_sq;          // Circle and stroke: inner radius squared
+} Occluder;
+
+struct Cull {
+    GRect screen;
+    uint8_t max_occluders;
+    uint8_t num_occluders;
+    Occluder occluders[];
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+#if defined(PBL_ROUND)
+static int32_t prv_clamp(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+#endif
+
+static Occluder *prv_next(Cull *cull) {
+    if (!cull || cull->num_occluders >= cull->max_occluders) return NULL;
+    return &cull->occluders[cull->num_occluders++];
+}
+
+// Squared distance from p to the segment a-b
+static int32_t prv_segment_dist_sq(GPoint p, GPoint a, GPoint b) {
+    int32_t abx = b.x - a.x, aby = b.y - a.y;
+    int32_t apx = p.x - a.x, apy = p.y - a.y;
+    int32_t ap_sq = apx * apx + apy * apy;
+    int32_t dot = apx * abx + apy * aby;
+    if (dot <= 0) return ap_sq;
+
+    int32_t ab_sq = abx * abx + aby * aby;
+    if (dot >= ab_sq) {
+        int32_t bpx = p.x - b.x, bpy = p.y - b.y;
+        return bpx * bpx + bpy * bpy;
+    }
+    return ap_sq - (int32_t)((int64_t)dot * dot / ab_sq);
+}
+
+static bool prv_covers(const Occluder *o, GPoint p) {
+    switch (o->kind) {
+        case OCCLUDER_RECT:
+            return p.x >= o->a.x && p.x <= o->b.x && p.y >= o->a.y && p.y <= o->b.y;
+        case OCCLUDER_CIRCLE: {
+            int32_t dx = p.x - o->a.x, dy = p.y - o->a.y;
+            return dx * dx + dy * dy <= o->radius_sq;
+        }
+        case OCCLUDER_STROKE:
+            return prv_segment_dist_sq(p, o->a, o->b) <= o->radius_sq;
+    }
+    return false;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+Cull *cull_create(GRect screen, uint8_t max_occluders) {
+    Cull *cull = malloc(sizeof(Cull) + max_occluders * sizeof(Occluder));
+    if (!cull) return NULL;
+    cull->screen = screen;
+    cull->max_occluders = max_occluders;
+    cull->num_occluders = 0;
+    return cull;
+}
+
+void cull_destroy(Cull *cull) {
+    free(cull);
+}
+
+void cull_set_screen(Cull *cull, GRect screen) {
+    if (cull) cull->screen = screen;
+}
+
+void cull_clear(Cull *cull) {
+    if (cull) cull->num_occluders = 0;
+}
+
+void cull_add_rect(Cull *cull, GRect rect) {
+    if (rect.size.w <= 0 || rect.size.h <= 0) return;
+    Occluder *o = prv_next(cull);
+    if (!o) return;
+    // A filled rect covers exactly its pixels; no rounding margin needed
+    *o = (Occluder) {
+        .kind = OCCLUDER_RECT,
+        .a = rect.origin,
+        .b = GPoint(rect.origin.x + rect.size.w - 1, rect.origin.y + rect.size.h - 1),
+    };
+}
+
+void cull_add_circle(Cull *cull, GPoint center, uint16_t radius) {
+    if (radius < 2) return;
+    Occluder *o = prv_next(cull);
+    if (!o) return;
+    int32_t inner = radius - 1;
+    *o = (Occluder) { .kind = OCCLUDER_CIRCLE, .a = center, .radius_sq = inner * inner };
+}
+
+void cull_add_stroke(Cull *cull, GPoint from, GPoint to, uint8_t width) {
+    if (width < 4) return;
+    Occluder *o = prv_next(cull);
+    if (!o) return;
+    int32_t inner = width / 2 - 1;
+    *o = (Occluder) { .kind = OCCLUDER_STROKE, .a = from, .b = to, .radius_sq = inner * inner };
+}
+
+bool cull_on_screen(const Cull *cull, GRect bbox) {
+    if (bbox.size.w <= 0 || bbox.size.h <= 0) return false;
+    if (!cull) return true;
+    const GRect *s = &cull->screen;
+    if (!(bbox.origin.x < s->origin.x + s->size.w && s->origin.x < bbox.origin.x + bbox.size.w &&
+          bbox.origin.y < s->origin.y + s->size.h && s->origin.y < bbox.origin.y + bbox.size.h)) {
+        return false;
+    }
+#if defined(PBL_ROUND)
+    // Round displays show the circle inscribed in the screen; test the
+    // bbox pixel nearest its center, with a pixel of slack
+    int32_t cx = s->origin.x + s->size.w / 2, cy = s->origin.y + s->size.h / 2;
+    int32_t nx = prv_clamp(cx, bbox.origin.x, bbox.origin.x + bbox.size.w - 1);
+    int32_t ny = prv_clamp(cy, bbox.origin.y, bbox.origin.y + bbox.size.h - 1);
+    int32_t r = (s->size.w < s->size.h ? s->size.w : s->size.h) / 2 + 1;
+    return (nx - cx) * (nx - cx) + (ny - cy) * (ny - cy) <= r * r;
+#else
+    return true;
+#endif
+}
+
+bool cull_visible(const Cull *cull, GRect bbox) {
+    if (!cull_on_screen(cull, bbox)) return false;
+    if (!cull) return true;
+
+    GPoint corners[4] = {
+        bbox.origin,
+        GPoint(bbox.origin.x + bbox.size.w - 1, bbox.origin.y),
+        GPoint(bbox.origin.x, bbox.origin.y + bbox.size.h - 1),
+        GPoint(bbox.origin.x + bbox.size.w - 1, bbox.origin.y + bbox.size.h - 1),
+    };
+    for (int i = 0; i < cull->num_occluders; i++) {
+        const Occluder *o = &cull->occluders[i];
+        if (prv_covers(o, corners[0]) && prv_covers(o, corners[1]) &&
+            prv_covers(o, corners[2]) && prv_covers(o, corners[3])) {
+            return false;
+        }
+    }
+    return true;
+}
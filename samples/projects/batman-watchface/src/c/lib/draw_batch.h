@@ -0,0 +1,53 @@
+/**
+ * Draw Batch
+ *
+ * A per-frame command list for small primitives. Draw code queues rects,
+ * circles, lines and pixels with their color instead of setting context
+ * state before each one; draw_batch_flush() sorts the list by color and
+ * stroke width and draws it with one state change per group. Helps when a
+ * loop alternates colors (stars, sparks, multi-part sprites).
+ *
+ *     s_batch = draw_batch_create(64);                      // window load
+ *
+ *     draw_batch_begin(s_batch, ctx);                       // update proc
+ *     for (...) draw_batch_pixel(s_batch, star->pos, star_color);
+ *     draw_batch_flush(s_batch);
+ *
+ *     draw_batch_destroy(s_batch);                          // window unload
+ *
+ * Sorting throws away draw order within a layer. Where overlap matters,
+ * raise the layer before queuing what goes on top; layers always draw in
+ * increasing order, and queued order is kept within a group:
+ *
+ *     draw_batch_set_layer(s_batch, 0);   // bodies
+ *     draw_batch_set_layer(s_batch, 1);   // faces over bodies
+ *
+ * The list is preallocated, so queuing never allocates. When it fills up
+ * the queued commands are flushed early (correct, just less batched).
+ * Context colors and stroke width are left as the last group set them.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+typedef struct DrawBatch DrawBatch;
+
+// Capacity is the most commands per flush, up to 255
+DrawBatch *draw_batch_create(uint8_t capacity);
+void draw_batch_destroy(DrawBatch *batch);
+
+// Clears the list and sets the context to draw into; layer resets to 0
+void draw_batch_begin(DrawBatch *batch, GContext *ctx);
+void draw_batch_set_layer(DrawBatch *batch, uint8_t layer);
+
+// Rounded rects use GCornersAll
+void draw_batch_fill_rect(DrawBatch *batch, GRect rect, uint8_t corner_radius, GColor color);
+void draw_batch_fill_circle(DrawBatch *batch, GPoint center, uint16_t radius, GColor color);
+void draw_batch_draw_circle(DrawBatch *batch, GPoint center, uint16_t radius, GColor color,
+                            uint8_t stroke_width);
+void draw_batch_line(DrawBatch *batch, GPoint p0, GPoint p1, GColor color, uint8_t stroke_width);
+void draw_batch_pixel(DrawBatch *batch, GPoint point, GColor color);
+
+// Draws everything queued since draw_batch_begin() and empties the list
+void draw_batch_flush(DrawBatch *batch);
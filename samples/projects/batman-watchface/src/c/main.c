@@ -1,13 +1,19 @@
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/cull.h"
+#include "lib/draw_batch.h"
+#include "lib/frame_governor.h"
+#include "lib/path_pool.h"
+#include "lib/round_mask.h"
 
 // ============================================================================
 // BATMAN/BAT SIGNAL WATCHFACE
 // Animated searchlight sweeping across Gotham's night sky
 // ============================================================================
 
-// Animation timing
+// Animation timing (frame governor doubles the interval on low battery)
 #define ANIMATION_INTERVAL 50
-#define ANIMATION_INTERVAL_LOW_POWER 100
+#define MAX_INTERVAL 250
 #define LOW_BATTERY_THRESHOLD 20
 
 // Searchlight parameters
@@ -15,6 +21,12 @@
 #define BEAM_SWEEP_RIGHT_DEG 55
 #define BEAM_SPEED 250
 
+// Beam stroke widths, outermost first (see draw_searchlight_beam)
+#define BEAM_WIDTH_GLOW 35
+#define BEAM_WIDTH_MID 20
+#define BEAM_WIDTH_CORE 8
+#define BEAM_WIDTH_BW 25
+
 // Bat symbol
 #define BAT_SIZE 22
 
@@ -57,7 +69,8 @@ static Window *s_main_window;
 static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
-static AppTimer *s_animation_timer;
+static FrameGovernor *s_governor;  // Owns the animation timer
+static BgCache *s_bg_cache;  // Sky behind the beam, skyline in front of it
 
 static SearchlightState s_searchlight;
 static BatSymbolState s_bat_symbol;
@@ -65,7 +78,7 @@ static Star s_stars[MAX_STARS];
 
 static int s_battery_level = 100;
 static bool s_is_charging = false;
-static int s_animation_interval = ANIMATION_INTERVAL;
+static GPoint s_battery_pos;  // Top right, pulled inside the circle on round
 
 // Screen dimensions
 static int16_t s_screen_width;
@@ -77,32 +90,59 @@ static int16_t s_skyline_top;
 static char s_time_buffer[8];
 static char s_date_buffer[16];
 
-// Bat symbol GPath - Classic Batman logo shape (larger, cleaner)
-static GPath *s_bat_path = NULL;
-static GPoint s_bat_points[] = {
-    // Start at top center, go clockwise
-    {0, -6},       // Top of head
-    {5, -14},      // Right ear tip
-    {6, -4},       // Right ear base
-    {12, -2},      // Right inner wing
-    {30, -8},      // Right wing tip (far out and up)
-    {22, 2},       // Right wing curve in
-    {26, 8},       // Right wing lower point
-    {16, 6},       // Right wing scallop
-    {10, 14},      // Right wing bottom
-    {0, 8},        // Bottom center tail
-    {-10, 14},     // Left wing bottom
-    {-16, 6},      // Left wing scallop
-    {-26, 8},      // Left wing lower point
-    {-22, 2},      // Left wing curve in
-    {-30, -8},     // Left wing tip (far out and up)
-    {-12, -2},     // Left inner wing
-    {-6, -4},      // Left ear base
-    {-5, -14},     // Left ear tip
+// Stars are queued and drawn grouped by color (up to 5 pixels each)
+static DrawBatch *s_star_batch = NULL;
+#define STAR_BATCH_SIZE (MAX_STARS * 5)
+
+// Stars the beam, the bat glow or the skyline will paint over are skipped
+static Cull *s_cull = NULL;
+#define MAX_OCCLUDERS 16
+
+// Gotham skyline: x_start, x_end, height above the skyline top (144px wide,
+// stretched on round)
+typedef struct { int16_t x1, x2, h; } Building;
+static const Building BUILDINGS[] = {
+    {0, 12, 8},       // Left building
+    {10, 22, 25},     // Tall tower 1
+    {20, 32, 15},     // Medium building
+    {30, 45, 35},     // Wayne Tower (tallest)
+    {43, 55, 20},     // Building 4
+    {53, 62, 12},     // Small building
+    {60, 75, 28},     // Tall building (signal building)
+    {73, 82, 8},      // Small
+    {80, 95, 22},     // Building 6
+    {93, 108, 18},    // Building 7
+    {106, 120, 30},   // Another tall one
+    {118, 132, 14},   // Building 8
+    {130, 144, 10}    // Right edge
 };
-static GPathInfo s_bat_path_info = {
-    .num_points = 18,
-    .points = s_bat_points
+
+// Bat symbol - 20-point Arkham-style logo around its center, created once
+static PathPool *s_paths = NULL;
+enum { PATH_BAT_LOGO, NUM_PATHS };
+static const GPoint BAT_LOGO_POINTS[] = {
+    // LEFT WING - tip is LOWEST, curves UP to shoulder peak
+    {-55, 9},      // 0: Left wing TIP (lowest, angled down-left)
+    {-48, 2},      // 1: Left wing lower curve
+    {-40, -4},     // 2: Left wing mid curve
+    {-30, -9},     // 3: Left shoulder peak (HIGHEST wing point)
+    {-20, -6},     // 4: Inner wing
+    {-10, -7},     // 5: Left of head
+    {-5, -18},     // 6: Left ear tip
+    {0, -8},       // 7: Between ears (dip)
+    {5, -18},      // 8: Right ear tip
+    {10, -7},      // 9: Right of head
+    {20, -6},      // 10: Inner wing
+    {30, -9},      // 11: Right shoulder peak (HIGHEST wing point)
+    {40, -4},      // 12: Right wing mid curve
+    {48, 2},       // 13: Right wing lower curve
+    {55, 9},       // 14: Right wing TIP (lowest, angled down-right)
+    // BOTTOM EDGE - shallow inward curve
+    {32, 5},       // 15: Right lower scallop
+    {15, 2},       // 16: Right inner
+    {0, 5},        // 17: Bottom center (shallow)
+    {-15, 2},      // 18: Left inner
+    {-32, 5},      // 19: Left lower scallop
 };
 
 // ============================================================================
@@ -272,59 +312,90 @@ static void draw_sky(GContext *ctx, GRect bounds) {
     #endif
 }
 
+static GRect star_bbox(const Star *star) {
+    if (star->brightness >= 3) return GRect(star->pos.x - 1, star->pos.y - 1, 3, 3);
+    return GRect(star->pos.x, star->pos.y, 1, 1);
+}
+
 static void draw_stars(GContext *ctx) {
+    draw_batch_begin(s_star_batch, ctx);
     for (int i = 0; i < MAX_STARS; i++) {
-        if (s_stars[i].brightness > 0) {
+        if (s_stars[i].brightness > 0 && cull_visible(s_cull, star_bbox(&s_stars[i]))) {
             #ifdef PBL_COLOR
             GColor star_color = (s_stars[i].brightness >= 2) ? COLOR_STAR : COLOR_STAR_DIM;
             #else
             GColor star_color = COLOR_STAR;
             #endif
 
-            graphics_context_set_stroke_color(ctx, star_color);
-            graphics_draw_pixel(ctx, s_stars[i].pos);
+            GPoint pos = s_stars[i].pos;
+            draw_batch_pixel(s_star_batch, pos, star_color);
 
             if (s_stars[i].brightness >= 3) {
-                graphics_draw_pixel(ctx, GPoint(s_stars[i].pos.x - 1, s_stars[i].pos.y));
-                graphics_draw_pixel(ctx, GPoint(s_stars[i].pos.x + 1, s_stars[i].pos.y));
-                graphics_draw_pixel(ctx, GPoint(s_stars[i].pos.x, s_stars[i].pos.y - 1));
-                graphics_draw_pixel(ctx, GPoint(s_stars[i].pos.x, s_stars[i].pos.y + 1));
+                draw_batch_pixel(s_star_batch, GPoint(pos.x - 1, pos.y), star_color);
+                draw_batch_pixel(s_star_batch, GPoint(pos.x + 1, pos.y), star_color);
+                draw_batch_pixel(s_star_batch, GPoint(pos.x, pos.y - 1), star_color);
+                draw_batch_pixel(s_star_batch, GPoint(pos.x, pos.y + 1), star_color);
             }
         }
     }
+    draw_batch_flush(s_star_batch);
 }
 
-static void draw_searchlight_beam(GContext *ctx) {
-    GPoint origin = GPoint(s_center_x, s_screen_height + 30);
-    int beam_length = s_screen_height + 50;
+static GPoint beam_origin(void) {
+    return GPoint(s_center_x, s_screen_height + 30);
+}
 
-    // Calculate beam direction
+static GPoint beam_end(void) {
+    GPoint origin = beam_origin();
+    int beam_length = s_screen_height + 50;
     int16_t dx = (sin_lookup(s_searchlight.beam_angle) * beam_length) / TRIG_MAX_RATIO;
     int16_t dy = -(cos_lookup(s_searchlight.beam_angle) * beam_length) / TRIG_MAX_RATIO;
+    return GPoint(origin.x + dx, origin.y + dy);
+}
 
-    GPoint beam_end = GPoint(origin.x + dx, origin.y + dy);
+// Frames running long (or low battery): one plain stroke, no glow or texture
+static bool beam_is_plain(void) {
+    return frame_governor_lod(s_governor) != FRAME_GOVERNOR_LOD_FULL;
+}
+
+// Width of the beam's outermost (opaque) stroke this frame
+static uint8_t beam_cover_width(void) {
+    if (beam_is_plain()) return PBL_IF_COLOR_ELSE(BEAM_WIDTH_MID, BEAM_WIDTH_BW);
+    return PBL_IF_COLOR_ELSE(BEAM_WIDTH_GLOW, BEAM_WIDTH_BW);
+}
+
+static void draw_searchlight_beam(GContext *ctx) {
+    GPoint origin = beam_origin();
+    GPoint beam_end_pt = beam_end();
+
+    if (beam_is_plain()) {
+        graphics_context_set_stroke_color(ctx, PBL_IF_COLOR_ELSE(COLOR_BEAM_MID, COLOR_BEAM_BRIGHT));
+        graphics_context_set_stroke_width(ctx, beam_cover_width());
+        graphics_draw_line(ctx, origin, beam_end_pt);
+        return;
+    }
 
     // Draw beam with varying widths for glow effect
     #ifdef PBL_COLOR
     // Outer glow (widest, dimmest)
     graphics_context_set_stroke_color(ctx, COLOR_BEAM_DIM);
-    graphics_context_set_stroke_width(ctx, 35);
-    graphics_draw_line(ctx, origin, beam_end);
+    graphics_context_set_stroke_width(ctx, BEAM_WIDTH_GLOW);
+    graphics_draw_line(ctx, origin, beam_end_pt);
 
     // Middle beam
     graphics_context_set_stroke_color(ctx, COLOR_BEAM_MID);
-    graphics_context_set_stroke_width(ctx, 20);
-    graphics_draw_line(ctx, origin, beam_end);
+    graphics_context_set_stroke_width(ctx, BEAM_WIDTH_MID);
+    graphics_draw_line(ctx, origin, beam_end_pt);
 
     // Core beam (brightest)
     graphics_context_set_stroke_color(ctx, COLOR_BEAM_BRIGHT);
-    graphics_context_set_stroke_width(ctx, 8);
-    graphics_draw_line(ctx, origin, beam_end);
+    graphics_context_set_stroke_width(ctx, BEAM_WIDTH_CORE);
+    graphics_draw_line(ctx, origin, beam_end_pt);
     #else
     // B&W: Simple beam with lines for texture
     graphics_context_set_stroke_color(ctx, COLOR_BEAM_BRIGHT);
-    graphics_context_set_stroke_width(ctx, 25);
-    graphics_draw_line(ctx, origin, beam_end);
+    graphics_context_set_stroke_width(ctx, BEAM_WIDTH_BW);
+    graphics_draw_line(ctx, origin, beam_end_pt);
 
     // Add dark stripes for texture
     graphics_context_set_stroke_color(ctx, GColorBlack);
@@ -336,7 +407,7 @@ static void draw_searchlight_beam(GContext *ctx) {
         int16_t oy = -(cos_lookup(perp_angle) * offset) / TRIG_MAX_RATIO;
         graphics_draw_line(ctx,
             GPoint(origin.x + ox, origin.y + oy),
-            GPoint(beam_end.x + ox, beam_end.y + oy));
+            GPoint(beam_end_pt.x + ox, beam_end_pt.y + oy));
     }
     #endif
 }
@@ -346,9 +417,6 @@ static void draw_bat_symbol(GContext *ctx) {
         return;
     }
 
-    int cx = s_bat_symbol.center.x;
-    int cy = s_bat_symbol.center.y;
-
     // Draw glow circle
     if (s_bat_symbol.glow_radius > 0) {
         #ifdef PBL_COLOR
@@ -366,82 +434,35 @@ static void draw_bat_symbol(GContext *ctx) {
 
     // Draw SLEEK MODERN BATMAN LOGO - Arkham style
     graphics_context_set_fill_color(ctx, COLOR_BAT_SYMBOL);
+    path_pool_fill(s_paths, ctx, PATH_BAT_LOGO, s_bat_symbol.center, 0);
+}
 
-    // 20-point Batman logo - smooth wing curves, proper proportions
-    GPoint bat_logo[] = {
-        // LEFT WING - tip is LOWEST, curves UP to shoulder peak
-        {cx - 55, cy + 9},     // 0: Left wing TIP (lowest, angled down-left)
-        {cx - 48, cy + 2},     // 1: Left wing lower curve
-        {cx - 40, cy - 4},     // 2: Left wing mid curve
-        {cx - 30, cy - 9},     // 3: Left shoulder peak (HIGHEST wing point)
-        {cx - 20, cy - 6},     // 4: Inner wing
-        {cx - 10, cy - 7},     // 5: Left of head
-        {cx - 5,  cy - 18},    // 6: Left ear tip
-        {cx,      cy - 8},     // 7: Between ears (dip)
-        {cx + 5,  cy - 18},    // 8: Right ear tip
-        {cx + 10, cy - 7},     // 9: Right of head
-        {cx + 20, cy - 6},     // 10: Inner wing
-        {cx + 30, cy - 9},     // 11: Right shoulder peak (HIGHEST wing point)
-        {cx + 40, cy - 4},     // 12: Right wing mid curve
-        {cx + 48, cy + 2},     // 13: Right wing lower curve
-        {cx + 55, cy + 9},     // 14: Right wing TIP (lowest, angled down-right)
-        // BOTTOM EDGE - shallow inward curve
-        {cx + 32, cy + 5},     // 15: Right lower scallop
-        {cx + 15, cy + 2},     // 16: Right inner
-        {cx,      cy + 5},     // 17: Bottom center (shallow)
-        {cx - 15, cy + 2},     // 18: Left inner
-        {cx - 32, cy + 5},     // 19: Left lower scallop
-    };
-
-    GPathInfo bat_info = { .num_points = 20, .points = bat_logo };
-    GPath *bat = gpath_create(&bat_info);
-    gpath_draw_filled(ctx, bat);
-    gpath_destroy(bat);
+// Screen rect of BUILDINGS[i], down into the ground
+static GRect building_rect(int i) {
+    // Scale buildings for round display
+    #ifdef PBL_ROUND
+    float scale_x = (float)s_screen_width / 144.0f;
+    int16_t x1 = (int16_t)(BUILDINGS[i].x1 * scale_x);
+    int16_t x2 = (int16_t)(BUILDINGS[i].x2 * scale_x);
+    #else
+    int16_t x1 = BUILDINGS[i].x1;
+    int16_t x2 = BUILDINGS[i].x2;
+    #endif
+    return GRect(x1, s_skyline_top - BUILDINGS[i].h, x2 - x1, BUILDINGS[i].h + 50);
 }
 
 static void draw_skyline(GContext *ctx) {
     // Gotham skyline silhouette
     int sy = s_skyline_top;
 
-    // Building definitions: x_start, x_end, height_above_skyline_top
-    struct { int16_t x1, x2, h; } buildings[] = {
-        {0, 12, 8},       // Left building
-        {10, 22, 25},     // Tall tower 1
-        {20, 32, 15},     // Medium building
-        {30, 45, 35},     // Wayne Tower (tallest)
-        {43, 55, 20},     // Building 4
-        {53, 62, 12},     // Small building
-        {60, 75, 28},     // Tall building (signal building)
-        {73, 82, 8},      // Small
-        {80, 95, 22},     // Building 6
-        {93, 108, 18},    // Building 7
-        {106, 120, 30},   // Another tall one
-        {118, 132, 14},   // Building 8
-        {130, 144, 10}    // Right edge
-    };
-
-    int num_buildings = sizeof(buildings) / sizeof(buildings[0]);
-
-    // Scale buildings for round display
     #ifdef PBL_ROUND
     float scale_x = (float)s_screen_width / 144.0f;
     #endif
 
     // Draw building silhouettes
     graphics_context_set_fill_color(ctx, COLOR_SKYLINE);
-
-    for (int i = 0; i < num_buildings; i++) {
-        #ifdef PBL_ROUND
-        int16_t x1 = (int16_t)(buildings[i].x1 * scale_x);
-        int16_t x2 = (int16_t)(buildings[i].x2 * scale_x);
-        #else
-        int16_t x1 = buildings[i].x1;
-        int16_t x2 = buildings[i].x2;
-        #endif
-
-        GRect building = GRect(x1, sy - buildings[i].h,
-                               x2 - x1, buildings[i].h + 50);
-        graphics_fill_rect(ctx, building, 0, GCornerNone);
+    for (int i = 0; i < (int)ARRAY_LENGTH(BUILDINGS); i++) {
+        graphics_fill_rect(ctx, building_rect(i), 0, GCornerNone);
     }
 
     // Ground fill
@@ -494,9 +515,8 @@ static void draw_skyline(GContext *ctx) {
 }
 
 static void draw_battery(GContext *ctx) {
-    // Battery indicator in top-right
-    int bx = s_screen_width - 26;
-    int by = 6;
+    int bx = s_battery_pos.x;
+    int by = s_battery_pos.y;
 
     // Battery outline
     graphics_context_set_stroke_color(ctx, COLOR_TIME);
@@ -528,17 +548,36 @@ static void draw_battery(GContext *ctx) {
     }
 }
 
+// Cached scenery (see bg_cache). The skyline is an overlay so the beam and
+// bat symbol still pass behind it.
+static void draw_scenery(GContext *ctx, GRect bounds) {
+    draw_sky(ctx, bounds);
+}
+
+static void draw_scenery_front(GContext *ctx, GRect bounds) {
+    draw_skyline(ctx);
+}
+
 // ============================================================================
 // CANVAS UPDATE
 // ============================================================================
 
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
     GRect bounds = layer_get_bounds(layer);
+    frame_governor_render_begin(s_governor);
 
-    // 1. Draw night sky
-    draw_sky(ctx, bounds);
+    // 1. Draw night sky (cached)
+    bg_cache_draw(s_bg_cache, ctx, bounds);
 
-    // 2. Draw stars
+    // 2. Draw stars, minus those the next three steps paint over
+    cull_clear(s_cull);
+    cull_add_stroke(s_cull, beam_origin(), beam_end(), beam_cover_width());
+    if (s_bat_symbol.glow_radius > 0) {
+        cull_add_circle(s_cull, s_bat_symbol.center, PBL_IF_COLOR_ELSE(45, 35) + s_bat_symbol.glow_radius);
+    }
+    for (int i = 0; i < (int)ARRAY_LENGTH(BUILDINGS); i++) {
+        cull_add_rect(s_cull, building_rect(i));
+    }
     draw_stars(ctx);
 
     // 3. Draw searchlight beam (behind bat and skyline)
@@ -547,18 +586,28 @@ static void canvas_update_proc(Layer *layer, GContext *ctx) {
     // 4. Draw bat symbol
     draw_bat_symbol(ctx);
 
-    // 5. Draw Gotham skyline (in front of beam)
-    draw_skyline(ctx);
+    // 5. Draw Gotham skyline (in front of beam, cached)
+    bg_cache_draw_overlay(s_bg_cache, ctx);
 
     // 6. Draw battery indicator
     draw_battery(ctx);
+
+    frame_governor_render_end(s_governor);
 }
 
 // ============================================================================
 // ANIMATION TIMER
 // ============================================================================
 
-static void animation_timer_callback(void *data) {
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+    .interval_ms = ANIMATION_INTERVAL,
+    .idle_interval_ms = ANIMATION_INTERVAL,  // The beam never rests
+    .max_interval_ms = MAX_INTERVAL,
+    .low_battery_percent = LOW_BATTERY_THRESHOLD,
+};
+
+// Called by the frame governor, which schedules the next frame
+static void animation_frame(void *context) {
     // Update all animated elements
     update_searchlight();
     update_bat_symbol();
@@ -568,9 +617,6 @@ static void animation_timer_callback(void *data) {
     if (s_canvas_layer) {
         layer_mark_dirty(s_canvas_layer);
     }
-
-    // Schedule next frame
-    s_animation_timer = app_timer_register(s_animation_interval, animation_timer_callback, NULL);
 }
 
 // ============================================================================
@@ -593,18 +639,25 @@ static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
     // Update date
     strftime(s_date_buffer, sizeof(s_date_buffer), "%a, %b %d", tick_time);
     text_layer_set_text(s_date_layer, s_date_buffer);
+
+    bg_cache_invalidate(s_bg_cache);
 }
 
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_did_change(void *context) {
+    bg_cache_invalidate(s_bg_cache);
+    if (s_canvas_layer) {
+        layer_mark_dirty(s_canvas_layer);
+    }
+}
+#endif
+
 static void battery_handler(BatteryChargeState charge) {
     s_battery_level = charge.charge_percent;
     s_is_charging = charge.is_charging;
 
     // Adjust animation speed based on battery
-    if (s_battery_level <= LOW_BATTERY_THRESHOLD && !s_is_charging) {
-        s_animation_interval = ANIMATION_INTERVAL_LOW_POWER;
-    } else {
-        s_animation_interval = ANIMATION_INTERVAL;
-    }
+    frame_governor_set_battery(s_governor, charge);
 }
 
 // ============================================================================
@@ -631,8 +684,23 @@ static void window_load(Window *window) {
     layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
 
-    // Create bat path
-    s_bat_path = gpath_create(&s_bat_path_info);
+    // Static scenery cache; tallest building is 35px above the skyline top
+    s_bg_cache = bg_cache_create(draw_scenery);
+    bg_cache_set_overlay(s_bg_cache,
+                         GRect(0, s_skyline_top - 36, s_screen_width, s_screen_height - s_skyline_top + 36),
+                         draw_scenery_front);
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+        .did_change = unobstructed_did_change
+    }, NULL);
+    #endif
+
+    // Create paths and the star batch
+    s_paths = path_pool_create(NUM_PATHS);
+    path_pool_add(s_paths, BAT_LOGO_POINTS, ARRAY_LENGTH(BAT_LOGO_POINTS));
+    s_star_batch = draw_batch_create(STAR_BATCH_SIZE);
+    s_cull = cull_create(bounds, MAX_OCCLUDERS);
+    s_battery_pos = round_mask_fit_rect(bounds, GRect(s_screen_width - 26, 6, 22, 10)).origin;
 
     // Time layer
     #ifdef PBL_ROUND
@@ -666,6 +734,7 @@ static void window_load(Window *window) {
     init_stars();
 
     // Get initial battery state
+    s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
     battery_handler(battery_state_service_peek());
 
     // Update time immediately
@@ -674,20 +743,38 @@ static void window_load(Window *window) {
     tick_handler(tick_time, MINUTE_UNIT);
 
     // Start animation timer
-    s_animation_timer = app_timer_register(s_animation_interval, animation_timer_callback, NULL);
+    frame_governor_run(s_governor, true);
 }
 
 static void window_unload(Window *window) {
-    // Cancel timer
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
+    // Stop animation timer
+    if (s_governor) {
+        frame_governor_destroy(s_governor);
+        s_governor = NULL;
+    }
+
+    // Destroy paths and the star batch
+    if (s_paths) {
+        path_pool_destroy(s_paths);
+        s_paths = NULL;
     }
+    if (s_star_batch) {
+        draw_batch_destroy(s_star_batch);
+        s_star_batch = NULL;
+    }
+    if (s_cull) {
+        cull_destroy(s_cull);
+        s_cull = NULL;
+    }
+
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+    #endif
 
-    // Destroy paths
-    if (s_bat_path) {
-        gpath_destroy(s_bat_path);
-        s_bat_path = NULL;
+    // Destroy background cache
+    if (s_bg_cache) {
+        bg_cache_destroy(s_bg_cache);
+        s_bg_cache = NULL;
     }
 
     // Destroy layers
@@ -0,0 +1,193 @@
+/**
+ * Dirty Tracker - see dirty_tracker.h
+ */
+
+#include <pebble.h>
+#include "dirty_tracker.h"
+
+struct DirtyTracker {
+    Layer *parent;
+    Layer *clips[DIRTY_TRACKER_MAX_RECTS];
+
+    GRect rects[DIRTY_TRACKER_MAX_RECTS];  // This frame's dirty area
+    uint8_t num_rects;
+    bool full;
+
+    uint16_t num_entities;
+    GRect boxes[];                         // prev[0..n), cur[n..2n)
+};
+
+// ============================================================================
+// RECT HELPERS
+// ============================================================================
+
+static bool prv_is_empty(GRect r) {
+    return r.size.w <= 0 || r.size.h <= 0;
+}
+
+static int32_t prv_area(GRect r) {
+    return (int32_t)r.size.w * r.size.h;
+}
+
+static GRect prv_union(GRect a, GRect b) {
+    if (prv_is_empty(a)) return b;
+    if (prv_is_empty(b)) return a;
+
+    int16_t x0 = a.origin.x < b.origin.x ? a.origin.x : b.origin.x;
+    int16_t y0 = a.origin.y < b.origin.y ? a.origin.y : b.origin.y;
+    int16_t ax1 = a.origin.x + a.size.w, bx1 = b.origin.x + b.size.w;
+    int16_t ay1 = a.origin.y + a.size.h, by1 = b.origin.y + b.size.h;
+    int16_t x1 = ax1 > bx1 ? ax1 : bx1;
+    int16_t y1 = ay1 > by1 ? ay1 : by1;
+    return GRect(x0, y0, x1 - x0, y1 - y0);
+}
+
+// Overlapping or touching
+static bool prv_overlaps(GRect a, GRect b) {
+    return a.origin.x <= b.origin.x + b.size.w && b.origin.x <= a.origin.x + a.size.w &&
+           a.origin.y <= b.origin.y + b.size.h && b.origin.y <= a.origin.y + a.size.h;
+}
+
+// ============================================================================
+// RECT LIST
+// ============================================================================
+
+static void prv_remove_rect(DirtyTracker *tracker, int index) {
+    tracker->num_rects--;
+    tracker->rects[index] = tracker->rects[tracker->num_rects];
+}
+
+// Merges rects that grew into each other
+static void prv_coalesce(DirtyTracker *tracker) {
+    for (int i = 0; i < tracker->num_rects; i++) {
+        for (int j = i + 1; j < tracker->num_rects; j++) {
+            if (prv_overlaps(tracker->rects[i], tracker->rects[j])) {
+                tracker->rects[i] = prv_union(tracker->rects[i], tracker->rects[j]);
+                prv_remove_rect(tracker, j);
+                j = i;  // rects[i] grew: check it against everything again
+            }
+        }
+    }
+}
+
+static void prv_add_rect(DirtyTracker *tracker, GRect rect) {
+    GRect screen = layer_get_bounds(tracker->parent);
+    grect_clip(&rect, &screen);
+    if (prv_is_empty(rect)) return;
+
+    for (int i = 0; i < tracker->num_rects; i++) {
+        if (prv_overlaps(tracker->rects[i], rect)) {
+            tracker->rects[i] = prv_union(tracker->rects[i], rect);
+            return;
+        }
+    }
+
+    if (tracker->num_rects < DIRTY_TRACKER_MAX_RECTS) {
+        tracker->rects[tracker->num_rects++] = rect;
+        return;
+    }
+
+    // Out of clip layers: grow whichever rect gains the least area
+    int best = 0;
+    int32_t best_growth = INT32_MAX;
+    for (int i = 0; i < tracker->num_rects; i++) {
+        GRect merged = prv_union(tracker->rects[i], rect);
+        int32_t growth = prv_area(merged) - prv_area(tracker->rects[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    tracker->rects[best] = prv_union(tracker->rects[best], rect);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+DirtyTracker *dirty_tracker_create(Layer *parent, uint16_t num_entities, LayerUpdateProc update_proc) {
+    DirtyTracker *tracker = calloc(1, sizeof(DirtyTracker) + 2 * num_entities * sizeof(GRect));
+    if (!tracker) return NULL;
+
+    tracker->parent = parent;
+    tracker->num_entities = num_entities;
+    tracker->full = true;
+
+    for (int i = 0; i < DIRTY_TRACKER_MAX_RECTS; i++) {
+        tracker->clips[i] = layer_create(GRectZero);
+        if (!tracker->clips[i]) continue;
+        layer_set_update_proc(tracker->clips[i], update_proc);
+        layer_set_clips(tracker->clips[i], true);
+        layer_set_hidden(tracker->clips[i], true);
+        layer_add_child(parent, tracker->clips[i]);
+    }
+    return tracker;
+}
+
+void dirty_tracker_destroy(DirtyTracker *tracker) {
+    if (!tracker) return;
+    for (int i = 0; i < DIRTY_TRACKER_MAX_RECTS; i++) {
+        if (tracker->clips[i]) layer_destroy(tracker->clips[i]);
+    }
+    free(tracker);
+}
+
+void dirty_tracker_set_bbox(DirtyTracker *tracker, uint16_t index, GRect bbox) {
+    if (!tracker || index >= tracker->num_entities) return;
+    tracker->boxes[tracker->num_entities + index] = bbox;
+}
+
+void dirty_tracker_add_rect(DirtyTracker *tracker, GRect rect) {
+    if (tracker) {
+        prv_add_rect(tracker, rect);
+    }
+}
+
+void dirty_tracker_mark_all(DirtyTracker *tracker) {
+    if (tracker) {
+        tracker->full = true;
+    }
+}
+
+void dirty_tracker_commit(DirtyTracker *tracker) {
+    if (!tracker) return;
+
+    GRect *prev = tracker->boxes;
+    GRect *cur = tracker->boxes + tracker->num_entities;
+    GRect screen = layer_get_bounds(tracker->parent);
+
+    if (tracker->full) {
+        tracker->rects[0] = screen;
+        tracker->num_rects = 1;
+    } else {
+        // Old position (to erase) + new position (to draw)
+        for (int i = 0; i < tracker->num_entities; i++) {
+            prv_add_rect(tracker, prv_union(prev[i], cur[i]));
+        }
+        prv_coalesce(tracker);
+    }
+    memcpy(prev, cur, tracker->num_entities * sizeof(GRect));
+
+    for (int i = 0; i < DIRTY_TRACKER_MAX_RECTS; i++) {
+        Layer *clip = tracker->clips[i];
+        if (!clip) continue;
+
+        if (i < tracker->num_rects) {
+            GRect r = tracker->rects[i];
+            layer_set_frame(clip, r);
+            // Offset bounds so update procs keep drawing in screen coordinates
+            layer_set_bounds(clip, GRect(-r.origin.x, -r.origin.y, screen.size.w, screen.size.h));
+            layer_set_hidden(clip, false);
+            layer_mark_dirty(clip);
+        } else if (!layer_get_hidden(clip)) {
+            layer_set_hidden(clip, true);
+        }
+    }
+
+    tracker->num_rects = 0;
+    tracker->full = false;
+}
+
+bool dirty_tracker_overlaps(Layer *layer, GRect rect) {
+    return !prv_is_empty(rect) && prv_overlaps(layer_get_frame(layer), rect);
+}
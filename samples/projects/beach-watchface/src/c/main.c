@@ -1,11 +1,15 @@
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/dirty_tracker.h"
+#include "lib/fixed_tables.h"
+#include "lib/frame_governor.h"
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
 #define NUM_WAVES 3
-#define ANIMATION_INTERVAL 50
-#define ANIMATION_INTERVAL_LOW_POWER 100
+#define ANIMATION_INTERVAL 50       // Frame governor doubles it on low battery
+#define MAX_INTERVAL 250
 #define LOW_BATTERY_THRESHOLD 20
 
 #define SCREEN_WIDTH 144
@@ -23,6 +27,9 @@
 #define SUN_RAY_LENGTH 10
 #define SUN_NUM_RAYS 8
 
+// Wave drawn in 6px segments, two wavelengths across the screen
+#define WAVE_SEGMENT_ANGLE (6 * TRIG_MAX_ANGLE * 2 / SCREEN_WIDTH)
+
 // ============================================================================
 // COLOR DEFINITIONS
 // ============================================================================
@@ -77,10 +84,11 @@ static Window *s_main_window;
 static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
-static AppTimer *s_animation_timer;
+static FrameGovernor *s_governor;  // Owns the animation timer
+static BgCache *s_bg_cache;
+static DirtyTracker *s_dirty;  // Repaints the wave band only
 
 static int s_battery_level = 100;
-static bool s_is_charging = false;
 
 static Wave s_waves[NUM_WAVES];
 static Sun s_sun;
@@ -213,6 +221,11 @@ static void draw_ocean_background(GContext *ctx) {
     #endif
 }
 
+// Horizontal band a wave can touch (2px stroke around base_y +/- amplitude)
+static GRect wave_bbox(const Wave *wave) {
+    return GRect(0, wave->base_y - wave->amplitude - 2, SCREEN_WIDTH, 2 * wave->amplitude + 5);
+}
+
 static void draw_wave(GContext *ctx, const Wave *wave) {
     graphics_context_set_stroke_color(ctx, wave->color);
     graphics_context_set_stroke_width(ctx, 2);
@@ -221,14 +234,14 @@ static void draw_wave(GContext *ctx, const Wave *wave) {
 
     // First point
     int32_t angle = wave->phase;
-    int16_t y_offset = (sin_lookup(angle) * wave->amplitude) / TRIG_MAX_RATIO;
+    int16_t y_offset = fixed_sin_mul(angle, wave->amplitude);
     prev.x = 0;
     prev.y = wave->base_y + y_offset;
 
     // Draw wave as connected line segments
     for (int x = 6; x <= SCREEN_WIDTH; x += 6) {
-        int32_t segment_angle = (wave->phase + (x * TRIG_MAX_ANGLE * 2 / SCREEN_WIDTH)) % TRIG_MAX_ANGLE;
-        y_offset = (sin_lookup(segment_angle) * wave->amplitude) / TRIG_MAX_RATIO;
+        angle += WAVE_SEGMENT_ANGLE;
+        y_offset = fixed_sin_mul(angle, wave->amplitude);
 
         curr.x = x;
         curr.y = wave->base_y + y_offset;
@@ -255,6 +268,14 @@ static void draw_sand(GContext *ctx) {
     #endif
 }
 
+// Sky, sun, ocean and sand never move: render them once into the cache.
+// Waves stay above SAND_START_Y, so the sand can sit behind them.
+static void draw_scenery(GContext *ctx, GRect bounds) {
+    draw_sky(ctx);
+    draw_ocean_background(ctx);
+    draw_sand(ctx);
+}
+
 static void draw_battery(GContext *ctx, GRect bounds) {
     // Battery outline
     graphics_context_set_stroke_color(ctx, COLOR_TEXT);
@@ -287,26 +308,31 @@ static void draw_battery(GContext *ctx, GRect bounds) {
     }
 }
 
+// Called for each dirty clip layer; drawing is clipped to its frame
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
-    GRect bounds = layer_get_bounds(layer);
+    GRect bounds = layer_get_bounds(s_canvas_layer);
+    frame_governor_render_begin(s_governor);
 
-    // Draw background elements (back to front)
-    draw_sky(ctx);
-    draw_ocean_background(ctx);
+    // Draw cached background (sky, ocean, sand)
+    bg_cache_draw(s_bg_cache, ctx, bounds);
 
     // Draw waves from back to front
     for (int i = NUM_WAVES - 1; i >= 0; i--) {
-        draw_wave(ctx, &s_waves[i]);
+        if (dirty_tracker_overlaps(layer, wave_bbox(&s_waves[i]))) {
+            draw_wave(ctx, &s_waves[i]);
+        }
     }
 
-    // Draw sand
-    draw_sand(ctx);
-
-    // Draw battery indicator in top-right corner
+    // Draw battery indicator in top-right corner (draw_battery only uses
+    // the size and draws at the origin)
     GRect battery_bounds = GRect(bounds.size.w - 28, 5, 24, 10);
-    GContext *battery_ctx = ctx;
-    graphics_context_set_fill_color(battery_ctx, GColorClear);
-    draw_battery(battery_ctx, battery_bounds);
+    if (dirty_tracker_overlaps(layer, GRect(0, 0, battery_bounds.size.w, battery_bounds.size.h))) {
+        GContext *battery_ctx = ctx;
+        graphics_context_set_fill_color(battery_ctx, GColorClear);
+        draw_battery(battery_ctx, battery_bounds);
+    }
+
+    frame_governor_render_end(s_governor);
 }
 
 // ============================================================================
@@ -346,31 +372,48 @@ static void update_time(void) {
 // ============================================================================
 // CALLBACK HANDLERS
 // ============================================================================
-static void animation_timer_callback(void *data) {
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+    .interval_ms = ANIMATION_INTERVAL,
+    .idle_interval_ms = ANIMATION_INTERVAL,  // Waves always roll
+    .max_interval_ms = MAX_INTERVAL,
+    .low_battery_percent = LOW_BATTERY_THRESHOLD,
+};
+
+// Called by the frame governor
+static void animation_frame(void *context) {
     update_waves();
 
-    if (s_canvas_layer) {
-        layer_mark_dirty(s_canvas_layer);
+    // Only the wave band changes between frames
+    for (int i = 0; i < NUM_WAVES; i++) {
+        dirty_tracker_set_bbox(s_dirty, i, wave_bbox(&s_waves[i]));
     }
-
-    uint32_t next_interval = (s_battery_level <= LOW_BATTERY_THRESHOLD && !s_is_charging)
-                             ? ANIMATION_INTERVAL_LOW_POWER
-                             : ANIMATION_INTERVAL;
-
-    s_animation_timer = app_timer_register(next_interval, animation_timer_callback, NULL);
+    if (!bg_cache_is_valid(s_bg_cache)) {
+        dirty_tracker_mark_all(s_dirty);
+    }
+    dirty_tracker_commit(s_dirty);
 }
 
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
     update_time();
+    bg_cache_invalidate(s_bg_cache);
+    dirty_tracker_mark_all(s_dirty);
 }
 
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_did_change(void *context) {
+    bg_cache_invalidate(s_bg_cache);
+    dirty_tracker_mark_all(s_dirty);
+    dirty_tracker_commit(s_dirty);
+}
+#endif
+
 static void battery_callback(BatteryChargeState state) {
     s_battery_level = state.charge_percent;
-    s_is_charging = state.is_charging;
+    frame_governor_set_battery(s_governor, state);
 
-    if (s_canvas_layer) {
-        layer_mark_dirty(s_canvas_layer);
-    }
+    // Battery indicator is drawn at the canvas origin
+    dirty_tracker_add_rect(s_dirty, GRect(0, 0, 24, 10));
+    dirty_tracker_commit(s_dirty);
 }
 
 // ============================================================================
@@ -380,10 +423,18 @@ static void main_window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
     GRect bounds = layer_get_bounds(window_layer);
 
-    // Canvas layer for background and waves
+    // Canvas layer for background and waves, drawn through dirty clip layers
     s_canvas_layer = layer_create(bounds);
-    layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
+    s_dirty = dirty_tracker_create(s_canvas_layer, NUM_WAVES, canvas_update_proc);
+
+    // Static background cache
+    s_bg_cache = bg_cache_create(draw_scenery);
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+        .did_change = unobstructed_did_change
+    }, NULL);
+    #endif
 
     // Time text layer
     s_time_layer = text_layer_create(GRect(0, 52, bounds.size.w, 50));
@@ -408,20 +459,37 @@ static void main_window_load(Window *window) {
     // Get initial battery state
     BatteryChargeState charge = battery_state_service_peek();
     s_battery_level = charge.charge_percent;
-    s_is_charging = charge.is_charging;
 
     // Start animation
-    s_animation_timer = app_timer_register(ANIMATION_INTERVAL, animation_timer_callback, NULL);
+    s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
+    frame_governor_set_battery(s_governor, charge);
+    frame_governor_run(s_governor, true);
 
     // Initial time update
     update_time();
 }
 
 static void main_window_unload(Window *window) {
-    // Cancel animation timer
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
+    // Stop animation timer
+    if (s_governor) {
+        frame_governor_destroy(s_governor);
+        s_governor = NULL;
+    }
+
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+    #endif
+
+    // Destroy background cache
+    if (s_bg_cache) {
+        bg_cache_destroy(s_bg_cache);
+        s_bg_cache = NULL;
+    }
+
+    // Destroy dirty tracker before its parent canvas
+    if (s_dirty) {
+        dirty_tracker_destroy(s_dirty);
+        s_dirty = NULL;
     }
 
     // Destroy layers
@@ -444,6 +512,8 @@ static void main_window_unload(Window *window) {
 // ============================================================================
 static void init(void) {
     s_main_window = window_create();
+    // Keep the previous frame between renders (dirty-rect updates)
+    window_set_background_color(s_main_window, GColorClear);
 
     window_set_window_handlers(s_main_window, (WindowHandlers) {
         .load = main_window_load,
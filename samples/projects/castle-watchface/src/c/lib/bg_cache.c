@@ -0,0 +1,258 @@
+/**
+ * Background Cache - see bg_cache.h
+ */
+
+#include <pebble.h>
+#include "bg_cache.h"
+
+struct BgCache {
+    BgCacheDrawProc draw_proc;
+    GBitmap *bitmap;
+    GRect bounds;            // Layer bounds the procs were last called with
+
+    BgCacheDrawProc overlay_proc;
+    GRect overlay_frame;
+    GBitmap *overlay;        // Color: 8-bit with alpha. B/W: pixels to OR in
+#ifndef PBL_COLOR
+    GBitmap *overlay_mask;   // B/W only: 0 where the overlay is opaque
+#endif
+
+    bool valid;
+    bool direct;             // Allocation failed: draw procs every frame
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static int prv_min(int a, int b) { return a < b ? a : b; }
+static int prv_max(int a, int b) { return a > b ? a : b; }
+
+#ifndef PBL_COLOR
+static bool prv_get_bit(const uint8_t *row, int x) {
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+static void prv_set_bit(uint8_t *row, int x, bool value) {
+    if (value) {
+        row[x >> 3] |= (1 << (x & 7));
+    } else {
+        row[x >> 3] &= ~(1 << (x & 7));
+    }
+}
+#endif
+
+static GBitmap *prv_create_bitmap(GSize size) {
+    return gbitmap_create_blank(size, PBL_IF_COLOR_ELSE(GBitmapFormat8Bit, GBitmapFormat1Bit));
+}
+
+// Copies `src` (screen coordinates) from the captured frame buffer into
+// `dst` at (0, 0). On round displays only the visible span of each row is
+// copied; the rest of the row is cleared.
+static void prv_copy_from_frame_buffer(GBitmap *fb, GBitmap *dst, GRect src) {
+    GRect fb_bounds = gbitmap_get_bounds(fb);
+    int y_end = prv_min(src.origin.y + src.size.h, fb_bounds.size.h);
+    int row_bytes = PBL_IF_COLOR_ELSE(src.size.w, (src.size.w + 7) / 8);
+
+    for (int y = prv_max(src.origin.y, 0); y < y_end; y++) {
+        GBitmapDataRowInfo src_row = gbitmap_get_data_row_info(fb, y);
+        GBitmapDataRowInfo dst_row = gbitmap_get_data_row_info(dst, y - src.origin.y);
+        int x0 = prv_max(src.origin.x, src_row.min_x);
+        int x1 = prv_min(src.origin.x + src.size.w - 1, src_row.max_x);
+
+        memset(dst_row.data, 0, row_bytes);
+        if (x1 < x0) continue;
+
+#if defined(PBL_COLOR)
+        memcpy(&dst_row.data[x0 - src.origin.x], &src_row.data[x0], x1 - x0 + 1);
+#else
+        for (int x = x0; x <= x1; x++) {
+            prv_set_bit(dst_row.data, x - src.origin.x, prv_get_bit(src_row.data, x));
+        }
+#endif
+    }
+}
+
+// ============================================================================
+// REBUILD
+// ============================================================================
+
+static void prv_fill(GContext *ctx, GRect rect, GColor color) {
+    graphics_context_set_fill_color(ctx, color);
+    graphics_fill_rect(ctx, rect, 0, GCornerNone);
+}
+
+// Renders the overlay over black, stores it, renders it again over white
+// and marks every pixel that changed as transparent.
+static void prv_build_overlay(BgCache *cache, GContext *ctx, GRect bounds) {
+    GRect frame = cache->overlay_frame;
+
+    prv_fill(ctx, frame, GColorBlack);
+    cache->overlay_proc(ctx, bounds);
+    GBitmap *fb = graphics_capture_frame_buffer(ctx);
+    if (!fb) return;
+    prv_copy_from_frame_buffer(fb, cache->overlay, frame);
+    graphics_release_frame_buffer(ctx, fb);
+
+    prv_fill(ctx, frame, GColorWhite);
+    cache->overlay_proc(ctx, bounds);
+    fb = graphics_capture_frame_buffer(ctx);
+    if (!fb) return;
+
+    int y_end = prv_min(frame.origin.y + frame.size.h, gbitmap_get_bounds(fb).size.h);
+    for (int y = prv_max(frame.origin.y, 0); y < y_end; y++) {
+        GBitmapDataRowInfo white_row = gbitmap_get_data_row_info(fb, y);
+        GBitmapDataRowInfo black_row = gbitmap_get_data_row_info(cache->overlay, y - frame.origin.y);
+        int x0 = prv_max(frame.origin.x, white_row.min_x);
+        int x1 = prv_min(frame.origin.x + frame.size.w - 1, white_row.max_x);
+#if defined(PBL_COLOR)
+        for (int x = x0; x <= x1; x++) {
+            uint8_t *pixel = &black_row.data[x - frame.origin.x];
+            if (*pixel != white_row.data[x]) {
+                *pixel = GColorClear.argb;
+            }
+        }
+#else
+        GBitmapDataRowInfo mask_row = gbitmap_get_data_row_info(cache->overlay_mask, y - frame.origin.y);
+        memset(mask_row.data, 0xFF, (frame.size.w + 7) / 8);
+        for (int x = x0; x <= x1; x++) {
+            int local_x = x - frame.origin.x;
+            bool differs = prv_get_bit(black_row.data, local_x) != prv_get_bit(white_row.data, x);
+            prv_set_bit(mask_row.data, local_x, differs);
+        }
+#endif
+    }
+    graphics_release_frame_buffer(ctx, fb);
+}
+
+static bool prv_allocate(BgCache *cache, GRect bounds) {
+    if (!cache->bitmap) {
+        cache->bitmap = prv_create_bitmap(bounds.size);
+    }
+    if (cache->overlay_proc && !cache->overlay) {
+        cache->overlay = prv_create_bitmap(cache->overlay_frame.size);
+    }
+#ifndef PBL_COLOR
+    if (cache->overlay_proc && !cache->overlay_mask) {
+        cache->overlay_mask = prv_create_bitmap(cache->overlay_frame.size);
+    }
+    if (cache->overlay_proc && !cache->overlay_mask) return false;
+#endif
+    return cache->bitmap && (!cache->overlay_proc || cache->overlay);
+}
+
+static void prv_rebuild(BgCache *cache, GContext *ctx, GRect bounds) {
+    cache->valid = true;
+
+    if (!prv_allocate(cache, bounds)) {
+        APP_LOG(APP_LOG_LEVEL_WARNING, "bg_cache: out of memory, drawing directly");
+        cache->direct = true;
+        cache->draw_proc(ctx, bounds);
+        return;
+    }
+
+    if (cache->overlay_proc) {
+        prv_build_overlay(cache, ctx, bounds);
+    }
+
+    // The background is drawn last so it is what this frame shows
+    cache->draw_proc(ctx, bounds);
+    GBitmap *fb = graphics_capture_frame_buffer(ctx);
+    if (!fb) {
+        cache->valid = false;
+        return;
+    }
+    prv_copy_from_frame_buffer(fb, cache->bitmap, bounds);
+    graphics_release_frame_buffer(ctx, fb);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+BgCache *bg_cache_create(BgCacheDrawProc draw_proc) {
+    BgCache *cache = calloc(1, sizeof(BgCache));
+    if (cache) {
+        cache->draw_proc = draw_proc;
+    }
+    return cache;
+}
+
+void bg_cache_destroy(BgCache *cache) {
+    if (!cache) return;
+    if (cache->bitmap) gbitmap_destroy(cache->bitmap);
+    if (cache->overlay) gbitmap_destroy(cache->overlay);
+#ifndef PBL_COLOR
+    if (cache->overlay_mask) gbitmap_destroy(cache->overlay_mask);
+#endif
+    free(cache);
+}
+
+void bg_cache_set_overlay(BgCache *cache, GRect frame, BgCacheDrawProc overlay_proc) {
+    if (!cache) return;
+
+    // Bitmaps are sized to the frame; reallocate on the next rebuild
+    if (cache->overlay && (cache->overlay_frame.size.w != frame.size.w ||
+                           cache->overlay_frame.size.h != frame.size.h)) {
+        gbitmap_destroy(cache->overlay);
+        cache->overlay = NULL;
+    }
+#ifndef PBL_COLOR
+    if (cache->overlay_mask && (cache->overlay_frame.size.w != frame.size.w ||
+                                cache->overlay_frame.size.h != frame.size.h)) {
+        gbitmap_destroy(cache->overlay_mask);
+        cache->overlay_mask = NULL;
+    }
+#endif
+    cache->overlay_frame = frame;
+    cache->overlay_proc = overlay_proc;
+    cache->valid = false;
+}
+
+void bg_cache_invalidate(BgCache *cache) {
+    if (cache) {
+        cache->valid = false;
+    }
+}
+
+bool bg_cache_is_valid(const BgCache *cache) {
+    return cache && (cache->valid || cache->direct);
+}
+
+void bg_cache_draw(BgCache *cache, GContext *ctx, GRect bounds) {
+    if (!cache) return;
+    cache->bounds = bounds;
+
+    if (cache->direct) {
+        cache->draw_proc(ctx, bounds);
+        return;
+    }
+    if (!cache->valid) {
+        // Rebuilding leaves the fresh background in the frame buffer
+        prv_rebuild(cache, ctx, bounds);
+        return;
+    }
+
+    graphics_context_set_compositing_mode(ctx, GCompOpAssign);
+    graphics_draw_bitmap_in_rect(ctx, cache->bitmap, bounds);
+}
+
+void bg_cache_draw_overlay(BgCache *cache, GContext *ctx) {
+    if (!cache || !cache->overlay_proc) return;
+
+    if (cache->direct) {
+        cache->overlay_proc(ctx, cache->bounds);
+        return;
+    }
+
+#if defined(PBL_COLOR)
+    graphics_context_set_compositing_mode(ctx, GCompOpSet);
+    graphics_draw_bitmap_in_rect(ctx, cache->overlay, cache->overlay_frame);
+#else
+    graphics_context_set_compositing_mode(ctx, GCompOpAnd);
+    graphics_draw_bitmap_in_rect(ctx, cache->overlay_mask, cache->overlay_frame);
+    graphics_context_set_compositing_mode(ctx, GCompOpOr);
+    graphics_draw_bitmap_in_rect(ctx, cache->overlay, cache->overlay_frame);
+#endif
+    graphics_context_set_compositing_mode(ctx, GCompOpAssign);
+}
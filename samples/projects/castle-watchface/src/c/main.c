@@ -1,4 +1,8 @@
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/dirty_tracker.h"
+#include "lib/frame_governor.h"
+#include "lib/round_mask.h"
 
 // Screen dimensions
 #define SCREEN_WIDTH 144
@@ -22,9 +26,10 @@
 #define KNIGHT_HEIGHT 18
 #define KNIGHT_Y (GROUND_TOP + 10)
 
-// Animation
+// Animation (the frame governor doubles intervals on low battery and
+// backs off further if frames can't keep up)
 #define ANIMATION_INTERVAL 80
-#define LOW_POWER_INTERVAL 150
+#define MAX_INTERVAL 300
 #define LOW_BATTERY_THRESHOLD 20
 
 // Knight states
@@ -41,15 +46,14 @@ static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_day_layer;
 static Layer *s_battery_layer;
-static AppTimer *s_animation_timer = NULL;
+static FrameGovernor *s_governor = NULL;  // Owns the animation timer
+static BgCache *s_bg_cache = NULL;  // Sky, ground and castle (static)
+static DirtyTracker *s_dirty = NULL;  // Repaints only around the knights
 
 static Knight s_knights[2];
 static int s_battery_level = 100;
 static int s_star_positions[8];  // Pre-computed star positions
 
-// Forward declarations
-static void animation_timer_callback(void *data);
-
 // Initialize knights
 static void init_knights(void) {
     // Knight 1: starts left, walks right
@@ -236,6 +240,12 @@ static void draw_castle(GContext *ctx) {
     draw_keep(ctx);
 }
 
+// Screen area a knight covers, sword and shield included
+static GRect knight_bbox(const Knight *knight) {
+    if (!knight->active) return GRectZero;
+    return GRect(knight->x - 4, KNIGHT_Y - 2, 21, 21);
+}
+
 // Draw a knight
 static void draw_knight(GContext *ctx, Knight *knight) {
     if (!knight->active) return;
@@ -297,19 +307,31 @@ static void draw_knight(GContext *ctx, Knight *knight) {
     }
 }
 
-// Canvas update proc
-static void canvas_update_proc(Layer *layer, GContext *ctx) {
-    // Draw background elements
+// Draw static scenery (rendered once into the background cache)
+static void draw_scenery(GContext *ctx, GRect bounds) {
+    graphics_context_set_fill_color(ctx, GColorBlack);
+    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+
     draw_sky(ctx);
     draw_ground(ctx);
-
-    // Draw castle
     draw_castle(ctx);
+}
+
+// Canvas update proc
+static void canvas_update_proc(Layer *layer, GContext *ctx) {
+    frame_governor_render_begin(s_governor);
 
-    // Draw knights
+    // Draw cached sky, ground and castle
+    bg_cache_draw(s_bg_cache, ctx, layer_get_bounds(s_canvas_layer));
+
+    // Draw knights touching this clip
     for (int i = 0; i < 2; i++) {
-        draw_knight(ctx, &s_knights[i]);
+        if (dirty_tracker_overlaps(layer, knight_bbox(&s_knights[i]))) {
+            draw_knight(ctx, &s_knights[i]);
+        }
     }
+
+    frame_governor_render_end(s_governor);
 }
 
 // Battery layer update proc
@@ -364,27 +386,50 @@ static void update_time(void) {
 // Tick handler
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
     update_time();
+    bg_cache_invalidate(s_bg_cache);
+    dirty_tracker_mark_all(s_dirty);
+}
+
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+// Rebuild the background when Timeline Quick View appears or hides
+static void unobstructed_did_change(void *context) {
+    bg_cache_invalidate(s_bg_cache);
+    dirty_tracker_mark_all(s_dirty);
+    dirty_tracker_commit(s_dirty);
 }
+#endif
 
 // Battery callback
 static void battery_callback(BatteryChargeState charge_state) {
     s_battery_level = charge_state.charge_percent;
+    frame_governor_set_battery(s_governor, charge_state);
     if (s_battery_layer) {
+        // Battery layer has no background: restore what's under it
+        dirty_tracker_add_rect(s_dirty, layer_get_frame(s_battery_layer));
+        dirty_tracker_commit(s_dirty);
         layer_mark_dirty(s_battery_layer);
     }
 }
 
-// Animation timer callback
-static void animation_timer_callback(void *data) {
-    update_knights();
-    layer_mark_dirty(s_canvas_layer);
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+    .interval_ms = ANIMATION_INTERVAL,
+    .idle_interval_ms = ANIMATION_INTERVAL,  // Knights never stop walking
+    .max_interval_ms = MAX_INTERVAL,
+    .low_battery_percent = LOW_BATTERY_THRESHOLD,
+};
 
-    // Adaptive frame rate
-    uint32_t interval = (s_battery_level <= LOW_BATTERY_THRESHOLD)
-                        ? LOW_POWER_INTERVAL
-                        : ANIMATION_INTERVAL;
+// Animation frame, called by the governor
+static void animation_frame(void *context) {
+    update_knights();
 
-    s_animation_timer = app_timer_register(interval, animation_timer_callback, NULL);
+    // Repaint the knights' old and new positions only
+    for (int i = 0; i < 2; i++) {
+        dirty_tracker_set_bbox(s_dirty, i, knight_bbox(&s_knights[i]));
+    }
+    if (!bg_cache_is_valid(s_bg_cache)) {
+        dirty_tracker_mark_all(s_dirty);
+    }
+    dirty_tracker_commit(s_dirty);
 }
 
 // Window load
@@ -392,13 +437,22 @@ static void main_window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
     GRect bounds = layer_get_bounds(window_layer);
 
-    // Set window background
-    window_set_background_color(window, GColorBlack);
+    // Clear window background: the previous frame must survive between
+    // renders for dirty-rect updates (the background cache paints black)
+    window_set_background_color(window, GColorClear);
 
-    // Create canvas layer for drawing
+    // Create canvas layer; the dirty tracker's clip layers draw into it
     s_canvas_layer = layer_create(bounds);
-    layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
+    s_dirty = dirty_tracker_create(s_canvas_layer, 2, canvas_update_proc);
+
+    // Background cache for the static scenery
+    s_bg_cache = bg_cache_create(draw_scenery);
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+        .did_change = unobstructed_did_change
+    }, NULL);
+    #endif
 
     // Time layer - positioned at very top above castle
     s_time_layer = text_layer_create(GRect(0, 5, bounds.size.w, 34));
@@ -416,8 +470,10 @@ static void main_window_load(Window *window) {
     text_layer_set_text_alignment(s_day_layer, GTextAlignmentCenter);
     layer_add_child(window_layer, text_layer_get_layer(s_day_layer));
 
-    // Battery layer
-    s_battery_layer = layer_create(GRect(bounds.size.w - 28, 5, 24, 10));
+    // Battery layer (beside the day on round: the top corner is masked off
+    // and the time fills the top row)
+    s_battery_layer = layer_create(round_mask_fit_rect(bounds,
+        GRect(bounds.size.w - 28, PBL_IF_ROUND_ELSE(39, 5), 24, 10)));
     layer_set_update_proc(s_battery_layer, battery_update_proc);
     layer_add_child(window_layer, s_battery_layer);
 
@@ -428,19 +484,38 @@ static void main_window_load(Window *window) {
     // Update time immediately
     update_time();
 
+    // Frame governor (needs to exist before the first battery update)
+    s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
+
     // Get initial battery level
     battery_callback(battery_state_service_peek());
 
     // Start animation timer
-    s_animation_timer = app_timer_register(ANIMATION_INTERVAL, animation_timer_callback, NULL);
+    frame_governor_run(s_governor, true);
 }
 
 // Window unload
 static void main_window_unload(Window *window) {
-    // Cancel animation timer
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
+    // Stop animation timer
+    if (s_governor) {
+        frame_governor_destroy(s_governor);
+        s_governor = NULL;
+    }
+
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+    #endif
+
+    // Destroy background cache
+    if (s_bg_cache) {
+        bg_cache_destroy(s_bg_cache);
+        s_bg_cache = NULL;
+    }
+
+    // Destroy dirty tracker (its clip layers live inside the canvas)
+    if (s_dirty) {
+        dirty_tracker_destroy(s_dirty);
+        s_dirty = NULL;
     }
 
     // Destroy layers
@@ -483,12 +558,6 @@ static void init(void) {
 
 // Deinit
 static void deinit(void) {
-    // Cancel animation timer
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
-    }
-
     // Unsubscribe services
     tick_timer_service_unsubscribe();
     battery_state_service_unsubscribe();
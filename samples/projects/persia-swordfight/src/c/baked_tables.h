@@ -0,0 +1,616 @@
+// Generated by bake_tables.py from fight_bake.c - do not edit
+#pragma once
+
+#if defined(PBL_ROUND)
+#define FIGHT_FRAMES 234
+
+static const FightFrame FIGHT_TABLE[FIGHT_FRAMES] = {
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 0
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 1
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 2
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 3
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 4
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 5
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 6
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 7
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 8
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 9
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 10
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 11
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 12
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 13
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 14
+    { {  35, 3,   8,  12,   0,   4,   6,  1 }, { 145, 4,   2,   6,   0,   2,   6,  2 } },  // 15
+    { {  35, 3,  10,  12,   0,   5,  12,  3 }, { 145, 4,   2,   6,   0,   2,  10,  4 } },  // 16
+    { {  35, 3,  10,  12,   0,   5,  12,  5 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 17
+    { {  35, 3,  10,  12,   0,   5,  12,  7 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 18
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 19
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 20
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 21
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 22
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 23
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 24
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 145, 3,   7,  12,   0,   5,  12, 10 } },  // 25
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 145, 3,  10,  12,   0,   5,  12, 12 } },  // 26
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 145, 3,  10,  12,   0,   5,  12, 14 } },  // 27
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 145, 3,  10,  12,   0,   5,  12, 16 } },  // 28
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 145, 3,  10,  12,   0,   5,  12, 18 } },  // 29
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 145, 3,  10,  12,   0,   5,  12, 20 } },  // 30
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 31
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 32
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 33
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 34
+    { {  35, 0,   3,   6,   0,   0,   4, 10 }, { 145, 0,   5,   6,   0,   1,   6,  9 } },  // 35
+    { {  35, 0,   3,   6,   0,   0,   0, 12 }, { 145, 0,   3,   6,   0,   0,   0, 11 } },  // 36
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0, 13 } },  // 37
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0, 15 } },  // 38
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 39
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 40
+    { {  35, 2,   8,  12,   0,   4,  -6,  1 }, { 145, 5,   4,   8,   0,   4,  -4,  1 } },  // 41
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4,  3 } },  // 42
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 43
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 44
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 45
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 46
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 47
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 48
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 49
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 50
+    { {  35, 5,   7,  10,   0,   4,  -4, 22 }, { 145, 2,   9,  14,   0,   8,  -8, 21 } },  // 51
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 52
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 53
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 54
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 55
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 56
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 57
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 58
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 59
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 60
+    { {  35, 3,   9,  12,   0,   5,   2, 23 }, { 145, 4,   7,  10,   0,   4,  -2, 24 } },  // 61
+    { {  35, 3,  10,  12,   0,   5,   8, 25 }, { 145, 4,   2,   6,   0,   2,   4, 26 } },  // 62
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10, 27 } },  // 63
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 64
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 65
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 66
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 67
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 68
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 145, 3,   7,  12,   0,   5,  12, 10 } },  // 69
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 145, 3,  10,  12,   0,   5,  12, 12 } },  // 70
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 145, 3,  10,  12,   0,   5,  12, 14 } },  // 71
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 145, 3,  10,  12,   0,   5,  12, 16 } },  // 72
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 145, 3,  10,  12,   0,   5,  12, 18 } },  // 73
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 145, 3,  10,  12,   0,   5,  12, 20 } },  // 74
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 75
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 76
+    { {  35, 3,   7,  12,   0,   5,  12, 10 }, { 145, 4,   5,   6,   0,   2,  10,  9 } },  // 77
+    { {  35, 3,  10,  12,   0,   5,  12, 12 }, { 145, 4,   2,   6,   0,   2,  10, 11 } },  // 78
+    { {  35, 3,  10,  12,   0,   5,  12, 14 }, { 145, 4,   2,   6,   0,   2,  10, 13 } },  // 79
+    { {  35, 3,  10,  12,   0,   5,  12, 16 }, { 145, 4,   2,   6,   0,   2,  10, 15 } },  // 80
+    { {  35, 3,  10,  12,   0,   5,  12, 18 }, { 145, 4,   2,   6,   0,   2,  10, 17 } },  // 81
+    { {  35, 3,  10,  12,   0,   5,  12, 20 }, { 145, 4,   2,   6,   0,   2,  10, 19 } },  // 82
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 83
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 84
+    { {  35, 0,   5,   6,   0,   1,   6,  9 }, { 145, 0,   3,   6,   0,   0,   4, 10 } },  // 85
+    { {  35, 0,   3,   6,   0,   0,   0, 11 }, { 145, 0,   3,   6,   0,   0,   0, 12 } },  // 86
+    { {  35, 0,   3,   6,   0,   0,   0, 13 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 87
+    { {  35, 0,   3,   6,   0,   0,   0, 15 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 88
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 89
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 90
+    { {  35, 2,   8,  12,   0,   4,  -6,  1 }, { 145, 5,   4,   8,   0,   4,  -4,  1 } },  // 91
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4,  3 } },  // 92
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 93
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 94
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 95
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 96
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 97
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 98
+    { {  35, 3,  10,  12,   0,   5,  -2, 28 }, { 145, 4,   2,   6,   0,   2,   2, 29 } },  // 99
+    { {  35, 3,  10,  12,   0,   5,   4, 30 }, { 145, 4,   2,   6,   0,   2,   8, 31 } },  // 100
+    { {  35, 3,  10,  12,   0,   5,  10,  8 }, { 145, 4,   2,   6,   0,   2,  10, 32 } },  // 101
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10, 33 } },  // 102
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 103
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 104
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 105
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 106
+    { {  35, 2,  12,  16,   0,   8,   6,  9 }, { 145, 5,   4,   8,   0,   4,   4, 10 } },  // 107
+    { {  35, 2,  12,  16,   0,   8,   0, 11 }, { 145, 5,   4,   8,   0,   4,  -2, 12 } },  // 108
+    { {  35, 2,  12,  16,   0,   8,  -6, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 14 } },  // 109
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 16 } },  // 110
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 111
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 112
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 113
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 114
+    { {  35, 3,  10,  12,   0,   5,  -2, 28 }, { 145, 6,  -1,   2,   6,   8,   2, 23 } },  // 115
+    { {  35, 3,  10,  12,   0,   5,   4, 30 }, { 145, 6,  -6,  -4,  12,  12,   8, 25 } },  // 116
+    { {  35, 3,  10,  12,   0,   5,  10,  8 }, { 145, 6, -11,  -6,  12,  12,   8, 34 } },  // 117
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 118
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 119
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 120
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 121
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 122
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 123
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 124
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 125
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 6, -16,  -6,  12,  12,   8, 35 } },  // 126
+    { {  35, 0,   5,   6,   0,   1,   6,  9 }, { 145, 7, -11,   0,  10,   8,   2, 36 } },  // 127
+    { {  35, 0,   3,   6,   0,   0,   0, 11 }, { 145, 7,  -8,   0,  10,   4,   0, 37 } },  // 128
+    { {  35, 0,   3,   6,   0,   0,   0, 13 }, { 145, 7,  -8,   0,  10,   2,   0, 38 } },  // 129
+    { {  35, 0,   3,   6,   0,   0,   0, 15 }, { 145, 7,  -8,   0,  10,   2,   0, 39 } },  // 130
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 7,  -8,   0,  10,   2,   0, 40 } },  // 131
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 7,  -8,   0,  10,   2,   0, 41 } },  // 132
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 7,  -8,   0,  10,   2,   0, 42 } },  // 133
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 7,  -8,   0,  10,   2,   0, 42 } },  // 134
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,  -3,   6,   4,   0,   0,  0 } },  // 135
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   2,   6,   0,   0,   0,  0 } },  // 136
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 137
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 138
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 139
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 140
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 141
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 142
+    { {  35, 4,   2,   6,   0,   2,   6,  2 }, { 145, 3,   8,  12,   0,   4,   6,  1 } },  // 143
+    { {  35, 4,   2,   6,   0,   2,  10,  4 }, { 145, 3,  10,  12,   0,   5,  12,  3 } },  // 144
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  5 } },  // 145
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  7 } },  // 146
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 147
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 148
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 149
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 150
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 151
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 152
+    { {  35, 5,   4,   8,   0,   4,   4, 10 }, { 145, 2,  12,  16,   0,   8,   6,  9 } },  // 153
+    { {  35, 5,   4,   8,   0,   4,  -2, 12 }, { 145, 2,  12,  16,   0,   8,   0, 11 } },  // 154
+    { {  35, 5,   4,   8,   0,   4,  -4, 14 }, { 145, 2,  12,  16,   0,   8,  -6, 21 } },  // 155
+    { {  35, 5,   4,   8,   0,   4,  -4, 16 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 156
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 157
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 158
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 159
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 160
+    { {  35, 6,  -1,   2,   6,   8,   2, 23 }, { 145, 3,  10,  12,   0,   5,  -2, 28 } },  // 161
+    { {  35, 6,  -6,  -4,  12,  12,   8, 25 }, { 145, 3,  10,  12,   0,   5,   4, 30 } },  // 162
+    { {  35, 6, -11,  -6,  12,  12,   8, 34 }, { 145, 3,  10,  12,   0,   5,  10,  8 } },  // 163
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 164
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 165
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 166
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 167
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 168
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 169
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 170
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 171
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 172
+    { {  35, 7, -11,   0,  10,   8,   2, 36 }, { 145, 0,   5,   6,   0,   1,   6,  9 } },  // 173
+    { {  35, 7,  -8,   0,  10,   4,   0, 37 }, { 145, 0,   3,   6,   0,   0,   0, 11 } },  // 174
+    { {  35, 7,  -8,   0,  10,   2,   0, 38 }, { 145, 0,   3,   6,   0,   0,   0, 13 } },  // 175
+    { {  35, 7,  -8,   0,  10,   2,   0, 39 }, { 145, 0,   3,   6,   0,   0,   0, 15 } },  // 176
+    { {  35, 7,  -8,   0,  10,   2,   0, 40 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 177
+    { {  35, 7,  -8,   0,  10,   2,   0, 41 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 178
+    { {  35, 7,  -8,   0,  10,   2,   0, 42 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 179
+    { {  35, 7,  -8,   0,  10,   2,   0, 42 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 180
+    { {  35, 0,  -3,   6,   4,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 181
+    { {  35, 0,   2,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 182
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 183
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 184
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 185
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 186
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 187
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 188
+    { {  35, 3,   8,  12,   0,   4,   6,  1 }, { 145, 4,   2,   6,   0,   2,   6,  2 } },  // 189
+    { {  35, 3,  10,  12,   0,   5,  12,  3 }, { 145, 4,   2,   6,   0,   2,  10,  4 } },  // 190
+    { {  35, 3,  10,  12,   0,   5,  12,  5 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 191
+    { {  35, 3,  10,  12,   0,   5,  12,  7 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 192
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 193
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 194
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 195
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 145, 4,   2,   6,   0,   2,  10,  6 } },  // 196
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 145, 3,   7,  12,   0,   5,  12, 10 } },  // 197
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 145, 3,  10,  12,   0,   5,  12, 12 } },  // 198
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 145, 3,  10,  12,   0,   5,  12, 14 } },  // 199
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 145, 3,  10,  12,   0,   5,  12, 16 } },  // 200
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 145, 3,  10,  12,   0,   5,  12, 18 } },  // 201
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 145, 3,  10,  12,   0,   5,  12, 20 } },  // 202
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 203
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 145, 3,  10,  12,   0,   5,  12,  8 } },  // 204
+    { {  35, 2,   7,  12,   0,   6,   4, 10 }, { 145, 5,   5,   8,   0,   4,   6,  9 } },  // 205
+    { {  35, 2,  12,  16,   0,   8,  -2, 12 }, { 145, 5,   4,   8,   0,   4,   0, 11 } },  // 206
+    { {  35, 2,  12,  16,   0,   8,  -8, 14 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 207
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 208
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 209
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 210
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 211
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 145, 5,   4,   8,   0,   4,  -4, 22 } },  // 212
+    { {  35, 5,   7,  10,   0,   4,  -4, 22 }, { 145, 2,   9,  14,   0,   8,  -8, 21 } },  // 213
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 214
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 215
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 216
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 217
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 218
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 219
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 145, 2,  12,  16,   0,   8,  -8, 21 } },  // 220
+    { {  35, 0,   3,   6,   0,   0,   0, 29 }, { 145, 0,   7,  10,   0,   4,  -2, 24 } },  // 221
+    { {  35, 0,   3,   6,   0,   0,   0, 31 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 222
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 223
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 224
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 225
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 226
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 227
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 228
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 229
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 230
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 231
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 232
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 145, 0,   3,   6,   0,   0,   0,  0 } },  // 233
+};
+
+#define FIGHT_CLASH_COUNT 16
+
+static const FightClash FIGHT_CLASHES[FIGHT_CLASH_COUNT] = {
+    {  15,  90, 104 },
+    {  25,  93, 107 },
+    {  41,  90, 104 },
+    {  51,  93, 132 },
+    {  61,  86, 132 },
+    {  69,  93, 107 },
+    {  77,  85, 107 },
+    {  91,  90, 104 },
+    {  99,  93, 132 },
+    { 107,  93, 107 },
+    { 143,  90, 104 },
+    { 153,  85, 107 },
+    { 189,  90, 104 },
+    { 197,  93, 107 },
+    { 205,  85, 107 },
+    { 213,  93, 132 },
+};
+
+static const SwordAngle FIGHT_SWORDS[43] = {
+    {   9,   2,  48,  12,  24,   6,   5,   1,   3,   1 },  // 75 deg
+    {   9,   0,  49,   0,  24,   0,   5,   0,   3,   0 },  // 89 deg
+    {   8,   4,  43,  24,  21,  12,   5,   2,   3,   1 },  // 61 deg
+    {   9,  -2,  48, -11,  24,  -5,   5,  -1,   3,   0 },  // 103 deg
+    {   7,   6,  36,  34,  18,  17,   4,   4,   2,   2 },  // 47 deg
+    {   8,  -4,  44, -22,  22, -11,   5,  -2,   3,  -1 },  // 117 deg
+    {   7,   7,  35,  35,  17,  17,   4,   4,   2,   2 },  // 45 deg
+    {   7,  -6,  37, -32,  18, -16,   4,  -3,   3,  -2 },  // 131 deg
+    {   7,  -7,  35, -35,  17, -17,   4,  -4,   2,  -2 },  // 135 deg
+    {   8,  -5,  42, -25,  21, -12,   5,  -3,   3,  -2 },  // 121 deg
+    {   8,   5,  42,  25,  21,  12,   5,   3,   3,   2 },  // 59 deg
+    {   9,  -2,  47, -14,  23,  -7,   5,  -1,   3,  -1 },  // 107 deg
+    {   9,   2,  47,  14,  23,   7,   5,   1,   3,   1 },  // 73 deg
+    {   9,   0,  49,  -2,  24,  -1,   5,   0,   3,   0 },  // 93 deg
+    {   9,   0,  49,   2,  24,   1,   5,   0,   3,   0 },  // 87 deg
+    {   9,   1,  49,   9,  24,   4,   5,   1,   3,   0 },  // 79 deg
+    {   9,  -1,  49,  -9,  24,  -4,   5,  -1,   3,   0 },  // 101 deg
+    {   9,   4,  45,  21,  22,  10,   5,   2,   3,   1 },  // 65 deg
+    {   9,  -4,  45, -21,  22, -10,   5,  -2,   3,  -1 },  // 115 deg
+    {   7,   6,  38,  31,  19,  15,   4,   3,   3,   2 },  // 51 deg
+    {   7,  -6,  38, -31,  19, -15,   4,  -3,   3,  -2 },  // 129 deg
+    {   9,   0,  49,  -4,  24,  -2,   5,   0,   3,   0 },  // 95 deg
+    {   9,  -2,  48, -12,  24,  -6,   5,  -1,   3,  -1 },  // 105 deg
+    {   8,  -4,  43, -24,  21, -12,   5,  -2,   3,  -1 },  // 119 deg
+    {   9,   1,  49,   7,  24,   3,   5,   0,   3,   0 },  // 81 deg
+    {   7,  -6,  36, -34,  18, -17,   4,  -4,   2,  -2 },  // 133 deg
+    {   9,   3,  46,  19,  23,   9,   5,   2,   3,   1 },  // 67 deg
+    {   7,   6,  39,  30,  19,  15,   4,   3,   3,   2 },  // 53 deg
+    {   9,  -3,  47, -16,  23,  -8,   5,  -1,   3,  -1 },  // 109 deg
+    {   9,   0,  49,   0,  24,   0,   5,   0,   3,   0 },  // 91 deg
+    {   8,  -5,  41, -27,  20, -13,   5,  -3,   3,  -2 },  // 123 deg
+    {   9,   2,  48,  11,  24,   5,   5,   1,   3,   0 },  // 77 deg
+    {   8,   4,  44,  22,  22,  11,   5,   2,   3,   1 },  // 63 deg
+    {   7,   6,  37,  32,  18,  16,   4,   3,   3,   2 },  // 49 deg
+    {   5,  -8,  27, -41,  13, -20,   3,  -5,   2,  -3 },  // 147 deg
+    {   3,  -9,  17, -46,   8, -23,   2,  -5,   1,  -3 },  // 160 deg
+    {   5,  -8,  27, -41,  13, -20,   3,  -4,   2,  -3 },  // 146 deg
+    {   7,  -6,  37, -33,  18, -16,   4,  -4,   2,  -2 },  // 132 deg
+    {   8,  -4,  44, -23,  22, -11,   5,  -2,   3,  -1 },  // 118 deg
+    {   9,  -2,  48, -12,  24,  -6,   5,  -1,   3,   0 },  // 104 deg
+    {  10,   0,  50,   0,  25,   0,   6,   0,   4,   0 },  // 90 deg
+    {   9,   2,  48,  12,  24,   6,   5,   1,   3,   0 },  // 76 deg
+    {   9,   3,  46,  17,  23,   8,   5,   2,   3,   1 },  // 70 deg
+};
+#else
+#define FIGHT_FRAMES 234
+
+static const FightFrame FIGHT_TABLE[FIGHT_FRAMES] = {
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 0
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 1
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 2
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 3
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 4
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 5
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 6
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 7
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 8
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 9
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 10
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 11
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 12
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 13
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 14
+    { {  35, 3,   8,  12,   0,   4,   6,  1 }, { 109, 4,   2,   6,   0,   2,   6,  2 } },  // 15
+    { {  35, 3,  10,  12,   0,   5,  12,  3 }, { 109, 4,   2,   6,   0,   2,  10,  4 } },  // 16
+    { {  35, 3,  10,  12,   0,   5,  12,  5 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 17
+    { {  35, 3,  10,  12,   0,   5,  12,  7 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 18
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 19
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 20
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 21
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 22
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 23
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 24
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 109, 3,   7,  12,   0,   5,  12, 10 } },  // 25
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 109, 3,  10,  12,   0,   5,  12, 12 } },  // 26
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 109, 3,  10,  12,   0,   5,  12, 14 } },  // 27
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 109, 3,  10,  12,   0,   5,  12, 16 } },  // 28
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 109, 3,  10,  12,   0,   5,  12, 18 } },  // 29
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 109, 3,  10,  12,   0,   5,  12, 20 } },  // 30
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 31
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 32
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 33
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 34
+    { {  35, 0,   3,   6,   0,   0,   4, 10 }, { 109, 0,   5,   6,   0,   1,   6,  9 } },  // 35
+    { {  35, 0,   3,   6,   0,   0,   0, 12 }, { 109, 0,   3,   6,   0,   0,   0, 11 } },  // 36
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0, 13 } },  // 37
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0, 15 } },  // 38
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 39
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 40
+    { {  35, 2,   8,  12,   0,   4,  -6,  1 }, { 109, 5,   4,   8,   0,   4,  -4,  1 } },  // 41
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4,  3 } },  // 42
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 43
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 44
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 45
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 46
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 47
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 48
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 49
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 50
+    { {  35, 5,   7,  10,   0,   4,  -4, 22 }, { 109, 2,   9,  14,   0,   8,  -8, 21 } },  // 51
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 52
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 53
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 54
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 55
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 56
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 57
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 58
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 59
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 60
+    { {  35, 3,   9,  12,   0,   5,   2, 23 }, { 109, 4,   7,  10,   0,   4,  -2, 24 } },  // 61
+    { {  35, 3,  10,  12,   0,   5,   8, 25 }, { 109, 4,   2,   6,   0,   2,   4, 26 } },  // 62
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10, 27 } },  // 63
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 64
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 65
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 66
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 67
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 68
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 109, 3,   7,  12,   0,   5,  12, 10 } },  // 69
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 109, 3,  10,  12,   0,   5,  12, 12 } },  // 70
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 109, 3,  10,  12,   0,   5,  12, 14 } },  // 71
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 109, 3,  10,  12,   0,   5,  12, 16 } },  // 72
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 109, 3,  10,  12,   0,   5,  12, 18 } },  // 73
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 109, 3,  10,  12,   0,   5,  12, 20 } },  // 74
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 75
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 76
+    { {  35, 3,   7,  12,   0,   5,  12, 10 }, { 109, 4,   5,   6,   0,   2,  10,  9 } },  // 77
+    { {  35, 3,  10,  12,   0,   5,  12, 12 }, { 109, 4,   2,   6,   0,   2,  10, 11 } },  // 78
+    { {  35, 3,  10,  12,   0,   5,  12, 14 }, { 109, 4,   2,   6,   0,   2,  10, 13 } },  // 79
+    { {  35, 3,  10,  12,   0,   5,  12, 16 }, { 109, 4,   2,   6,   0,   2,  10, 15 } },  // 80
+    { {  35, 3,  10,  12,   0,   5,  12, 18 }, { 109, 4,   2,   6,   0,   2,  10, 17 } },  // 81
+    { {  35, 3,  10,  12,   0,   5,  12, 20 }, { 109, 4,   2,   6,   0,   2,  10, 19 } },  // 82
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 83
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 84
+    { {  35, 0,   5,   6,   0,   1,   6,  9 }, { 109, 0,   3,   6,   0,   0,   4, 10 } },  // 85
+    { {  35, 0,   3,   6,   0,   0,   0, 11 }, { 109, 0,   3,   6,   0,   0,   0, 12 } },  // 86
+    { {  35, 0,   3,   6,   0,   0,   0, 13 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 87
+    { {  35, 0,   3,   6,   0,   0,   0, 15 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 88
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 89
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 90
+    { {  35, 2,   8,  12,   0,   4,  -6,  1 }, { 109, 5,   4,   8,   0,   4,  -4,  1 } },  // 91
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4,  3 } },  // 92
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 93
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 94
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 95
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 96
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 97
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 98
+    { {  35, 3,  10,  12,   0,   5,  -2, 28 }, { 109, 4,   2,   6,   0,   2,   2, 29 } },  // 99
+    { {  35, 3,  10,  12,   0,   5,   4, 30 }, { 109, 4,   2,   6,   0,   2,   8, 31 } },  // 100
+    { {  35, 3,  10,  12,   0,   5,  10,  8 }, { 109, 4,   2,   6,   0,   2,  10, 32 } },  // 101
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10, 33 } },  // 102
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 103
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 104
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 105
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 106
+    { {  35, 2,  12,  16,   0,   8,   6,  9 }, { 109, 5,   4,   8,   0,   4,   4, 10 } },  // 107
+    { {  35, 2,  12,  16,   0,   8,   0, 11 }, { 109, 5,   4,   8,   0,   4,  -2, 12 } },  // 108
+    { {  35, 2,  12,  16,   0,   8,  -6, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 14 } },  // 109
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 16 } },  // 110
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 111
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 112
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 113
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 114
+    { {  35, 3,  10,  12,   0,   5,  -2, 28 }, { 109, 6,  -1,   2,   6,   8,   2, 23 } },  // 115
+    { {  35, 3,  10,  12,   0,   5,   4, 30 }, { 109, 6,  -6,  -4,  12,  12,   8, 25 } },  // 116
+    { {  35, 3,  10,  12,   0,   5,  10,  8 }, { 109, 6, -11,  -6,  12,  12,   8, 34 } },  // 117
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 118
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 119
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 120
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 121
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 122
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 123
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 124
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 125
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 6, -16,  -6,  12,  12,   8, 35 } },  // 126
+    { {  35, 0,   5,   6,   0,   1,   6,  9 }, { 109, 7, -11,   0,  10,   8,   2, 36 } },  // 127
+    { {  35, 0,   3,   6,   0,   0,   0, 11 }, { 109, 7,  -8,   0,  10,   4,   0, 37 } },  // 128
+    { {  35, 0,   3,   6,   0,   0,   0, 13 }, { 109, 7,  -8,   0,  10,   2,   0, 38 } },  // 129
+    { {  35, 0,   3,   6,   0,   0,   0, 15 }, { 109, 7,  -8,   0,  10,   2,   0, 39 } },  // 130
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 7,  -8,   0,  10,   2,   0, 40 } },  // 131
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 7,  -8,   0,  10,   2,   0, 41 } },  // 132
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 7,  -8,   0,  10,   2,   0, 42 } },  // 133
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 7,  -8,   0,  10,   2,   0, 42 } },  // 134
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,  -3,   6,   4,   0,   0,  0 } },  // 135
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   2,   6,   0,   0,   0,  0 } },  // 136
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 137
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 138
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 139
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 140
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 141
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 142
+    { {  35, 4,   2,   6,   0,   2,   6,  2 }, { 109, 3,   8,  12,   0,   4,   6,  1 } },  // 143
+    { {  35, 4,   2,   6,   0,   2,  10,  4 }, { 109, 3,  10,  12,   0,   5,  12,  3 } },  // 144
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  5 } },  // 145
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  7 } },  // 146
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 147
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 148
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 149
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 150
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 151
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 152
+    { {  35, 5,   4,   8,   0,   4,   4, 10 }, { 109, 2,  12,  16,   0,   8,   6,  9 } },  // 153
+    { {  35, 5,   4,   8,   0,   4,  -2, 12 }, { 109, 2,  12,  16,   0,   8,   0, 11 } },  // 154
+    { {  35, 5,   4,   8,   0,   4,  -4, 14 }, { 109, 2,  12,  16,   0,   8,  -6, 21 } },  // 155
+    { {  35, 5,   4,   8,   0,   4,  -4, 16 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 156
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 157
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 158
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 159
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 160
+    { {  35, 6,  -1,   2,   6,   8,   2, 23 }, { 109, 3,  10,  12,   0,   5,  -2, 28 } },  // 161
+    { {  35, 6,  -6,  -4,  12,  12,   8, 25 }, { 109, 3,  10,  12,   0,   5,   4, 30 } },  // 162
+    { {  35, 6, -11,  -6,  12,  12,   8, 34 }, { 109, 3,  10,  12,   0,   5,  10,  8 } },  // 163
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 164
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 165
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 166
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 167
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 168
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 169
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 170
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 171
+    { {  35, 6, -16,  -6,  12,  12,   8, 35 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 172
+    { {  35, 7, -11,   0,  10,   8,   2, 36 }, { 109, 0,   5,   6,   0,   1,   6,  9 } },  // 173
+    { {  35, 7,  -8,   0,  10,   4,   0, 37 }, { 109, 0,   3,   6,   0,   0,   0, 11 } },  // 174
+    { {  35, 7,  -8,   0,  10,   2,   0, 38 }, { 109, 0,   3,   6,   0,   0,   0, 13 } },  // 175
+    { {  35, 7,  -8,   0,  10,   2,   0, 39 }, { 109, 0,   3,   6,   0,   0,   0, 15 } },  // 176
+    { {  35, 7,  -8,   0,  10,   2,   0, 40 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 177
+    { {  35, 7,  -8,   0,  10,   2,   0, 41 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 178
+    { {  35, 7,  -8,   0,  10,   2,   0, 42 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 179
+    { {  35, 7,  -8,   0,  10,   2,   0, 42 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 180
+    { {  35, 0,  -3,   6,   4,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 181
+    { {  35, 0,   2,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 182
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 183
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 184
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 185
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 186
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 187
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 188
+    { {  35, 3,   8,  12,   0,   4,   6,  1 }, { 109, 4,   2,   6,   0,   2,   6,  2 } },  // 189
+    { {  35, 3,  10,  12,   0,   5,  12,  3 }, { 109, 4,   2,   6,   0,   2,  10,  4 } },  // 190
+    { {  35, 3,  10,  12,   0,   5,  12,  5 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 191
+    { {  35, 3,  10,  12,   0,   5,  12,  7 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 192
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 193
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 194
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 195
+    { {  35, 3,  10,  12,   0,   5,  12,  8 }, { 109, 4,   2,   6,   0,   2,  10,  6 } },  // 196
+    { {  35, 4,   5,   6,   0,   2,  10,  9 }, { 109, 3,   7,  12,   0,   5,  12, 10 } },  // 197
+    { {  35, 4,   2,   6,   0,   2,  10, 11 }, { 109, 3,  10,  12,   0,   5,  12, 12 } },  // 198
+    { {  35, 4,   2,   6,   0,   2,  10, 13 }, { 109, 3,  10,  12,   0,   5,  12, 14 } },  // 199
+    { {  35, 4,   2,   6,   0,   2,  10, 15 }, { 109, 3,  10,  12,   0,   5,  12, 16 } },  // 200
+    { {  35, 4,   2,   6,   0,   2,  10, 17 }, { 109, 3,  10,  12,   0,   5,  12, 18 } },  // 201
+    { {  35, 4,   2,   6,   0,   2,  10, 19 }, { 109, 3,  10,  12,   0,   5,  12, 20 } },  // 202
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 203
+    { {  35, 4,   2,   6,   0,   2,  10,  6 }, { 109, 3,  10,  12,   0,   5,  12,  8 } },  // 204
+    { {  35, 2,   7,  12,   0,   6,   4, 10 }, { 109, 5,   5,   8,   0,   4,   6,  9 } },  // 205
+    { {  35, 2,  12,  16,   0,   8,  -2, 12 }, { 109, 5,   4,   8,   0,   4,   0, 11 } },  // 206
+    { {  35, 2,  12,  16,   0,   8,  -8, 14 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 207
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 208
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 209
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 210
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 211
+    { {  35, 2,  12,  16,   0,   8,  -8, 21 }, { 109, 5,   4,   8,   0,   4,  -4, 22 } },  // 212
+    { {  35, 5,   7,  10,   0,   4,  -4, 22 }, { 109, 2,   9,  14,   0,   8,  -8, 21 } },  // 213
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 214
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 215
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 216
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 217
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 218
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 219
+    { {  35, 5,   4,   8,   0,   4,  -4, 22 }, { 109, 2,  12,  16,   0,   8,  -8, 21 } },  // 220
+    { {  35, 0,   3,   6,   0,   0,   0, 29 }, { 109, 0,   7,  10,   0,   4,  -2, 24 } },  // 221
+    { {  35, 0,   3,   6,   0,   0,   0, 31 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 222
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 223
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 224
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 225
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 226
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 227
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 228
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 229
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 230
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 231
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 232
+    { {  35, 0,   3,   6,   0,   0,   0,  0 }, { 109, 0,   3,   6,   0,   0,   0,  0 } },  // 233
+};
+
+#define FIGHT_CLASH_COUNT 16
+
+static const FightClash FIGHT_CLASHES[FIGHT_CLASH_COUNT] = {
+    {  15,  72,  96 },
+    {  25,  75,  95 },
+    {  41,  72,  96 },
+    {  51,  76, 121 },
+    {  61,  67, 121 },
+    {  69,  75,  95 },
+    {  77,  67,  95 },
+    {  91,  72,  96 },
+    {  99,  76, 121 },
+    { 107,  75,  95 },
+    { 143,  72,  96 },
+    { 153,  67,  95 },
+    { 189,  72,  96 },
+    { 197,  75,  95 },
+    { 205,  67,  95 },
+    { 213,  76, 121 },
+};
+
+static const SwordAngle FIGHT_SWORDS[43] = {
+    {   9,   2,  48,  12,  24,   6,   5,   1,   3,   1 },  // 75 deg
+    {   9,   0,  49,   0,  24,   0,   5,   0,   3,   0 },  // 89 deg
+    {   8,   4,  43,  24,  21,  12,   5,   2,   3,   1 },  // 61 deg
+    {   9,  -2,  48, -11,  24,  -5,   5,  -1,   3,   0 },  // 103 deg
+    {   7,   6,  36,  34,  18,  17,   4,   4,   2,   2 },  // 47 deg
+    {   8,  -4,  44, -22,  22, -11,   5,  -2,   3,  -1 },  // 117 deg
+    {   7,   7,  35,  35,  17,  17,   4,   4,   2,   2 },  // 45 deg
+    {   7,  -6,  37, -32,  18, -16,   4,  -3,   3,  -2 },  // 131 deg
+    {   7,  -7,  35, -35,  17, -17,   4,  -4,   2,  -2 },  // 135 deg
+    {   8,  -5,  42, -25,  21, -12,   5,  -3,   3,  -2 },  // 121 deg
+    {   8,   5,  42,  25,  21,  12,   5,   3,   3,   2 },  // 59 deg
+    {   9,  -2,  47, -14,  23,  -7,   5,  -1,   3,  -1 },  // 107 deg
+    {   9,   2,  47,  14,  23,   7,   5,   1,   3,   1 },  // 73 deg
+    {   9,   0,  49,  -2,  24,  -1,   5,   0,   3,   0 },  // 93 deg
+    {   9,   0,  49,   2,  24,   1,   5,   0,   3,   0 },  // 87 deg
+    {   9,   1,  49,   9,  24,   4,   5,   1,   3,   0 },  // 79 deg
+    {   9,  -1,  49,  -9,  24,  -4,   5,  -1,   3,   0 },  // 101 deg
+    {   9,   4,  45,  21,  22,  10,   5,   2,   3,   1 },  // 65 deg
+    {   9,  -4,  45, -21,  22, -10,   5,  -2,   3,  -1 },  // 115 deg
+    {   7,   6,  38,  31,  19,  15,   4,   3,   3,   2 },  // 51 deg
+    {   7,  -6,  38, -31,  19, -15,   4,  -3,   3,  -2 },  // 129 deg
+    {   9,   0,  49,  -4,  24,  -2,   5,   0,   3,   0 },  // 95 deg
+    {   9,  -2,  48, -12,  24,  -6,   5,  -1,   3,  -1 },  // 105 deg
+    {   8,  -4,  43, -24,  21, -12,   5,  -2,   3,  -1 },  // 119 deg
+    {   9,   1,  49,   7,  24,   3,   5,   0,   3,   0 },  // 81 deg
+    {   7,  -6,  36, -34,  18, -17,   4,  -4,   2,  -2 },  // 133 deg
+    {   9,   3,  46,  19,  23,   9,   5,   2,   3,   1 },  // 67 deg
+    {   7,   6,  39,  30,  19,  15,   4,   3,   3,   2 },  // 53 deg
+    {   9,  -3,  47, -16,  23,  -8,   5,  -1,   3,  -1 },  // 109 deg
+    {   9,   0,  49,   0,  24,   0,   5,   0,   3,   0 },  // 91 deg
+    {   8,  -5,  41, -27,  20, -13,   5,  -3,   3,  -2 },  // 123 deg
+    {   9,   2,  48,  11,  24,   5,   5,   1,   3,   0 },  // 77 deg
+    {   8,   4,  44,  22,  22,  11,   5,   2,   3,   1 },  // 63 deg
+    {   7,   6,  37,  32,  18,  16,   4,   3,   3,   2 },  // 49 deg
+    {   5,  -8,  27, -41,  13, -20,   3,  -5,   2,  -3 },  // 147 deg
+    {   3,  -9,  17, -46,   8, -23,   2,  -5,   1,  -3 },  // 160 deg
+    {   5,  -8,  27, -41,  13, -20,   3,  -4,   2,  -3 },  // 146 deg
+    {   7,  -6,  37, -33,  18, -16,   4,  -4,   2,  -2 },  // 132 deg
+    {   8,  -4,  44, -23,  22, -11,   5,  -2,   3,  -1 },  // 118 deg
+    {   9,  -2,  48, -12,  24,  -6,   5,  -1,   3,   0 },  // 104 deg
+    {  10,   0,  50,   0,  25,   0,   6,   0,   4,   0 },  // 90 deg
+    {   9,   2,  48,  12,  24,   6,   5,   1,   3,   0 },  // 76 deg
+    {   9,   3,  46,  17,  23,   8,   5,   2,   3,   1 },  // 70 deg
+};
+#endif
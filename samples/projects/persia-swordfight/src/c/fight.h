@@ -0,0 +1,92 @@
+#pragma once
+
+#include <pebble.h>
+
+// ===========================================================================
+// SHARED BY main.c AND fight_bake.c (the choreography simulation)
+// ===========================================================================
+
+#ifdef PBL_ROUND
+    #define SCREEN_W 180
+    #define SCREEN_H 180
+    #define GROUND_Y 162
+    #define PRINCE_X 55
+    #define GUARD_X 125
+#else
+    #define SCREEN_W 144
+    #define SCREEN_H 168
+    #define GROUND_Y 150
+    #define PRINCE_X 38
+    #define GUARD_X 106
+#endif
+
+// ===========================================================================
+// POSE SYSTEM - Target values that we interpolate toward
+// ===========================================================================
+typedef struct {
+    int16_t lean;       // Body lean
+    int16_t step_fwd;   // Front foot forward
+    int16_t step_back;  // Back foot back
+    int16_t crouch;     // Crouch amount
+    int16_t sword_ang;  // Sword angle (degrees)
+    int16_t arm_raise;  // Arm height offset
+} PoseData;
+
+// All pose definitions - Angles: 0=UP, 90=horizontal, 180=DOWN
+// For proper X-clash: attacker swings DOWN (>90), blocker catches UP (<90)
+static const PoseData POSES[] = {
+    // P_READY - neutral guard position
+    {3, 6, 0, 0, 75, 0},
+    // P_STEP_FWD - advancing
+    {6, 10, 0, 3, 80, -2},
+    // P_THRUST - horizontal lunge
+    {12, 16, 0, 8, 95, -8},
+    // P_SLASH - BIG DOWNWARD SWING (angle > 90 = tip below hand)
+    {10, 12, 0, 5, 135, 12},
+    // P_BLOCK_HIGH - sword UP to catch downward slash (angle < 90)
+    {2, 6, 0, 2, 45, 10},
+    // P_BLOCK_LOW - parry low (angle slightly > 90)
+    {4, 8, 0, 4, 105, -4},
+    // P_STRUCK - reeling back, sword wild
+    {-16, -6, 12, 12, 160, 8},
+    // P_STEP_BACK - retreating
+    {-8, 0, 10, 2, 70, 0},
+};
+
+typedef enum {
+    P_READY, P_STEP_FWD, P_THRUST, P_SLASH,
+    P_BLOCK_H, P_BLOCK_L, P_STRUCK, P_STEP_BACK
+} Pose;
+#define NUM_POSES ((int)(sizeof(POSES) / sizeof(POSES[0])))
+
+// ===========================================================================
+// BAKED FIGHT TABLE - one loop of the choreography, see baked_tables.h
+// ===========================================================================
+
+// One fighter on one frame: interpolated body values and sword index
+typedef struct {
+    uint8_t x;
+    uint8_t pose;
+    int8_t lean, step_fwd, step_back, crouch, arm_raise;
+    uint8_t sword;          // FIGHT_SWORDS entry for the current sword angle
+} FighterKey;
+
+typedef struct {
+    FighterKey prince, guard;
+} FightFrame;
+
+// Blades cross on `frame`: sparks start at x, y
+typedef struct {
+    uint16_t frame;
+    int16_t x, y;
+} FightClash;
+
+// trig(sword angle) * length / TRIG_MAX_RATIO for each sword arm segment,
+// facing right; x terms flip with the fighter's direction
+typedef struct {
+    int8_t sin10, cos10;    // Upper arm, forearm
+    int8_t sin50, cos50;    // Blade
+    int8_t sin25, cos25;    // Blade highlight start
+    int8_t sin6, cos6;      // Crossguard half width
+    int8_t sin4, cos4;      // Pommel
+} SwordAngle;
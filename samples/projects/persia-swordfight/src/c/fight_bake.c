@@ -0,0 +1,330 @@
+// ===========================================================================
+// FIGHT BAKE - simulates the choreography into baked_tables.h
+//
+// Only built by scripts/bake_tables.py (TABLE_BAKE defined): the watch
+// reads the generated tables instead of interpolating poses, solving sword
+// trig and intersecting blades every frame. Re-bake after changing POSES,
+// s_seq or the sword geometry here:
+//     python3 scripts/bake_tables.py samples/projects/persia-swordfight
+// ===========================================================================
+#if defined(TABLE_BAKE)
+
+#include <pebble.h>
+#include "fight.h"
+
+typedef struct {
+    Pose prince;
+    Pose guard;
+    int16_t dur;
+    bool clash;
+} Move;
+
+// ===========================================================================
+// CHOREOGRAPHY - Attack vs Block for X-shaped sword clashes!
+// ===========================================================================
+static const Move s_seq[] = {
+    // Opening stance
+    {P_READY, P_READY, 16, false},
+
+    // Prince SLASHES down, Guard BLOCKS high - X CLASH!
+    {P_SLASH, P_BLOCK_H, 10, true},
+
+    // Guard counters with slash, Prince blocks - X CLASH!
+    {P_BLOCK_H, P_SLASH, 10, true},
+
+    // Quick ready
+    {P_READY, P_READY, 6, false},
+
+    // Prince thrusts low, Guard parries - CLASH!
+    {P_THRUST, P_BLOCK_L, 10, true},
+
+    // Guard thrusts, Prince parries - CLASH!
+    {P_BLOCK_L, P_THRUST, 10, true},
+
+    // Flurry! Alternating slashes and blocks
+    {P_SLASH, P_BLOCK_H, 8, true},
+    {P_BLOCK_H, P_SLASH, 8, true},
+    {P_SLASH, P_BLOCK_H, 8, true},
+
+    // Brief pause
+    {P_READY, P_READY, 6, false},
+
+    // Prince gets aggressive - rapid attacks!
+    {P_THRUST, P_BLOCK_L, 8, true},
+    {P_SLASH, P_BLOCK_H, 8, true},
+    {P_THRUST, P_BLOCK_L, 8, true},
+
+    // Guard gets HIT!
+    {P_SLASH, P_STRUCK, 12, false},
+    {P_READY, P_STEP_BACK, 8, false},
+
+    // Guard recovers and counters
+    {P_READY, P_READY, 8, false},
+    {P_BLOCK_H, P_SLASH, 10, true},
+    {P_BLOCK_L, P_THRUST, 8, true},
+
+    // Prince gets HIT!
+    {P_STRUCK, P_SLASH, 12, false},
+    {P_STEP_BACK, P_READY, 8, false},
+
+    // Final exchange
+    {P_READY, P_READY, 8, false},
+    {P_SLASH, P_BLOCK_H, 8, true},
+    {P_BLOCK_H, P_SLASH, 8, true},
+    {P_THRUST, P_BLOCK_L, 8, true},
+    {P_BLOCK_L, P_THRUST, 8, true},
+
+    // Reset
+    {P_READY, P_READY, 12, false},
+};
+// Use compile-time array length to prevent mismatches
+#define NUM_SEQ ((int)(sizeof(s_seq) / sizeof(s_seq[0])))
+
+typedef struct {
+    int16_t x;
+    int8_t dir;
+    Pose pose;
+    // Current interpolated values
+    int16_t cur_lean, cur_step_fwd, cur_step_back, cur_crouch;
+    int16_t cur_sword_ang, cur_arm_raise;
+} SimFighter;
+
+static SimFighter s_prince, s_guard;
+static int s_seq_idx = 0, s_seq_frame = 0;
+
+#define MAX_SWORDS 64
+static int16_t s_sword_angs[MAX_SWORDS];
+static int s_num_swords = 0;
+
+// ===========================================================================
+// SMOOTH INTERPOLATION
+// ===========================================================================
+static int16_t lerp(int16_t current, int16_t target, int16_t speed) {
+    int16_t diff = target - current;
+    if (diff > speed) return current + speed;
+    if (diff < -speed) return current - speed;
+    return target;
+}
+
+static void update_fighter_interpolation(SimFighter *f) {
+    PoseData target = POSES[f->pose];
+    int16_t spd = 4;  // Faster body movement
+
+    f->cur_lean = lerp(f->cur_lean, target.lean, spd + 1);
+    f->cur_step_fwd = lerp(f->cur_step_fwd, target.step_fwd, spd + 2);
+    f->cur_step_back = lerp(f->cur_step_back, target.step_back, spd + 2);
+    f->cur_crouch = lerp(f->cur_crouch, target.crouch, spd);
+    f->cur_sword_ang = lerp(f->cur_sword_ang, target.sword_ang, 14);  // Fast sword!
+    f->cur_arm_raise = lerp(f->cur_arm_raise, target.arm_raise, spd + 2);
+}
+
+// ===========================================================================
+// SWORD GEOMETRY (draw_sword_arm reads the same numbers from FIGHT_SWORDS)
+// ===========================================================================
+static SwordAngle sword_angle(int16_t sword_ang) {
+    int32_t ang = (sword_ang * TRIG_MAX_ANGLE) / 360;
+    int32_t s = sin_lookup(ang), c = cos_lookup(ang);
+    return (SwordAngle){
+        s * 10 / TRIG_MAX_RATIO, c * 10 / TRIG_MAX_RATIO,
+        s * 50 / TRIG_MAX_RATIO, c * 50 / TRIG_MAX_RATIO,
+        s * 25 / TRIG_MAX_RATIO, c * 25 / TRIG_MAX_RATIO,
+        s * 6 / TRIG_MAX_RATIO, c * 6 / TRIG_MAX_RATIO,
+        s * 4 / TRIG_MAX_RATIO, c * 4 / TRIG_MAX_RATIO,
+    };
+}
+
+static void compute_sword_points(const SimFighter *f, GPoint *hand, GPoint *tip) {
+    int d = f->dir;
+    int cx = f->x + f->cur_lean * d;
+    int cy = GROUND_Y + f->cur_crouch;
+    int shoulder_y = cy - 52;
+
+    // Sword arm origin, then upper arm + forearm to the hand, then the blade
+    int sarm_x = cx + 6 * d;
+    int sarm_y = shoulder_y + 5 - f->cur_arm_raise;
+    SwordAngle a = sword_angle(f->cur_sword_ang);
+    int hand_x = sarm_x + 2 * d * a.sin10;
+    int hand_y = sarm_y - 2 * a.cos10;
+
+    if (hand) *hand = (GPoint){ hand_x, hand_y };
+    if (tip) *tip = (GPoint){ hand_x + d * a.sin50, hand_y - a.cos50 };
+}
+
+static bool line_intersect(GPoint a1, GPoint a2, GPoint b1, GPoint b2, int16_t *ix, int16_t *iy) {
+    // Integer line intersection using determinants
+    int32_t x1 = a1.x, y1 = a1.y;
+    int32_t x2 = a2.x, y2 = a2.y;
+    int32_t x3 = b1.x, y3 = b1.y;
+    int32_t x4 = b2.x, y4 = b2.y;
+
+    int32_t den = (x1 - x2) * (y3 - y4) - (y1 - y2) * (x3 - x4);
+    if (den == 0) return false;
+
+    int32_t t_num = (x1 - x3) * (y3 - y4) - (y1 - y3) * (x3 - x4);
+    int32_t u_num = (x1 - x3) * (y1 - y2) - (y1 - y3) * (x1 - x2);
+
+    // Intersection point
+    int32_t ix32 = x1 * den + t_num * (x2 - x1);
+    int32_t iy32 = y1 * den + t_num * (y2 - y1);
+
+    // Determine if within segments: 0 <= t,u <= den, considering sign of den
+    bool within_t = (den > 0) ? (t_num >= 0 && t_num <= den) : (t_num <= 0 && t_num >= den);
+    bool within_u = (den > 0) ? (u_num >= 0 && u_num <= den) : (u_num <= 0 && u_num >= den);
+
+    if (within_t && within_u) {
+        if (ix) *ix = (int16_t)(ix32 / den);
+        if (iy) *iy = (int16_t)(iy32 / den);
+        return true;
+    }
+    return false;
+}
+
+// ===========================================================================
+// SIMULATION - the old per-frame update_anim, minus sparks and shake
+// ===========================================================================
+static void init_fighter(SimFighter *f, int16_t x, int8_t dir) {
+    PoseData p = POSES[P_READY];
+    *f = (SimFighter){
+        .x = x, .dir = dir, .pose = P_READY,
+        .cur_lean = p.lean, .cur_step_fwd = p.step_fwd, .cur_step_back = p.step_back,
+        .cur_crouch = p.crouch, .cur_sword_ang = p.sword_ang, .cur_arm_raise = p.arm_raise,
+    };
+}
+
+static void clamp_fighters(void) {
+    // Hard bounds - keep separate, swords meet in middle!
+    if (s_prince.x < 30) s_prince.x = 30;
+    if (s_prince.x > SCREEN_W/2 - 20) s_prince.x = SCREEN_W/2 - 20;
+    if (s_guard.x > SCREEN_W - 30) s_guard.x = SCREEN_W - 30;
+    if (s_guard.x < SCREEN_W/2 + 20) s_guard.x = SCREEN_W/2 + 20;
+}
+
+// One frame; true if the blades clash on it, with the spark origin
+static bool fight_step(GPoint *spark) {
+    bool clash = false;
+    s_seq_frame++;
+
+    if (s_seq_frame >= s_seq[s_seq_idx].dur) {
+        s_seq_frame = 0;
+        s_seq_idx = (s_seq_idx + 1) % NUM_SEQ;
+        clamp_fighters();
+
+        Move next = s_seq[s_seq_idx];
+        s_prince.pose = next.prince;
+        s_guard.pose = next.guard;
+
+        if (next.clash) {
+            // Compute where blades cross for spark position
+            GPoint p_hand, p_tip, g_hand, g_tip;
+            compute_sword_points(&s_prince, &p_hand, &p_tip);
+            compute_sword_points(&s_guard, &g_hand, &g_tip);
+
+            int16_t ix = 0, iy = 0;
+            if (line_intersect(p_hand, p_tip, g_hand, g_tip, &ix, &iy)) {
+                *spark = GPoint(ix, iy);
+            } else {
+                // Fallback: average mid-blade points
+                GPoint p_mid = (GPoint){ (p_hand.x + p_tip.x) / 2, (p_hand.y + p_tip.y) / 2 };
+                GPoint g_mid = (GPoint){ (g_hand.x + g_tip.x) / 2, (g_hand.y + g_tip.y) / 2 };
+                *spark = GPoint((p_mid.x + g_mid.x) / 2, (p_mid.y + g_mid.y) / 2);
+            }
+            clash = true;
+        }
+    }
+
+    // Smooth interpolation every frame
+    update_fighter_interpolation(&s_prince);
+    update_fighter_interpolation(&s_guard);
+
+    // Movement - keep them on screen and close!
+    if (s_prince.pose == P_STEP_FWD && s_prince.x < s_guard.x - 20) s_prince.x += 1;
+    else if (s_prince.pose == P_STEP_BACK && s_prince.x > 35) s_prince.x -= 1;
+    else if (s_prince.pose == P_STRUCK && s_prince.x > 35) s_prince.x -= 1;
+
+    if (s_guard.pose == P_STEP_FWD && s_guard.x > s_prince.x + 20) s_guard.x -= 1;
+    else if (s_guard.pose == P_STEP_BACK && s_guard.x < SCREEN_W - 35) s_guard.x += 1;
+    else if (s_guard.pose == P_STRUCK && s_guard.x < SCREEN_W - 35) s_guard.x += 1;
+
+    clamp_fighters();
+    return clash;
+}
+
+// ===========================================================================
+// OUTPUT
+// ===========================================================================
+static int sword_index(int16_t sword_ang) {
+    for (int i = 0; i < s_num_swords; i++) {
+        if (s_sword_angs[i] == sword_ang) return i;
+    }
+    if (s_num_swords == MAX_SWORDS) {
+        fprintf(stderr, "more than %d sword angles\n", MAX_SWORDS);
+        exit(1);
+    }
+    s_sword_angs[s_num_swords] = sword_ang;
+    return s_num_swords++;
+}
+
+static void print_key(const SimFighter *f) {
+    printf("{ %3d, %d, %3d, %3d, %3d, %3d, %3d, %2d }", f->x, f->pose, f->cur_lean, f->cur_step_fwd,
+           f->cur_step_back, f->cur_crouch, f->cur_arm_raise, sword_index(f->cur_sword_ang));
+}
+
+static bool same_state(const SimFighter *p, const SimFighter *g, int idx, int frame) {
+    return !memcmp(p, &s_prince, sizeof(SimFighter)) && !memcmp(g, &s_guard, sizeof(SimFighter)) &&
+           idx == s_seq_idx && frame == s_seq_frame;
+}
+
+void table_bake(void) {
+    int loop_frames = 0;
+    for (int i = 0; i < NUM_SEQ; i++) loop_frames += s_seq[i].dur;
+
+    init_fighter(&s_prince, PRINCE_X, 1);
+    init_fighter(&s_guard, GUARD_X, -1);
+
+    // Run whole loops until one ends where it started (positions settle
+    // against the clamps); that loop is what the watch replays
+    GPoint spark;
+    bool periodic = false;
+    for (int loop = 0; loop < 32 && !periodic; loop++) {
+        SimFighter p = s_prince, g = s_guard;
+        int idx = s_seq_idx, frame = s_seq_frame;
+        for (int i = 0; i < loop_frames; i++) fight_step(&spark);
+        periodic = same_state(&p, &g, idx, frame);
+    }
+    if (!periodic) {
+        fprintf(stderr, "choreography never repeats\n");
+        exit(1);
+    }
+
+    FightClash clashes[loop_frames];
+    int num_clashes = 0;
+    printf("#define FIGHT_FRAMES %d\n\n", loop_frames);
+    printf("static const FightFrame FIGHT_TABLE[FIGHT_FRAMES] = {\n");
+    for (int i = 0; i < loop_frames; i++) {
+        if (fight_step(&spark)) clashes[num_clashes++] = (FightClash){ i, spark.x, spark.y };
+        printf("    { ");
+        print_key(&s_prince);
+        printf(", ");
+        print_key(&s_guard);
+        printf(" },  // %d\n", i);
+    }
+    printf("};\n\n");
+
+    printf("#define FIGHT_CLASH_COUNT %d\n\n", num_clashes);
+    printf("static const FightClash FIGHT_CLASHES[FIGHT_CLASH_COUNT] = {\n");
+    for (int i = 0; i < num_clashes; i++) {
+        printf("    { %3d, %3d, %3d },\n", clashes[i].frame, clashes[i].x, clashes[i].y);
+    }
+    printf("};\n\n");
+
+    printf("static const SwordAngle FIGHT_SWORDS[%d] = {\n", s_num_swords);
+    for (int i = 0; i < s_num_swords; i++) {
+        SwordAngle a = sword_angle(s_sword_angs[i]);
+        printf("    { %3d, %3d, %3d, %3d, %3d, %3d, %3d, %3d, %3d, %3d },  // %d deg\n",
+               a.sin10, a.cos10, a.sin50, a.cos50, a.sin25, a.cos25, a.sin6, a.cos6, a.sin4, a.cos4,
+               s_sword_angs[i]);
+    }
+    printf("};\n");
+}
+
+#endif
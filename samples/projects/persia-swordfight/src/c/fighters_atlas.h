@@ -0,0 +1,25 @@
+// Generated by create_sprite_atlas.py from g_sprite_bake - do not edit
+#pragma once
+
+#include "lib/sprite_atlas.h"
+
+#define FIGHTERS_COUNT 16
+
+static const SpriteFrame FIGHTERS_FRAMES[16] = {
+    {   0,   0,  27,  74,  -11,  -72 },  // 0
+    {  28,   0,  27,  74,   -9,  -69 },  // 1
+    {  56,   0,  33,  74,  -10,  -64 },  // 2
+    {  90,   0,  30,  74,   -9,  -67 },  // 3
+    { 121,   0,  28,  74,  -12,  -70 },  // 4
+    { 150,   0,  27,  74,  -10,  -68 },  // 5
+    { 178,   0,  40,  74,  -30,  -60 },  // 6
+    { 219,   0,  35,  74,  -22,  -70 },  // 7
+    { 255,   0,  25,  73,  -14,  -72 },  // 8
+    { 281,   0,  25,  73,  -16,  -69 },  // 9
+    { 307,   0,  32,  73,  -21,  -64 },  // 10
+    { 340,   0,  28,  73,  -19,  -67 },  // 11
+    { 369,   0,  26,  73,  -14,  -70 },  // 12
+    { 396,   0,  25,  73,  -15,  -68 },  // 13
+    { 422,   0,  38,  73,   -8,  -60 },  // 14
+    { 461,   0,  33,  73,  -11,  -70 },  // 15
+};
@@ -0,0 +1,60 @@
+/**
+ * Background Cache
+ *
+ * Renders static scenery (sky, ground, buildings...) once into an offscreen
+ * bitmap and blits it every frame instead of redrawing it shape by shape.
+ *
+ * Pebble has no offscreen GContext, so the cache is built from inside the
+ * canvas update proc: the scenery is drawn into the frame buffer as usual,
+ * then the frame buffer is captured and copied into the cache bitmap. The
+ * canvas layer must therefore cover the window at origin (0, 0).
+ *
+ * Optional overlay: static art that sits IN FRONT of the animated sprites
+ * (e.g. a ground strip the monkeys drop behind) can be cached as well. It is
+ * rendered twice, once over black and once over white; pixels that differ
+ * are the ones the art didn't cover and become transparent.
+ *
+ * Usage:
+ *     s_bg_cache = bg_cache_create(draw_scenery);          // window load
+ *     bg_cache_draw(s_bg_cache, ctx, bounds);              // update proc
+ *     ...draw sprites...
+ *     bg_cache_draw_overlay(s_bg_cache, ctx);              // optional
+ *     bg_cache_invalidate(s_bg_cache);                     // tick, obstruction
+ *     bg_cache_destroy(s_bg_cache);                        // window unload
+ *
+ * bg_cache_draw() honours layer clipping, so drawing from a small clip layer
+ * (see dirty_tracker.h) only restores the pixels under that layer.
+ *
+ * If the bitmaps can't be allocated (aplite heap), the cache falls back to
+ * calling the draw procs directly every frame.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+// Draws static art covering `bounds`. Must paint every pixel it owns and
+// must not depend on animation state.
+typedef void (*BgCacheDrawProc)(GContext *ctx, GRect bounds);
+
+typedef struct BgCache BgCache;
+
+BgCache *bg_cache_create(BgCacheDrawProc draw_proc);
+void bg_cache_destroy(BgCache *cache);
+
+// Static art drawn over the sprites, confined to `frame` (screen coordinates).
+void bg_cache_set_overlay(BgCache *cache, GRect frame, BgCacheDrawProc overlay_proc);
+
+// Forces a rebuild on the next bg_cache_draw() (new minute, battery change,
+// unobstructed area change...).
+void bg_cache_invalidate(BgCache *cache);
+
+// False until the next bg_cache_draw() has rebuilt the cache. A rebuild
+// needs a full-screen draw, so combine with dirty_tracker_mark_all().
+bool bg_cache_is_valid(const BgCache *cache);
+
+// Paints the cached background into `bounds`, rebuilding it first if needed.
+void bg_cache_draw(BgCache *cache, GContext *ctx, GRect bounds);
+
+// Paints the cached overlay. Call after the animated sprites.
+void bg_cache_draw_overlay(BgCache *cache, GContext *ctx);
@@ -0,0 +1,196 @@
+/**
+ * Draw Batch - see draw_batch.h
+ */
+
+#include <pebble.h>
+#include "draw_batch.h"
+
+typedef enum {
+    OP_FILL_RECT,
+    OP_FILL_CIRCLE,
+    OP_DRAW_CIRCLE,
+    OP_LINE,
+    OP_PIXEL,
+} DrawOp;
+
+// Sort key: layer, then fill/stroke, then color, then stroke width, so one
+// integer compare orders the list and equal keys share all context state
+#define KEY_STROKE (1u << 16)
+#define KEY(layer, stroke, color, width) \
+    (((uint32_t)(layer) << 24) | ((stroke) ? KEY_STROKE : 0) | ((uint32_t)(color).argb << 8) | (width))
+#define KEY_COLOR(key) ((GColor){ .argb = ((key) >> 8) & 0xFF })
+#define KEY_WIDTH(key) ((key) & 0xFF)
+
+typedef struct {
+    uint32_t key;
+    int16_t a, b, c, d;         // Rect x/y/w/h, circle x/y/r, line x0/y0/x1/y1
+    uint8_t op;
+    uint8_t radius;             // Fill rect corner radius
+} DrawCommand;
+
+struct DrawBatch {
+    GContext *ctx;
+    uint8_t capacity;
+    uint8_t count;
+    uint8_t layer;
+    uint8_t *order;             // Sorted indices into commands, after the array
+    DrawCommand commands[];
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static DrawCommand *prv_push(DrawBatch *batch, DrawOp op, bool stroke, GColor color, uint8_t width) {
+    if (!batch || !batch->ctx) return NULL;
+    if (batch->count == batch->capacity) draw_batch_flush(batch);
+
+    DrawCommand *cmd = &batch->commands[batch->count++];
+    cmd->key = KEY(batch->layer, stroke, color, width);
+    cmd->op = op;
+    return cmd;
+}
+
+// Stable insertion sort of indices; lists are short and mostly in order
+static void prv_sort(DrawBatch *batch) {
+    uint8_t *order = batch->order;
+    for (int i = 0; i < batch->count; i++) {
+        order[i] = i;
+    }
+    for (int i = 1; i < batch->count; i++) {
+        uint8_t idx = order[i];
+        uint32_t key = batch->commands[idx].key;
+        int j = i;
+        while (j > 0 && batch->commands[order[j - 1]].key > key) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = idx;
+    }
+}
+
+static void prv_draw(GContext *ctx, const DrawCommand *cmd) {
+    switch (cmd->op) {
+        case OP_FILL_RECT:
+            graphics_fill_rect(ctx, GRect(cmd->a, cmd->b, cmd->c, cmd->d), cmd->radius,
+                               cmd->radius ? GCornersAll : GCornerNone);
+            break;
+        case OP_FILL_CIRCLE:
+            graphics_fill_circle(ctx, GPoint(cmd->a, cmd->b), cmd->c);
+            break;
+        case OP_DRAW_CIRCLE:
+            graphics_draw_circle(ctx, GPoint(cmd->a, cmd->b), cmd->c);
+            break;
+        case OP_LINE:
+            graphics_draw_line(ctx, GPoint(cmd->a, cmd->b), GPoint(cmd->c, cmd->d));
+            break;
+        case OP_PIXEL:
+            graphics_draw_pixel(ctx, GPoint(cmd->a, cmd->b));
+            break;
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+DrawBatch *draw_batch_create(uint8_t capacity) {
+    DrawBatch *batch = calloc(1, sizeof(DrawBatch) + capacity * (sizeof(DrawCommand) + 1));
+    if (!batch) return NULL;
+    batch->capacity = capacity;
+    batch->order = (uint8_t *)&batch->commands[capacity];
+    return batch;
+}
+
+void draw_batch_destroy(DrawBatch *batch) {
+    free(batch);
+}
+
+void draw_batch_begin(DrawBatch *batch, GContext *ctx) {
+    if (!batch) return;
+    batch->ctx = ctx;
+    batch->count = 0;
+    batch->layer = 0;
+}
+
+void draw_batch_set_layer(DrawBatch *batch, uint8_t layer) {
+    if (batch) batch->layer = layer;
+}
+
+void draw_batch_fill_rect(DrawBatch *batch, GRect rect, uint8_t corner_radius, GColor color) {
+    DrawCommand *cmd = prv_push(batch, OP_FILL_RECT, false, color, 0);
+    if (!cmd) return;
+    cmd->a = rect.origin.x;
+    cmd->b = rect.origin.y;
+    cmd->c = rect.size.w;
+    cmd->d = rect.size.h;
+    cmd->radius = corner_radius;
+}
+
+void draw_batch_fill_circle(DrawBatch *batch, GPoint center, uint16_t radius, GColor color) {
+    DrawCommand *cmd = prv_push(batch, OP_FILL_CIRCLE, false, color, 0);
+    if (!cmd) return;
+    cmd->a = center.x;
+    cmd->b = center.y;
+    cmd->c = radius;
+}
+
+void draw_batch_draw_circle(DrawBatch *batch, GPoint center, uint16_t radius, GColor color,
+                            uint8_t stroke_width) {
+    DrawCommand *cmd = prv_push(batch, OP_DRAW_CIRCLE, true, color, stroke_width ? stroke_width : 1);
+    if (!cmd) return;
+    cmd->a = center.x;
+    cmd->b = center.y;
+    cmd->c = radius;
+}
+
+void draw_batch_line(DrawBatch *batch, GPoint p0, GPoint p1, GColor color, uint8_t stroke_width) {
+    DrawCommand *cmd = prv_push(batch, OP_LINE, true, color, stroke_width ? stroke_width : 1);
+    if (!cmd) return;
+    cmd->a = p0.x;
+    cmd->b = p0.y;
+    cmd->c = p1.x;
+    cmd->d = p1.y;
+}
+
+// Width 0 in the key: pixels ignore stroke width, so they never change it
+void draw_batch_pixel(DrawBatch *batch, GPoint point, GColor color) {
+    DrawCommand *cmd = prv_push(batch, OP_PIXEL, true, color, 0);
+    if (!cmd) return;
+    cmd->a = point.x;
+    cmd->b = point.y;
+}
+
+void draw_batch_flush(DrawBatch *batch) {
+    if (!batch || !batch->ctx || batch->count == 0) return;
+    GContext *ctx = batch->ctx;
+    prv_sort(batch);
+
+    bool have_fill = false, have_stroke = false;
+    uint8_t fill = 0, stroke = 0, width = 0;
+
+    for (int i = 0; i < batch->count; i++) {
+        const DrawCommand *cmd = &batch->commands[batch->order[i]];
+        GColor color = KEY_COLOR(cmd->key);
+
+        if (cmd->key & KEY_STROKE) {
+            if (!have_stroke || stroke != color.argb) {
+                graphics_context_set_stroke_color(ctx, color);
+                stroke = color.argb;
+                have_stroke = true;
+            }
+            uint8_t key_width = KEY_WIDTH(cmd->key);
+            if (key_width && key_width != width) {
+                graphics_context_set_stroke_width(ctx, key_width);
+                width = key_width;
+            }
+        } else if (!have_fill || fill != color.argb) {
+            graphics_context_set_fill_color(ctx, color);
+            fill = color.argb;
+            have_fill = true;
+        }
+        prv_draw(ctx, cmd);
+    }
+
+    batch->count = 0;
+}
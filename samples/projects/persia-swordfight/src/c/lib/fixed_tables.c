@@ -0,0 +1,48 @@
+/**
+ * Fixed-Point Tables - see fixed_tables.h
+ *
+ * Generated by scripts/generate_fixed_tables.py - do not edit by hand.
+ */
+
+#include <pebble.h>
+#include "fixed_tables.h"
+
+// sin(2*pi*i/256) * 127; cosine reads the same table a quarter turn ahead
+const int8_t FIXED_SIN_Q7[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+// 50 - 50*cos(p*pi/100)
+const uint8_t FIXED_EASE_IN_OUT[101] = {
+       0,    0,    0,    0,    0,    1,    1,    1,    2,    2,    2,    3,    4,    4,    5,    5,    6,
+       7,    8,    9,   10,   10,   11,   12,   14,   15,   16,   17,   18,   19,   21,   22,   23,   25,
+      26,   27,   29,   30,   32,   33,   35,   36,   38,   39,   41,   42,   44,   45,   47,   48,   50,
+      52,   53,   55,   56,   58,   59,   61,   62,   64,   65,   67,   68,   70,   71,   73,   74,   75,
+      77,   78,   79,   81,   82,   83,   84,   85,   86,   88,   89,   90,   90,   91,   92,   93,   94,
+      95,   95,   96,   96,   97,   98,   98,   98,   99,   99,   99,  100,  100,  100,  100,  100,
+};
+
+// 100 - (100-p)^2/100
+const uint8_t FIXED_EASE_OUT[101] = {
+       0,    2,    4,    6,    8,   10,   12,   14,   16,   18,   19,   21,   23,   25,   27,   28,   30,
+      32,   33,   35,   36,   38,   40,   41,   43,   44,   46,   47,   49,   50,   51,   53,   54,   56,
+      57,   58,   60,   61,   62,   63,   64,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,
+      76,   77,   78,   79,   80,   81,   82,   83,   84,   84,   85,   86,   87,   88,   88,   89,   90,
+      90,   91,   91,   92,   93,   93,   94,   94,   95,   95,   96,   96,   96,   97,   97,   98,   98,
+      98,   99,   99,   99,   99,   99,  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+};
@@ -0,0 +1,74 @@
+/**
+ * Fixed-Point Tables
+ *
+ * Precomputed sine and easing tables for the per-frame hot loops. A table
+ * read plus a multiply and a shift replaces sin_lookup()/cos_lookup() (a
+ * firmware call that interpolates) and the divide by TRIG_MAX_RATIO.
+ *
+ *   - FIXED_SIN_Q7: one turn in 256 steps, scaled to 127. Cosine is the same
+ *     table a quarter turn (64 steps) ahead, so it doubles as a ring of unit
+ *     vectors: n sparks at index i * 256 / n.
+ *   - FIXED_EASE_IN_OUT / FIXED_EASE_OUT: progress 0-100 to eased 0-100.
+ *
+ * The data lives in fixed_tables.c, generated by
+ * scripts/generate_fixed_tables.py.
+ *
+ * Usage:
+ *     int dy = fixed_sin_mul(wave->phase, wave->amplitude);   // TRIG_MAX_ANGLE units
+ *
+ *     uint8_t base = fixed_angle_index(spin);
+ *     for (int i = 0; i < 16; i++) {                          // ring of 16
+ *         uint8_t a = base + i * (FIXED_SIN_STEPS / 16);
+ *         GPoint p = GPoint(cx + fixed_sin_idx_mul(a, r), cy + fixed_cos_idx_mul(a, r));
+ *     }
+ *
+ *     int eased = fixed_ease_in_out(progress);                // 0-100
+ *
+ * Resolution is 1/256 turn: within a pixel of sin_lookup() for radii up to
+ * ~30 px. Keep sin_lookup() for long hands, vines and large arcs.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define FIXED_SIN_STEPS 256         // Table entries per turn
+#define FIXED_SIN_SHIFT 7           // Table values are Q7 (127 = 1.0)
+#define FIXED_ANGLE_SHIFT 8         // TRIG_MAX_ANGLE (65536) >> 8 = 256 steps
+#define FIXED_EASE_STEPS 101        // Progress 0..100
+
+extern const int8_t FIXED_SIN_Q7[FIXED_SIN_STEPS];
+extern const uint8_t FIXED_EASE_IN_OUT[FIXED_EASE_STEPS];
+extern const uint8_t FIXED_EASE_OUT[FIXED_EASE_STEPS];
+
+// TRIG_MAX_ANGLE angle (any sign, any number of turns) to a table index
+static inline uint8_t fixed_angle_index(int32_t angle) {
+    return (uint8_t)((uint32_t)angle >> FIXED_ANGLE_SHIFT);
+}
+
+// Rounded r * sin / r * cos for a table index
+static inline int32_t fixed_sin_idx_mul(uint8_t index, int32_t r) {
+    return (FIXED_SIN_Q7[index] * r + (1 << (FIXED_SIN_SHIFT - 1))) >> FIXED_SIN_SHIFT;
+}
+
+static inline int32_t fixed_cos_idx_mul(uint8_t index, int32_t r) {
+    return fixed_sin_idx_mul((uint8_t)(index + FIXED_SIN_STEPS / 4), r);
+}
+
+// Same for a TRIG_MAX_ANGLE angle
+static inline int32_t fixed_sin_mul(int32_t angle, int32_t r) {
+    return fixed_sin_idx_mul(fixed_angle_index(angle), r);
+}
+
+static inline int32_t fixed_cos_mul(int32_t angle, int32_t r) {
+    return fixed_cos_idx_mul(fixed_angle_index(angle), r);
+}
+
+// Progress outside 0-100 is clamped
+static inline int fixed_ease_in_out(int progress) {
+    return FIXED_EASE_IN_OUT[progress < 0 ? 0 : progress > 100 ? 100 : progress];
+}
+
+static inline int fixed_ease_out(int progress) {
+    return FIXED_EASE_OUT[progress < 0 ? 0 : progress > 100 ? 100 : progress];
+}
@@ -0,0 +1,364 @@
+/**
+ * Frame Governor - see frame_governor.h
+ */
+
+#include <pebble.h>
+#include "frame_governor.h"
+
+#define MIN_DELAY_MS 5          // Always yield so the frame can be rendered
+#define MISS_WINDOW_MASK 0xFFFF // Last 16 frames
+#define MISSES_TO_BACK_OFF 4
+#define LOD_STRAIN_FRAMES 8     // Frames over budget before a tier of detail goes
+#define LOD_CALM_FRAMES 32      // Cheap, on-time frames before it comes back
+
+struct FrameGovernor {
+    FrameGovernorConfig config;
+    FrameGovernorFrameProc frame_proc;
+    void *context;
+    AppTimer *timer;
+    bool running;               // Animation allowed (frame_governor_run)
+    bool asleep;                // Burst window over
+    bool in_frame;
+    uint32_t wake_until;
+
+    uint8_t activity;
+    bool battery_low;
+    bool low_power;
+
+    uint32_t frame_start;       // When the last frame (or run()) started
+    uint32_t deadline;          // Latest on-time start for the next frame
+    uint32_t render_start;
+    uint16_t render_total;      // Render time since the last frame started
+    uint16_t update_cost;
+    uint32_t cost_x16;          // Moving average of update + render, x16
+
+    uint16_t miss_bits;         // 1 bit per frame, newest in bit 0
+    uint16_t backoff_ms;
+    uint16_t interval;
+    uint8_t steps;
+
+    uint8_t lod;                // FrameGovernorLod from cost and misses
+    uint8_t lod_frames;         // Consecutive frames pushing `lod` up or down
+    bool lod_strained;          // Which way `lod_frames` is counting
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t prv_now_ms(void) {
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t)seconds * 1000 + ms;
+}
+
+// Wrap-safe "a is later than b" for prv_now_ms() values
+static bool prv_after(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+static int prv_popcount(uint16_t bits) {
+    int count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+}
+
+static uint16_t prv_pick_interval(const FrameGovernor *gov) {
+    const FrameGovernorConfig *cfg = &gov->config;
+
+    int32_t interval = cfg->idle_interval_ms +
+                       ((int32_t)cfg->interval_ms - cfg->idle_interval_ms) * gov->activity / 100;
+    if (gov->battery_low || gov->low_power) {
+        interval *= 2;
+    }
+
+    // Keep the CPU idle at least half the time
+    int32_t cost_floor = 2 * (int32_t)(gov->cost_x16 / 16);
+    if (interval < cost_floor) {
+        interval = cost_floor;
+    }
+
+    interval += gov->backoff_ms;
+    if (interval < cfg->interval_ms) interval = cfg->interval_ms;
+    if (interval > cfg->max_interval_ms) interval = cfg->max_interval_ms;
+    return interval;
+}
+
+// Frames keep starting late: slow down. On time for a whole window: recover.
+static void prv_update_backoff(FrameGovernor *gov) {
+    int misses = prv_popcount(gov->miss_bits);
+    if (misses >= MISSES_TO_BACK_OFF) {
+        gov->backoff_ms += gov->config.interval_ms / 4 + 1;
+        if (gov->backoff_ms > gov->config.max_interval_ms) {
+            gov->backoff_ms = gov->config.max_interval_ms;
+        }
+        gov->miss_bits = 0;
+    } else if (misses == 0 && gov->backoff_ms > 0) {
+        gov->backoff_ms--;
+    }
+}
+
+// Over budget (the cost floor would stretch the interval) or missing
+// deadlines: shed detail. Well under budget and on time: restore it.
+static void prv_update_lod(FrameGovernor *gov) {
+    uint32_t cost = gov->cost_x16 / 16;
+    uint32_t budget = gov->config.interval_ms / 2;
+    int misses = prv_popcount(gov->miss_bits & 0xFF);
+
+    bool strained = cost > budget || misses >= MISSES_TO_BACK_OFF / 2;
+    bool calm = cost < budget / 2 && misses == 0;
+    if (!strained && !calm) {
+        gov->lod_frames = 0;
+        return;
+    }
+    if (strained != gov->lod_strained) {
+        gov->lod_strained = strained;
+        gov->lod_frames = 0;
+    }
+    if (++gov->lod_frames < (strained ? LOD_STRAIN_FRAMES : LOD_CALM_FRAMES)) return;
+
+    gov->lod_frames = 0;
+    if (strained && gov->lod < FRAME_GOVERNOR_LOD_MINIMAL) gov->lod++;
+    if (calm && gov->lod > FRAME_GOVERNOR_LOD_FULL) gov->lod--;
+}
+
+static uint32_t prv_delay_from_now(const FrameGovernor *gov, uint32_t now) {
+    uint32_t elapsed = now - gov->frame_start;
+    uint32_t delay = gov->interval > elapsed ? gov->interval - elapsed : 0;
+    return delay < MIN_DELAY_MS ? MIN_DELAY_MS : delay;
+}
+
+// ============================================================================
+// TIMER
+// ============================================================================
+
+static void prv_timer_callback(void *data);
+
+#if defined(CAPTURE_MODE)
+// Tap handlers get no context pointer; one governor per app
+static FrameGovernor *s_capture_gov;
+
+static void prv_capture_tap(AccelAxisType axis, int32_t direction) {
+    frame_governor_step(s_capture_gov);
+}
+#endif
+
+// Next frame starts `interval` after this one started, not after it ended
+static void prv_schedule(FrameGovernor *gov) {
+#if defined(CAPTURE_MODE)
+    (void)gov;  // Frames only run on taps
+#else
+    if (gov->timer) return;
+    gov->interval = prv_pick_interval(gov);
+    gov->deadline = gov->frame_start + gov->interval + gov->interval / 4 + 4;
+    gov->timer = app_timer_register(prv_delay_from_now(gov, prv_now_ms()), prv_timer_callback, gov);
+#endif
+}
+
+static void prv_timer_callback(void *data) {
+    FrameGovernor *gov = data;
+    gov->timer = NULL;
+    uint32_t now = prv_now_ms();
+
+    // Previous frame's cost: its update plus the render that followed
+    uint32_t cost = gov->update_cost + gov->render_total;
+    gov->cost_x16 = gov->cost_x16 - gov->cost_x16 / 8 + cost * 2;
+
+    bool missed = prv_after(now, gov->deadline);
+    gov->miss_bits = ((gov->miss_bits << 1) | missed) & MISS_WINDOW_MASK;
+
+    uint32_t nominal = gov->config.interval_ms;
+    uint32_t steps = (now - gov->frame_start + nominal / 2) / nominal;
+    gov->steps = steps < 1 ? 1 : steps > FRAME_GOVERNOR_MAX_STEPS ? FRAME_GOVERNOR_MAX_STEPS : steps;
+    gov->render_total = 0;
+    gov->frame_start = now;
+
+    gov->in_frame = true;
+    gov->frame_proc(gov->context);
+    gov->in_frame = false;
+    gov->update_cost = prv_now_ms() - now;
+
+    prv_update_lod(gov);        // Before the backoff clears the misses
+    prv_update_backoff(gov);
+
+    // Burst over: leave this frame on screen until the next wake
+    if (gov->config.burst_ms && prv_after(prv_now_ms(), gov->wake_until)) {
+        gov->asleep = true;
+    }
+    if (gov->running && !gov->asleep) {
+        prv_schedule(gov);
+    }
+}
+
+// Restart from scratch: the pause isn't a missed deadline. Inside a frame
+// the callback re-arms the timer itself when the frame returns.
+static void prv_start(FrameGovernor *gov) {
+    if (gov->timer || gov->in_frame) return;
+    gov->frame_start = prv_now_ms();
+    gov->render_total = 0;
+    gov->update_cost = 0;
+    gov->steps = 1;
+    prv_schedule(gov);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+FrameGovernor *frame_governor_create(const FrameGovernorConfig *config,
+                                     FrameGovernorFrameProc frame_proc, void *context) {
+    FrameGovernor *gov = calloc(1, sizeof(FrameGovernor));
+    if (!gov) return NULL;
+
+    gov->config = *config;
+    if (gov->config.interval_ms == 0) gov->config.interval_ms = 50;
+    if (gov->config.idle_interval_ms < gov->config.interval_ms) {
+        gov->config.idle_interval_ms = gov->config.interval_ms;
+    }
+    if (gov->config.max_interval_ms < gov->config.idle_interval_ms) {
+        gov->config.max_interval_ms = 2 * gov->config.idle_interval_ms;
+    }
+
+    gov->frame_proc = frame_proc;
+    gov->context = context;
+    gov->activity = 100;
+    gov->interval = gov->config.interval_ms;
+    gov->steps = 1;
+    gov->wake_until = prv_now_ms() + gov->config.burst_ms;
+
+#if defined(CAPTURE_MODE)
+    s_capture_gov = gov;
+    accel_tap_service_subscribe(prv_capture_tap);
+#endif
+    return gov;
+}
+
+void frame_governor_destroy(FrameGovernor *gov) {
+    if (!gov) return;
+#if defined(CAPTURE_MODE)
+    accel_tap_service_unsubscribe();
+    s_capture_gov = NULL;
+#endif
+    if (gov->timer) app_timer_cancel(gov->timer);
+    free(gov);
+}
+
+void frame_governor_run(FrameGovernor *gov, bool run) {
+    if (!gov) return;
+    gov->running = run;
+
+    if (!run) {
+        if (gov->timer) {
+            app_timer_cancel(gov->timer);
+            gov->timer = NULL;
+        }
+        return;
+    }
+
+    // Asleep: wait for frame_governor_wake()
+    if (!gov->asleep) {
+        prv_start(gov);
+    }
+}
+
+bool frame_governor_is_running(const FrameGovernor *gov) {
+    return gov && gov->running;
+}
+
+void frame_governor_wake(FrameGovernor *gov) {
+#if defined(CAPTURE_MODE)
+    frame_governor_step(gov);
+#else
+    if (!gov || !gov->config.burst_ms) return;
+    gov->wake_until = prv_now_ms() + gov->config.burst_ms;
+    gov->asleep = false;
+    if (gov->running) {
+        prv_start(gov);
+    }
+#endif
+}
+
+void frame_governor_step(FrameGovernor *gov) {
+    if (!gov || gov->in_frame) return;
+    gov->steps = 1;
+    gov->render_total = 0;
+    gov->frame_start = prv_now_ms();
+
+    gov->in_frame = true;
+    gov->frame_proc(gov->context);
+    gov->in_frame = false;
+    gov->update_cost = prv_now_ms() - gov->frame_start;
+}
+
+bool frame_governor_is_asleep(const FrameGovernor *gov) {
+    return gov && gov->asleep;
+}
+
+void frame_governor_set_activity(FrameGovernor *gov, uint8_t activity) {
+    if (!gov) return;
+    if (activity > 100) activity = 100;
+    bool faster = activity > gov->activity;
+    gov->activity = activity;
+
+    // A slow idle frame may be pending; pull it in
+    if (faster && gov->timer && !gov->in_frame) {
+        uint16_t interval = prv_pick_interval(gov);
+        if (interval < gov->interval) {
+            uint32_t now = prv_now_ms();
+            gov->interval = interval;
+            gov->deadline = gov->frame_start + interval + interval / 4 + 4;
+            app_timer_reschedule(gov->timer, prv_delay_from_now(gov, now));
+        }
+    }
+}
+
+void frame_governor_set_battery(FrameGovernor *gov, BatteryChargeState state) {
+    if (!gov) return;
+    gov->battery_low = state.charge_percent <= gov->config.low_battery_percent &&
+                       !state.is_charging && !state.is_plugged;
+}
+
+void frame_governor_set_low_power(FrameGovernor *gov, bool low_power) {
+    if (gov) {
+        gov->low_power = low_power;
+    }
+}
+
+void frame_governor_render_begin(FrameGovernor *gov) {
+    if (gov) {
+        gov->render_start = prv_now_ms();
+    }
+}
+
+void frame_governor_render_end(FrameGovernor *gov) {
+    if (gov) {
+        gov->render_total += prv_now_ms() - gov->render_start;
+    }
+}
+
+uint8_t frame_governor_steps(const FrameGovernor *gov) {
+    return gov ? gov->steps : 1;
+}
+
+FrameGovernorLod frame_governor_lod(const FrameGovernor *gov) {
+#if defined(CAPTURE_MODE)
+    (void)gov;
+    return FRAME_GOVERNOR_LOD_FULL;
+#else
+    if (!gov) return FRAME_GOVERNOR_LOD_FULL;
+    FrameGovernorLod lod = gov->lod;
+    if ((gov->battery_low || gov->low_power) && lod < FRAME_GOVERNOR_LOD_REDUCED) {
+        lod = FRAME_GOVERNOR_LOD_REDUCED;
+    }
+    return lod;
+#endif
+}
+
+uint16_t frame_governor_interval(const FrameGovernor *gov) {
+    return gov ? gov->interval : 0;
+}
+
+uint16_t frame_governor_cost(const FrameGovernor *gov) {
+    return gov ? gov->cost_x16 / 16 : 0;
+}
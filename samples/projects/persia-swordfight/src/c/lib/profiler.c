@@ -0,0 +1,236 @@
+/**
+ * Frame Profiler - see profiler.h
+ */
+
+#include <pebble.h>
+#include "profiler.h"
+
+#if defined(PROFILER)
+
+typedef struct {
+    uint8_t ring[PROFILER_WINDOW];  // Per-frame totals in ms, saturated at 255
+    uint8_t head;
+    uint8_t count;
+    uint16_t frame_total;           // Accumulated during the current frame
+    bool ran;                       // Section ran during the current frame
+    uint32_t start;
+} Section;
+
+// One extra slot after the named sections holds the frame period
+static Section s_sections[PROFILER_MAX_SECTIONS + 1];
+static const char *const *s_names;
+static int s_count;
+
+static uint32_t s_frames;
+static uint32_t s_last_frame_ms;
+static uint16_t s_budget_ms;
+
+// Startup marks, ms after profiler_startup_begin()
+static uint32_t s_startup_begin_ms;
+static const char *s_mark_labels[PROFILER_MAX_MARKS];
+static uint16_t s_mark_ms[PROFILER_MAX_MARKS];
+static uint8_t s_num_marks;
+
+#if defined(PROFILER_HUD)
+static Layer *s_hud_layer;
+#endif
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t prv_now_ms(void) {
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t)seconds * 1000 + ms;
+}
+
+static void prv_push(Section *section, uint32_t value) {
+    section->ring[section->head] = value > 255 ? 255 : value;
+    section->head = (section->head + 1) % PROFILER_WINDOW;
+    if (section->count < PROFILER_WINDOW) section->count++;
+}
+
+static bool prv_stats(const Section *section, ProfilerStats *stats) {
+    int n = section->count;
+    if (n == 0) return false;
+
+    // Ring order doesn't matter for these; sort a copy for the percentile
+    uint8_t sorted[PROFILER_WINDOW];
+    uint32_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        uint8_t v = section->ring[i];
+        int j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+        sum += v;
+    }
+
+    stats->min = sorted[0];
+    stats->max = sorted[n - 1];
+    stats->p95 = sorted[(n * 95 + 99) / 100 - 1];
+    stats->avg_x10 = (sum * 10 + n / 2) / n;
+    stats->samples = n;
+    return true;
+}
+
+static const char *prv_name(int section) {
+    return section < s_count ? s_names[section] : "frame";
+}
+
+static int prv_find_mark(const char *label) {
+    for (int i = 0; i < s_num_marks; i++) {
+        if (s_mark_labels[i] == label || strcmp(s_mark_labels[i], label) == 0) return i;
+    }
+    return -1;
+}
+
+// ============================================================================
+// HUD
+// ============================================================================
+
+#if defined(PROFILER_HUD)
+#define HUD_LINE_H 10
+
+static void prv_hud_update_proc(Layer *layer, GContext *ctx) {
+    GRect bounds = layer_get_bounds(layer);
+    graphics_context_set_fill_color(ctx, GColorBlack);
+    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    graphics_context_set_text_color(ctx, GColorWhite);
+
+    GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_09);
+    char line[32];
+    int y = 0;
+
+    // Frame period first: that's the number to compare with the budget
+    for (int i = s_count; i >= 0 && y + HUD_LINE_H <= bounds.size.h; i--) {
+        ProfilerStats st;
+        if (!prv_stats(&s_sections[i], &st)) continue;
+
+        if (i == s_count) {
+            snprintf(line, sizeof(line), "frame %d.%d/%d p95 %d",
+                     st.avg_x10 / 10, st.avg_x10 % 10, s_budget_ms, st.p95);
+        } else {
+            snprintf(line, sizeof(line), "%s %d.%d %d %d",
+                     prv_name(i), st.avg_x10 / 10, st.avg_x10 % 10, st.p95, st.max);
+        }
+        graphics_draw_text(ctx, line, font, GRect(2, y - 2, bounds.size.w - 2, HUD_LINE_H + 4),
+                           GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+        y += HUD_LINE_H;
+    }
+}
+
+void profiler_hud_attach(Layer *parent, GRect frame) {
+    if (s_hud_layer) return;
+    s_hud_layer = layer_create(frame);
+    if (!s_hud_layer) return;
+    layer_set_update_proc(s_hud_layer, prv_hud_update_proc);
+    layer_add_child(parent, s_hud_layer);
+}
+#endif
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void profiler_init(const char *const *names, int count) {
+    memset(s_sections, 0, sizeof(s_sections));
+    s_names = names;
+    s_count = count < PROFILER_MAX_SECTIONS ? count : PROFILER_MAX_SECTIONS;
+    s_frames = 0;
+    s_last_frame_ms = 0;
+}
+
+void profiler_deinit(void) {
+#if defined(PROFILER_HUD)
+    if (s_hud_layer) {
+        layer_destroy(s_hud_layer);
+        s_hud_layer = NULL;
+    }
+#endif
+    s_count = 0;
+}
+
+void profiler_begin(int section) {
+    if (section < 0 || section >= s_count) return;
+    s_sections[section].start = prv_now_ms();
+}
+
+void profiler_end(int section) {
+    if (section < 0 || section >= s_count) return;
+    Section *s = &s_sections[section];
+    s->frame_total += prv_now_ms() - s->start;
+    s->ran = true;
+}
+
+void profiler_frame_end(uint16_t budget_ms) {
+    uint32_t now = prv_now_ms();
+    s_budget_ms = budget_ms;
+
+    for (int i = 0; i < s_count; i++) {
+        Section *s = &s_sections[i];
+        // Skipped sections (nothing dirty to draw) don't count as 0 ms
+        if (s->ran) prv_push(s, s->frame_total);
+        s->frame_total = 0;
+        s->ran = false;
+    }
+    if (s_last_frame_ms) prv_push(&s_sections[s_count], now - s_last_frame_ms);
+    s_last_frame_ms = now;
+
+    s_frames++;
+#if PROFILER_LOG_FRAMES > 0
+    if (s_frames % PROFILER_LOG_FRAMES == 0) profiler_log();
+#endif
+#if defined(PROFILER_HUD)
+    if (s_hud_layer) layer_mark_dirty(s_hud_layer);
+#endif
+}
+
+bool profiler_get_stats(int section, ProfilerStats *stats) {
+    if (section < 0 || section > s_count || !stats) return false;
+    return prv_stats(&s_sections[section], stats);
+}
+
+void profiler_log(void) {
+    for (int i = 0; i <= s_count; i++) {
+        ProfilerStats st;
+        if (!prv_stats(&s_sections[i], &st)) continue;
+        APP_LOG(APP_LOG_LEVEL_INFO, "prof %s: min %d avg %d.%d max %d p95 %d ms (n=%d)",
+                prv_name(i), st.min, st.avg_x10 / 10, st.avg_x10 % 10, st.max, st.p95, st.samples);
+    }
+    APP_LOG(APP_LOG_LEVEL_INFO, "prof budget %d ms", s_budget_ms);
+    if (s_num_marks) profiler_startup_log();
+}
+
+void profiler_startup_begin(void) {
+    s_startup_begin_ms = prv_now_ms();
+    s_num_marks = 0;
+}
+
+void profiler_startup_mark(const char *label) {
+    if (!label || s_num_marks == PROFILER_MAX_MARKS || prv_find_mark(label) >= 0) return;
+    uint32_t elapsed = prv_now_ms() - s_startup_begin_ms;
+    s_mark_labels[s_num_marks] = label;
+    s_mark_ms[s_num_marks] = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+    s_num_marks++;
+}
+
+int profiler_startup_ms(const char *label) {
+    int i = label ? prv_find_mark(label) : -1;
+    return i < 0 ? -1 : s_mark_ms[i];
+}
+
+void profiler_startup_log(void) {
+    char line[96];
+    int len = snprintf(line, sizeof(line), "prof startup:");
+    for (int i = 0; i < s_num_marks && len < (int)sizeof(line); i++) {
+        len += snprintf(line + len, sizeof(line) - len, " %s %d ms", s_mark_labels[i], s_mark_ms[i]);
+    }
+    APP_LOG(APP_LOG_LEVEL_INFO, "%s", line);
+}
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * Round Mask - see round_mask.h
+ */
+
+#include <pebble.h>
+#include "round_mask.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+#if defined(PBL_ROUND)
+static int32_t prv_isqrt(int32_t v) {
+    int32_t r = 0;
+    for (int32_t bit = 1 << 14; bit > 0; bit >>= 1) {
+        if ((r + bit) * (r + bit) <= v) r += bit;
+    }
+    return r;
+}
+#endif
+
+// Columns the display shows of row `ry` (relative to `screen`), measured
+// from the left edge of `screen`
+static bool prv_span(GRect screen, int16_t ry, int16_t *min_x, int16_t *max_x) {
+    if (ry < 0 || ry >= screen.size.h) return false;
+#if defined(PBL_ROUND)
+    // In half pixels: the row's center is `d` from the circle's center
+    int32_t w = screen.size.w;
+    int32_t d = 2 * ry + 1 - screen.size.h;
+    int32_t q = w * w - d * d;
+    if (q <= 0) return false;
+    int16_t inset = (w - prv_isqrt(q)) / 2;
+    *min_x = inset;
+    *max_x = w - 1 - inset;
+    return *min_x <= *max_x;
+#else
+    *min_x = 0;
+    *max_x = screen.size.w - 1;
+    return true;
+#endif
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool round_mask_row_span(GRect screen, int16_t y, int16_t *min_x, int16_t *max_x) {
+    if (!prv_span(screen, y - screen.origin.y, min_x, max_x)) return false;
+    *min_x += screen.origin.x;
+    *max_x += screen.origin.x;
+    return true;
+}
+
+bool round_mask_rect_visible(GRect screen, GRect rect) {
+    if (rect.size.w <= 0 || rect.size.h <= 0) return false;
+
+    // The rect's widest row is the one nearest the middle of the screen
+    int16_t top = rect.origin.y - screen.origin.y;
+    int16_t bottom = top + rect.size.h - 1;
+    int16_t ry = (screen.size.h - 1) / 2;
+    if (ry < top) ry = top;
+    if (ry > bottom) ry = bottom;
+
+    int16_t min_x, max_x;
+    if (!prv_span(screen, ry, &min_x, &max_x)) return false;
+
+    // One pixel of slack for the firmware's own rounding of the circle
+    int16_t left = rect.origin.x - screen.origin.x;
+    return left <= max_x + 1 && left + rect.size.w - 1 >= min_x - 1;
+}
+
+GRect round_mask_fit_rect(GRect screen, GRect rect) {
+#if defined(PBL_ROUND)
+    // The rect's narrowest row is the one farthest from the middle
+    int16_t top = rect.origin.y - screen.origin.y;
+    int16_t bottom = top + rect.size.h - 1;
+    int16_t mid = screen.size.h - 1;
+    int16_t ry = (2 * top - mid) * (2 * top - mid) > (2 * bottom - mid) * (2 * bottom - mid) ? top : bottom;
+
+    int16_t min_x, max_x;
+    if (!prv_span(screen, ry, &min_x, &max_x)) return rect;
+
+    // One pixel in from the edge, where the firmware may round differently
+    min_x += 1;
+    max_x -= 1;
+    if (rect.size.w > max_x - min_x + 1) return rect;
+
+    int16_t left = rect.origin.x - screen.origin.x;
+    if (left < min_x) left = min_x;
+    if (left + rect.size.w - 1 > max_x) left = max_x - rect.size.w + 1;
+    rect.origin.x = screen.origin.x + left;
+#else
+    (void)screen;
+#endif
+    return rect;
+}
@@ -0,0 +1,82 @@
+/**
+ * Sprite Atlas
+ *
+ * Draws pre-rasterized character poses from one sprite-sheet bitmap instead
+ * of dozens of vector calls per frame. The sheet and its frame table are
+ * generated by scripts/create_sprite_atlas.py, which renders the face's own
+ * vector drawing code on the host (see "Baking" below) and writes:
+ *
+ *   resources/images/<name>~color.png   the packed sheet (color platforms)
+ *   src/c/<name>_atlas.h                frame table + count
+ *
+ * Runtime:
+ *     #include "fighters_atlas.h"
+ *     #ifdef PBL_COLOR                                      // B/W draws vectors
+ *     s_atlas = sprite_atlas_create(RESOURCE_ID_FIGHTERS, FIGHTERS_FRAMES,
+ *                                   FIGHTERS_COUNT);       // window load, NULL is fine
+ *     #endif
+ *
+ *     if (!sprite_atlas_draw(s_atlas, ctx, sprite, feet)) {
+ *         draw_vector(ctx, ...);                           // fallback
+ *     }
+ *
+ *     sprite_atlas_destroy(s_atlas);                        // window unload
+ *
+ * Each frame has an anchor (e.g. the character's feet); draw positions the
+ * sprite so the anchor lands on the given point, exactly where the vector
+ * code would have drawn. Keep the vector path: it draws poses that aren't
+ * baked (in-between frames) and runs when the sheet doesn't fit in RAM.
+ *
+ * Drawing moves the sheet's bounds to the frame and blits with GCompOpSet,
+ * so nothing is allocated per frame and transparent pixels are skipped.
+ * Compositing is reset to GCompOpAssign afterwards. There is no B/W sheet:
+ * 1-bit bitmaps have no alpha and GCompOpSet only ORs in white there.
+ *
+ * Baking: build with SPRITE_ATLAS_BAKE defined (the script does this) and
+ * export one SpriteBake describing the poses. `draw` renders sprite `index`
+ * with its anchor at `anchor`; it must not depend on state set up in main().
+ *
+ *     #if defined(SPRITE_ATLAS_BAKE)
+ *     static void bake_pose(GContext *ctx, uint16_t index, GPoint anchor) { ... }
+ *     const SpriteBake g_sprite_bake = {
+ *         .name = "fighters", .count = NUM_POSES,
+ *         .anchor = { 72, 150 }, .draw = bake_pose,
+ *     };
+ *     #endif
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+typedef struct {
+    uint16_t x, y;              // Position in the sheet
+    uint8_t w, h;
+    int16_t dx, dy;             // Top-left relative to the anchor
+} SpriteFrame;
+
+typedef struct SpriteAtlas SpriteAtlas;
+
+// NULL if the resource can't be loaded (out of memory, missing on this
+// platform); every call below accepts NULL and reports nothing drawn
+SpriteAtlas *sprite_atlas_create(uint32_t resource_id, const SpriteFrame *frames, uint16_t count);
+void sprite_atlas_destroy(SpriteAtlas *atlas);
+
+// Blits `index` with its anchor at `anchor`. False if nothing was drawn.
+bool sprite_atlas_draw(SpriteAtlas *atlas, GContext *ctx, uint16_t index, GPoint anchor);
+
+// Screen rect `index` covers with its anchor at `anchor` (for bounding boxes)
+GRect sprite_frame_rect(const SpriteFrame *frames, uint16_t index, GPoint anchor);
+
+#if defined(SPRITE_ATLAS_BAKE)
+typedef void (*SpriteBakeDrawProc)(GContext *ctx, uint16_t index, GPoint anchor);
+
+typedef struct {
+    const char *name;           // Resource/file base name
+    uint16_t count;
+    GPoint anchor;              // Where sprites are drawn on the bake canvas
+    SpriteBakeDrawProc draw;
+} SpriteBake;
+
+extern const SpriteBake g_sprite_bake;
+#endif
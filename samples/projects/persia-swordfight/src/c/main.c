@@ -1,5 +1,17 @@
 #include <pebble.h>
 #include <stdlib.h>
+#include "lib/bg_cache.h"
+#include "lib/dirty_tracker.h"
+#include "lib/draw_batch.h"
+#include "lib/fixed_tables.h"
+#include "lib/frame_governor.h"
+#include "lib/profiler.h"  // PROFILE=1 pebble build
+#include "lib/round_mask.h"
+#include "lib/sprite_atlas.h"
+#include "lib/time_text.h"
+#include "fighters_atlas.h"  // scripts/create_sprite_atlas.py
+#include "fight.h"
+#include "baked_tables.h"    // scripts/bake_tables.py (fight_bake.c)
 
 // Toggle subtle camera shake on sword clashes (0 = off)
 #define ENABLE_CLASH_SHAKE 1
@@ -8,21 +20,16 @@
 // PRINCE OF PERSIA - DETAILED CHARACTERS & SMOOTH ANIMATION
 // ===========================================================================
 
-#ifdef PBL_ROUND
-    #define SCREEN_W 180
-    #define SCREEN_H 180
-    #define GROUND_Y 162
-    #define PRINCE_X 55
-    #define GUARD_X 125
-#else
-    #define SCREEN_W 144
-    #define SCREEN_H 168
-    #define GROUND_Y 150
-    #define PRINCE_X 38
-    #define GUARD_X 106
-#endif
+#define ANIM_MS 22  // Fast action! (frame governor may stretch it)
+
+static const FrameGovernorConfig GOV_CFG = {
+    .interval_ms = ANIM_MS, .idle_interval_ms = ANIM_MS,
+    .max_interval_ms = 200, .low_battery_percent = 20,
+};
 
-#define ANIM_MS 22  // Fast action!
+// Profiled sections (see lib/profiler.h)
+enum { PROF_UPDATE, PROF_BG, PROF_FIGHTER, PROF_SPARKS, NUM_PROF };
+static const char *const PROF_NAMES[NUM_PROF] = { "update", "bg", "fighter", "sparks" };
 
 // ===========================================================================
 // COLORS
@@ -63,133 +70,40 @@
     #define COL_SPARK      GColorWhite
 #endif
 
-// ===========================================================================
-// POSE SYSTEM - Target values that we interpolate toward
-// ===========================================================================
-typedef struct {
-    int16_t lean;       // Body lean
-    int16_t step_fwd;   // Front foot forward
-    int16_t step_back;  // Back foot back
-    int16_t crouch;     // Crouch amount
-    int16_t sword_ang;  // Sword angle (degrees)
-    int16_t arm_raise;  // Arm height offset
-} PoseData;
-
-// All pose definitions - Angles: 0=UP, 90=horizontal, 180=DOWN
-// For proper X-clash: attacker swings DOWN (>90), blocker catches UP (<90)
-static const PoseData POSES[] = {
-    // P_READY - neutral guard position
-    {3, 6, 0, 0, 75, 0},
-    // P_STEP_FWD - advancing
-    {6, 10, 0, 3, 80, -2},
-    // P_THRUST - horizontal lunge
-    {12, 16, 0, 8, 95, -8},
-    // P_SLASH - BIG DOWNWARD SWING (angle > 90 = tip below hand)
-    {10, 12, 0, 5, 135, 12},
-    // P_BLOCK_HIGH - sword UP to catch downward slash (angle < 90)
-    {2, 6, 0, 2, 45, 10},
-    // P_BLOCK_LOW - parry low (angle slightly > 90)
-    {4, 8, 0, 4, 105, -4},
-    // P_STRUCK - reeling back, sword wild
-    {-16, -6, 12, 12, 160, 8},
-    // P_STEP_BACK - retreating
-    {-8, 0, 10, 2, 70, 0},
-};
-
-typedef enum {
-    P_READY, P_STEP_FWD, P_THRUST, P_SLASH,
-    P_BLOCK_H, P_BLOCK_L, P_STRUCK, P_STEP_BACK
-} Pose;
-
 typedef struct {
     int16_t x;
     int8_t dir;
     Pose pose;
     // Current interpolated values
     int16_t cur_lean, cur_step_fwd, cur_step_back, cur_crouch;
-    int16_t cur_sword_ang, cur_arm_raise;
+    int16_t cur_arm_raise;
+    const SwordAngle *sword;
 } Fighter;
 
-typedef struct {
-    Pose prince;
-    Pose guard;
-    int16_t dur;
-    bool clash;
-} Move;
-
-// ===========================================================================
-// CHOREOGRAPHY - Attack vs Block for X-shaped sword clashes!
-// ===========================================================================
-static const Move s_seq[] = {
-    // Opening stance
-    {P_READY, P_READY, 16, false},
-
-    // Prince SLASHES down, Guard BLOCKS high - X CLASH!
-    {P_SLASH, P_BLOCK_H, 10, true},
-
-    // Guard counters with slash, Prince blocks - X CLASH!
-    {P_BLOCK_H, P_SLASH, 10, true},
-
-    // Quick ready
-    {P_READY, P_READY, 6, false},
-
-    // Prince thrusts low, Guard parries - CLASH!
-    {P_THRUST, P_BLOCK_L, 10, true},
-
-    // Guard thrusts, Prince parries - CLASH!
-    {P_BLOCK_L, P_THRUST, 10, true},
-
-    // Flurry! Alternating slashes and blocks
-    {P_SLASH, P_BLOCK_H, 8, true},
-    {P_BLOCK_H, P_SLASH, 8, true},
-    {P_SLASH, P_BLOCK_H, 8, true},
-
-    // Brief pause
-    {P_READY, P_READY, 6, false},
-
-    // Prince gets aggressive - rapid attacks!
-    {P_THRUST, P_BLOCK_L, 8, true},
-    {P_SLASH, P_BLOCK_H, 8, true},
-    {P_THRUST, P_BLOCK_L, 8, true},
-
-    // Guard gets HIT!
-    {P_SLASH, P_STRUCK, 12, false},
-    {P_READY, P_STEP_BACK, 8, false},
-
-    // Guard recovers and counters
-    {P_READY, P_READY, 8, false},
-    {P_BLOCK_H, P_SLASH, 10, true},
-    {P_BLOCK_L, P_THRUST, 8, true},
-
-    // Prince gets HIT!
-    {P_STRUCK, P_SLASH, 12, false},
-    {P_STEP_BACK, P_READY, 8, false},
-
-    // Final exchange
-    {P_READY, P_READY, 8, false},
-    {P_SLASH, P_BLOCK_H, 8, true},
-    {P_BLOCK_H, P_SLASH, 8, true},
-    {P_THRUST, P_BLOCK_L, 8, true},
-    {P_BLOCK_L, P_THRUST, 8, true},
-
-    // Reset
-    {P_READY, P_READY, 12, false},
-};
-// Use compile-time array length to prevent mismatches
-#define NUM_SEQ ((int)(sizeof(s_seq) / sizeof(s_seq[0])))
-
 // ===========================================================================
 // GLOBALS
 // ===========================================================================
 static Window *s_win;
 static Layer *s_canvas;
 static TextLayer *s_time_lyr, *s_date_lyr, *s_batt_lyr;
-static AppTimer *s_timer;
+static FrameGovernor *s_gov;  // Owns the animation timer
+static BgCache *s_bg;  // draw_bg() rendered once, blitted per frame
+static DirtyTracker *s_dirty;  // Repaints around fighters and sparks only
+static DrawBatch *s_batch;  // Sparks, grouped by color
+static SpriteAtlas *s_atlas;  // Baked bodies; NULL draws vectors
+static TimeText *s_tt;  // Sets only the text that changed
+
+// Two circles per spark (16 outer, 8 inner) plus the central flash
+#define SPARK_BATCH_SIZE (2 * (16 + 8) + 2)
+
+enum { DIRTY_PRINCE, DIRTY_GUARD, DIRTY_SPARKS, NUM_DIRTY };
 
 static Fighter s_prince, s_guard;
-static int s_seq_idx = 0, s_seq_frame = 0, s_gframe = 0;
+static int s_gframe = 0;
+static int s_fight_frame = 0;  // FIGHT_TABLE entry for the next update
+static int s_next_clash = 0;  // FIGHT_CLASHES entry to wait for
 static int s_battery = 100;
-static char s_time_buf[8], s_date_buf[16], s_batt_buf[8];
+static char s_batt_buf[8];
 
 static bool s_sparks = false;
 static int s_spark_life = 0;
@@ -201,133 +115,58 @@ static int8_t s_shake_mag = 0;
 static int8_t s_shake_dx = 0;
 static int8_t s_shake_dy = 0;
 
-// Forward decls
-static void update_fighter_interpolation(Fighter *f);
-static void compute_sword_points(const Fighter *f, GPoint *hand, GPoint *tip);
-static bool line_intersect(GPoint a1, GPoint a2, GPoint b1, GPoint b2, int16_t *ix, int16_t *iy);
-
 // ===========================================================================
-// SMOOTH INTERPOLATION
+// SWORD POINTS HELPERS (for dynamic spark placement)
 // ===========================================================================
-static int16_t lerp(int16_t current, int16_t target, int16_t speed) {
-    int16_t diff = target - current;
-    if (diff > speed) return current + speed;
-    if (diff < -speed) return current - speed;
-    return target;
+// Sword arm origin; the arm and blade extend from it by FIGHT_SWORDS offsets
+static GPoint sword_shoulder(const Fighter *f, GPoint feet) {
+    int d = f->dir;
+    int cx = feet.x + f->cur_lean * d;
+    int shoulder_y = feet.y + f->cur_crouch - 52;
+    return GPoint(cx + 6 * d, shoulder_y + 5 - f->cur_arm_raise);
 }
 
-static void update_fighter_interpolation(Fighter *f) {
-    PoseData target = POSES[f->pose];
-    int16_t spd = 4;  // Faster body movement
-
-    f->cur_lean = lerp(f->cur_lean, target.lean, spd + 1);
-    f->cur_step_fwd = lerp(f->cur_step_fwd, target.step_fwd, spd + 2);
-    f->cur_step_back = lerp(f->cur_step_back, target.step_back, spd + 2);
-    f->cur_crouch = lerp(f->cur_crouch, target.crouch, spd);
-    f->cur_sword_ang = lerp(f->cur_sword_ang, target.sword_ang, 14);  // Fast sword!
-    f->cur_arm_raise = lerp(f->cur_arm_raise, target.arm_raise, spd + 2);
+static void compute_sword_points(const Fighter *f, GPoint *hand, GPoint *tip) {
+    // Base position includes shake to align with visuals
+    GPoint sarm = sword_shoulder(f, GPoint(f->x + s_shake_dx, GROUND_Y + s_shake_dy));
+    int d = f->dir;
+    const SwordAngle *a = f->sword;
+    GPoint h = GPoint(sarm.x + 2 * d * a->sin10, sarm.y - 2 * a->cos10);
+    if (hand) *hand = h;
+    if (tip) *tip = GPoint(h.x + d * a->sin50, h.y - a->cos50);
 }
 
 // ===========================================================================
-// SWORD POINTS HELPERS (for dynamic spark placement)
+// DRAW DETAILED CHARACTER
 // ===========================================================================
-static void compute_sword_points(const Fighter *f, GPoint *hand, GPoint *tip) {
-    // Mirror the geometry used in draw_fighter to keep effects aligned
-    int d = f->dir;
-
-    // Base position (optionally include shake to align with visuals)
-    int base_x = f->x;
-    int base_y = GROUND_Y;
-#if ENABLE_CLASH_SHAKE
-    base_x += s_shake_dx;
-    base_y += s_shake_dy;
+// Helper to draw an outlined line for better readability on B/W
+static void draw_line_outlined(GContext *ctx, GPoint a, GPoint b, int width, GColor color, bool outline) {
+#ifndef PBL_COLOR
+    if (outline) {
+        graphics_context_set_stroke_color(ctx, GColorBlack);
+        graphics_context_set_stroke_width(ctx, width + 2);
+        graphics_draw_line(ctx, a, b);
+    }
 #endif
-
-    int lean = f->cur_lean * d;
-    int crouch = f->cur_crouch;
-    int sword_ang = f->cur_sword_ang;
-    int arm_raise = f->cur_arm_raise;
-
-    int cx = base_x + lean;
-    int cy = base_y + crouch;
-
-    int shoulder_y = cy - 52;
-
-    // Sword arm origin
-    int sarm_x = cx + 6 * d;
-    int sarm_y = shoulder_y + 5 - arm_raise;
-
-    // Angle math
-    int32_t ang = (sword_ang * TRIG_MAX_ANGLE) / 360;
-    int sin_val = sin_lookup(ang);
-    int cos_val = cos_lookup(ang);
-    int x_dir = d;
-
-    // Upper arm to elbow
-    int elbow_dist = 10;
-    int elbow_x = sarm_x + x_dir * (sin_val * elbow_dist) / TRIG_MAX_RATIO;
-    int elbow_y = sarm_y - (cos_val * elbow_dist) / TRIG_MAX_RATIO;
-
-    // Forearm to hand
-    int arm_len = 10;
-    int hand_x = elbow_x + x_dir * (sin_val * arm_len) / TRIG_MAX_RATIO;
-    int hand_y = elbow_y - (cos_val * arm_len) / TRIG_MAX_RATIO;
-
-    // Sword tip
-    int slen = 50;
-    int tip_x = hand_x + x_dir * (sin_val * slen) / TRIG_MAX_RATIO;
-    int tip_y = hand_y - (cos_val * slen) / TRIG_MAX_RATIO;
-
-    if (hand) *hand = (GPoint){ hand_x, hand_y };
-    if (tip) *tip  = (GPoint){ tip_x, tip_y };
+    graphics_context_set_stroke_color(ctx, color);
+    graphics_context_set_stroke_width(ctx, width);
+    graphics_draw_line(ctx, a, b);
 }
 
-static bool line_intersect(GPoint a1, GPoint a2, GPoint b1, GPoint b2, int16_t *ix, int16_t *iy) {
-    // Integer line intersection using determinants
-    int32_t x1 = a1.x, y1 = a1.y;
-    int32_t x2 = a2.x, y2 = a2.y;
-    int32_t x3 = b1.x, y3 = b1.y;
-    int32_t x4 = b2.x, y4 = b2.y;
-
-    int32_t den = (x1 - x2) * (y3 - y4) - (y1 - y2) * (x3 - x4);
-    if (den == 0) return false;
-
-    int32_t num_t = (x1 - x3) * (y3 - y4) - (y1 - y3) * (x3 - x4);
-    int32_t num_u = (x1 - x3) * (y1 - y2) - (y1 - y3) * (x1 - x2);
-
-    // Check segment overlap 0..1 using integer space
-    // Instead of dividing, compare signs and ranges approximately
-    // We compute t and u with integer division for position
-    int32_t t_num = num_t;
-    int32_t u_num = num_u;
-
-    // Intersection point
-    int32_t ix32 = x1 * den + t_num * (x2 - x1);
-    int32_t iy32 = y1 * den + t_num * (y2 - y1);
-
-    // Determine if within segments: 0 <= t,u <= den, considering sign of den
-    bool within_t = (den > 0) ? (t_num >= 0 && t_num <= den) : (t_num <= 0 && t_num >= den);
-    bool within_u = (den > 0) ? (u_num >= 0 && u_num <= den) : (u_num <= 0 && u_num >= den);
-
-    if (within_t && within_u) {
-        if (ix) *ix = (int16_t)(ix32 / den);
-        if (iy) *iy = (int16_t)(iy32 / den);
-        return true;
-    }
+// For aplite (B/W), give the Prince a black outline to improve silhouette
+static bool fighter_outline(bool is_prince) {
+#ifndef PBL_COLOR
+    return is_prince;
+#else
     return false;
+#endif
 }
 
-// ===========================================================================
-// DRAW DETAILED CHARACTER
-// ===========================================================================
-static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
-    int x = f->x;
-    int y = GROUND_Y;
-#if ENABLE_CLASH_SHAKE
-    // Optional subtle camera shake
-    x += s_shake_dx;
-    y += s_shake_dy;
-#endif
+// Legs, torso, back arm and head: depends on the body pose values only, so
+// settled poses are baked into the sprite atlas (see bake_pose)
+static void draw_fighter_body(GContext *ctx, const Fighter *f, bool is_prince, GPoint feet) {
+    int x = feet.x;
+    int y = feet.y;
     int d = f->dir;
 
     // Use interpolated values
@@ -335,8 +174,6 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     int step_fwd = f->cur_step_fwd * d;
     int step_back = f->cur_step_back * d;
     int crouch = f->cur_crouch;
-    int sword_ang = f->cur_sword_ang;
-    int arm_raise = f->cur_arm_raise;
 
     int cx = x + lean;
     int cy = y + crouch;
@@ -344,27 +181,7 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     // Colors
     GColor pants_col = is_prince ? COL_PRINCE : COL_GUARD;
     GColor vest_col = is_prince ? COL_PRINCE_V : COL_GUARD_V;
-    GColor sword_col = is_prince ? COL_SWORD_P : COL_SWORD_G;
-
-    // For aplite (B/W), give the Prince a black outline to improve silhouette
-    bool outline_white = false;
-#ifndef PBL_COLOR
-    if (is_prince) outline_white = true;
-#endif
-
-    // Helper to draw an outlined line for better readability on B/W
-    void draw_line_outlined(GPoint a, GPoint b, int width, GColor color, bool outline) {
-#ifndef PBL_COLOR
-        if (outline) {
-            graphics_context_set_stroke_color(ctx, GColorBlack);
-            graphics_context_set_stroke_width(ctx, width + 2);
-            graphics_draw_line(ctx, a, b);
-        }
-#endif
-        graphics_context_set_stroke_color(ctx, color);
-        graphics_context_set_stroke_width(ctx, width);
-        graphics_draw_line(ctx, a, b);
-    }
+    bool outline_white = fighter_outline(is_prince);
 
     // === LEGS WITH BAGGY PANTS ===
     int hip_y = cy - 30;
@@ -376,14 +193,14 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     int fk_y = knee_y - (f->pose == P_THRUST ? 6 : 0);
 
     // Back leg - thigh (baggy)
-    draw_line_outlined(GPoint(cx - 3*d, hip_y), GPoint(back_knee, knee_y), 11, pants_col, outline_white);
+    draw_line_outlined(ctx, GPoint(cx - 3*d, hip_y), GPoint(back_knee, knee_y), 11, pants_col, outline_white);
     // Back leg - calf (tapered)
-    draw_line_outlined(GPoint(back_knee, knee_y), GPoint(back_foot, cy - 2), 5, pants_col, outline_white);
+    draw_line_outlined(ctx, GPoint(back_knee, knee_y), GPoint(back_foot, cy - 2), 5, pants_col, outline_white);
 
     // Front leg - thigh (baggier)
-    draw_line_outlined(GPoint(cx + 3*d, hip_y), GPoint(front_knee, fk_y), 13, pants_col, outline_white);
+    draw_line_outlined(ctx, GPoint(cx + 3*d, hip_y), GPoint(front_knee, fk_y), 13, pants_col, outline_white);
     // Front leg - calf
-    draw_line_outlined(GPoint(front_knee, fk_y), GPoint(front_foot, cy - 2), 5, pants_col, outline_white);
+    draw_line_outlined(ctx, GPoint(front_knee, fk_y), GPoint(front_foot, cy - 2), 5, pants_col, outline_white);
 
     // Ankle wraps / gathered pants
     graphics_context_set_stroke_width(ctx, 1);
@@ -402,10 +219,10 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     int waist_y = cy - 32;
 
     // Torso base (vest)
-    draw_line_outlined(GPoint(cx, shoulder_y + 2), GPoint(cx, chest_y), 10, vest_col, outline_white);
+    draw_line_outlined(ctx, GPoint(cx, shoulder_y + 2), GPoint(cx, chest_y), 10, vest_col, outline_white);
 
     // Waist (slimmer with belt)
-    draw_line_outlined(GPoint(cx, chest_y), GPoint(cx, waist_y), 6, vest_col, outline_white);
+    draw_line_outlined(ctx, GPoint(cx, chest_y), GPoint(cx, waist_y), 6, vest_col, outline_white);
 
     // Belt / sash
     graphics_context_set_stroke_color(ctx, COL_BELT);
@@ -426,8 +243,8 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
 
     if (f->pose == P_THRUST) {
         // Arm stretched back for balance
-        draw_line_outlined(GPoint(back_arm_x, shoulder_y + 5),
-                           GPoint(back_arm_x - 12*d, shoulder_y + 14), 4, COL_SKIN, outline_white);
+        draw_line_outlined(ctx, GPoint(back_arm_x, shoulder_y + 5),
+                                GPoint(back_arm_x - 12*d, shoulder_y + 14), 4, COL_SKIN, outline_white);
         // Hand
         graphics_context_set_fill_color(ctx, COL_SKIN);
         graphics_fill_circle(ctx, GPoint(back_arm_x - 13*d, shoulder_y + 15), 3);
@@ -435,8 +252,8 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
         // Arm at side or slightly bent
         int elbow_x = back_arm_x - 4*d;
         int elbow_y = shoulder_y + 14;
-        draw_line_outlined(GPoint(back_arm_x, shoulder_y + 5), GPoint(elbow_x, elbow_y), 4, COL_SKIN, outline_white);
-        draw_line_outlined(GPoint(elbow_x, elbow_y), GPoint(elbow_x - 2*d, waist_y - 2), 4, COL_SKIN, outline_white);
+        draw_line_outlined(ctx, GPoint(back_arm_x, shoulder_y + 5), GPoint(elbow_x, elbow_y), 4, COL_SKIN, outline_white);
+        draw_line_outlined(ctx, GPoint(elbow_x, elbow_y), GPoint(elbow_x - 2*d, waist_y - 2), 4, COL_SKIN, outline_white);
     }
 
     // === HEAD ===
@@ -472,43 +289,38 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     graphics_fill_circle(ctx, GPoint(head_x + 2*d, head_y - 1), 1);
 
     // Neck
-    draw_line_outlined(GPoint(head_x, head_y + 6), GPoint(cx, shoulder_y + 2), 3, COL_SKIN, outline_white);
-
-    // === SWORD ARM ===
-    int sarm_x = cx + 6 * d;
-    int sarm_y = shoulder_y + 5 - arm_raise;
+    draw_line_outlined(ctx, GPoint(head_x, head_y + 6), GPoint(cx, shoulder_y + 2), 3, COL_SKIN, outline_white);
+}
 
-    // Convert angle - 90 degrees = pointing toward opponent
-    int32_t ang = (sword_ang * TRIG_MAX_ANGLE) / 360;
+// Sword arm and sword: follows the fast sword angle, always vector drawn
+static void draw_sword_arm(GContext *ctx, const Fighter *f, bool is_prince, GPoint feet) {
+    // Flip X offsets for guard so sword points LEFT (toward prince)
+    int d = f->dir;
+    const SwordAngle *a = f->sword;  // Baked trig for the current angle
 
-    // Calculate sword direction - MUST point toward center/opponent
-    int sin_val = sin_lookup(ang);
-    int cos_val = cos_lookup(ang);
+    GColor sword_col = is_prince ? COL_SWORD_P : COL_SWORD_G;
+    bool outline_white = fighter_outline(is_prince);
 
-    // Flip X direction for guard so sword points LEFT (toward prince)
-    int x_dir = d;  // +1 for prince (right), -1 for guard (left)
+    // === SWORD ARM ===
+    GPoint sarm = sword_shoulder(f, feet);
 
     // Upper arm
-    int elbow_dist = 10;
-    int elbow_x = sarm_x + x_dir * (sin_val * elbow_dist) / TRIG_MAX_RATIO;
-    int elbow_y = sarm_y - (cos_val * elbow_dist) / TRIG_MAX_RATIO;
-
-    draw_line_outlined(GPoint(sarm_x, sarm_y), GPoint(elbow_x, elbow_y), 4, COL_SKIN, outline_white);
+    int elbow_x = sarm.x + d * a->sin10;
+    int elbow_y = sarm.y - a->cos10;
+    draw_line_outlined(ctx, sarm, GPoint(elbow_x, elbow_y), 4, COL_SKIN, outline_white);
 
     // Forearm
-    int arm_len = 10;
-    int hand_x = elbow_x + x_dir * (sin_val * arm_len) / TRIG_MAX_RATIO;
-    int hand_y = elbow_y - (cos_val * arm_len) / TRIG_MAX_RATIO;
-    draw_line_outlined(GPoint(elbow_x, elbow_y), GPoint(hand_x, hand_y), 3, COL_SKIN, outline_white);
+    int hand_x = elbow_x + d * a->sin10;
+    int hand_y = elbow_y - a->cos10;
+    draw_line_outlined(ctx, GPoint(elbow_x, elbow_y), GPoint(hand_x, hand_y), 3, COL_SKIN, outline_white);
 
     // Hand
     graphics_context_set_fill_color(ctx, COL_SKIN);
     graphics_fill_circle(ctx, GPoint(hand_x, hand_y), 3);
 
     // === SWORD === Long enough to REACH opponent!
-    int slen = 50;
-    int tip_x = hand_x + x_dir * (sin_val * slen) / TRIG_MAX_RATIO;
-    int tip_y = hand_y - (cos_val * slen) / TRIG_MAX_RATIO;
+    int tip_x = hand_x + d * a->sin50;
+    int tip_y = hand_y - a->cos50;
 
     // Blade - thick and visible
     graphics_context_set_stroke_color(ctx, sword_col);
@@ -519,31 +331,67 @@ static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
     #ifdef PBL_COLOR
     graphics_context_set_stroke_color(ctx, GColorWhite);
     graphics_context_set_stroke_width(ctx, 1);
-    int mid_x = hand_x + x_dir * (sin_val * slen / 2) / TRIG_MAX_RATIO;
-    int mid_y = hand_y - (cos_val * slen / 2) / TRIG_MAX_RATIO;
-    graphics_draw_line(ctx, GPoint(mid_x, mid_y), GPoint(tip_x, tip_y));
+    graphics_draw_line(ctx, GPoint(hand_x + d * a->sin25, hand_y - a->cos25), GPoint(tip_x, tip_y));
     #endif
 
     // Crossguard
     graphics_context_set_stroke_color(ctx, COL_HAIR);
     graphics_context_set_stroke_width(ctx, 3);
-    int hx1 = hand_x - (cos_val * 6) / TRIG_MAX_RATIO;
-    int hy1 = hand_y - x_dir * (sin_val * 6) / TRIG_MAX_RATIO;
-    int hx2 = hand_x + (cos_val * 6) / TRIG_MAX_RATIO;
-    int hy2 = hand_y + x_dir * (sin_val * 6) / TRIG_MAX_RATIO;
-    graphics_draw_line(ctx, GPoint(hx1, hy1), GPoint(hx2, hy2));
+    graphics_draw_line(ctx, GPoint(hand_x - a->cos6, hand_y - d * a->sin6),
+                            GPoint(hand_x + a->cos6, hand_y + d * a->sin6));
 
     // Pommel
     graphics_context_set_fill_color(ctx, COL_HAIR);
-    int pom_x = hand_x - x_dir * (sin_val * 4) / TRIG_MAX_RATIO;
-    int pom_y = hand_y + (cos_val * 4) / TRIG_MAX_RATIO;
-    graphics_fill_circle(ctx, GPoint(pom_x, pom_y), 2);
+    graphics_fill_circle(ctx, GPoint(hand_x - d * a->sin4, hand_y + a->cos4), 2);
+}
+
+// Body reached its pose targets: it looks exactly like the baked sprite
+static bool fighter_settled(const Fighter *f) {
+    PoseData p = POSES[f->pose];
+    return f->cur_lean == p.lean && f->cur_step_fwd == p.step_fwd &&
+           f->cur_step_back == p.step_back && f->cur_crouch == p.crouch;
+}
+
+// Atlas layout: prince poses, then guard poses
+static uint16_t fighter_sprite(Pose pose, bool is_prince) {
+    return (is_prince ? 0 : NUM_POSES) + pose;
+}
+
+static void draw_fighter(GContext *ctx, Fighter *f, bool is_prince) {
+    GPoint feet = GPoint(f->x, GROUND_Y);
+#if ENABLE_CLASH_SHAKE
+    // Optional subtle camera shake
+    feet.x += s_shake_dx;
+    feet.y += s_shake_dy;
+#endif
+    if (!fighter_settled(f) || !sprite_atlas_draw(s_atlas, ctx, fighter_sprite(f->pose, is_prince), feet)) {
+        draw_fighter_body(ctx, f, is_prince, feet);
+    }
+    draw_sword_arm(ctx, f, is_prince, feet);
 }
 
+#if defined(SPRITE_ATLAS_BAKE)
+static void bake_pose(GContext *ctx, uint16_t index, GPoint anchor) {
+    bool is_prince = index < NUM_POSES;
+    PoseData p = POSES[index % NUM_POSES];
+    Fighter f = {
+        .x = anchor.x, .dir = is_prince ? 1 : -1, .pose = index % NUM_POSES,
+        .cur_lean = p.lean, .cur_step_fwd = p.step_fwd,
+        .cur_step_back = p.step_back, .cur_crouch = p.crouch,
+    };
+    draw_fighter_body(ctx, &f, is_prince, anchor);
+}
+
+const SpriteBake g_sprite_bake = {
+    .name = "fighters", .count = 2 * NUM_POSES,
+    .anchor = { 72, 90 }, .draw = bake_pose,
+};
+#endif
+
 // ===========================================================================
 // BACKGROUND
 // ===========================================================================
-static void draw_bg(GContext *ctx) {
+static void draw_bg(GContext *ctx, GRect bounds) {
     int h = 22;
     graphics_context_set_fill_color(ctx, COL_SKY1);
     graphics_fill_rect(ctx, GRect(0, 0, SCREEN_W, h), 0, GCornerNone);
@@ -566,151 +414,160 @@ static void draw_bg(GContext *ctx) {
 static void draw_sparks(GContext *ctx) {
     if (!s_sparks) return;
 
+    // Layers: 0 spark rings (B/W), 1 spark cores, 2-3 flash on top
+    draw_batch_begin(s_batch, ctx);
+
+    // Running over budget: thin the ring, drop the inner one
+    FrameGovernorLod lod = frame_governor_lod(s_gov);
+    int outer = lod == FRAME_GOVERNOR_LOD_FULL ? 16 : lod == FRAME_GOVERNOR_LOD_REDUCED ? 8 : 4;
+
     // Outer sparks - yellow
-    graphics_context_set_fill_color(ctx, COL_SPARK);
-    for (int i = 0; i < 16; i++) {
-        int32_t a = (s_gframe * 8000 + i * TRIG_MAX_ANGLE / 16) % TRIG_MAX_ANGLE;
-        int dist = 4 + s_spark_life * 3;
-        int sx = s_spark_x + (sin_lookup(a) * dist) / TRIG_MAX_RATIO;
-        int sy = s_spark_y + (cos_lookup(a) * dist) / TRIG_MAX_RATIO;
+    uint8_t spin = fixed_angle_index(s_gframe * 8000);
+    int dist = 4 + s_spark_life * 3;
+    for (int i = 0; i < outer; i++) {
+        uint8_t a = spin + i * (FIXED_SIN_STEPS / outer);
+        GPoint p = GPoint(s_spark_x + fixed_sin_idx_mul(a, dist), s_spark_y + fixed_cos_idx_mul(a, dist));
 #ifndef PBL_COLOR
-        graphics_context_set_fill_color(ctx, GColorBlack);
-        graphics_fill_circle(ctx, GPoint(sx, sy), 4);
-        graphics_context_set_fill_color(ctx, GColorWhite);
-        graphics_fill_circle(ctx, GPoint(sx, sy), 3);
+        draw_batch_set_layer(s_batch, 0);
+        draw_batch_fill_circle(s_batch, p, 4, GColorBlack);
+        draw_batch_set_layer(s_batch, 1);
+        draw_batch_fill_circle(s_batch, p, 3, GColorWhite);
 #else
-        graphics_fill_circle(ctx, GPoint(sx, sy), 3);
+        draw_batch_set_layer(s_batch, 1);
+        draw_batch_fill_circle(s_batch, p, 3, COL_SPARK);
 #endif
     }
 
     // Inner sparks
-    for (int i = 0; i < 8; i++) {
-        int32_t a = (s_gframe * 12000 + i * TRIG_MAX_ANGLE / 8) % TRIG_MAX_ANGLE;
-        int dist = 2 + s_spark_life;
-        int sx = s_spark_x + (sin_lookup(a) * dist) / TRIG_MAX_RATIO;
-        int sy = s_spark_y + (cos_lookup(a) * dist) / TRIG_MAX_RATIO;
+    spin = fixed_angle_index(s_gframe * 12000);
+    dist = 2 + s_spark_life;
+    for (int i = 0; lod == FRAME_GOVERNOR_LOD_FULL && i < 8; i++) {
+        uint8_t a = spin + i * (FIXED_SIN_STEPS / 8);
+        GPoint p = GPoint(s_spark_x + fixed_sin_idx_mul(a, dist), s_spark_y + fixed_cos_idx_mul(a, dist));
 #ifndef PBL_COLOR
-        graphics_context_set_fill_color(ctx, GColorBlack);
-        graphics_fill_circle(ctx, GPoint(sx, sy), 3);
-        graphics_context_set_fill_color(ctx, GColorWhite);
-        graphics_fill_circle(ctx, GPoint(sx, sy), 2);
+        draw_batch_set_layer(s_batch, 0);
+        draw_batch_fill_circle(s_batch, p, 3, GColorBlack);
+        draw_batch_set_layer(s_batch, 1);
+        draw_batch_fill_circle(s_batch, p, 2, GColorWhite);
 #else
-        graphics_fill_circle(ctx, GPoint(sx, sy), 2);
+        draw_batch_set_layer(s_batch, 1);
+        draw_batch_fill_circle(s_batch, p, 2, COL_SPARK);
 #endif
     }
 
     // Central flash - bright white
+    GPoint c = GPoint(s_spark_x, s_spark_y);
+    draw_batch_set_layer(s_batch, 2);
     #ifdef PBL_COLOR
-    graphics_context_set_fill_color(ctx, GColorWhite);
-    graphics_fill_circle(ctx, GPoint(s_spark_x, s_spark_y), 6);
-    graphics_context_set_fill_color(ctx, GColorYellow);
-    graphics_fill_circle(ctx, GPoint(s_spark_x, s_spark_y), 4);
+    draw_batch_fill_circle(s_batch, c, 6, GColorWhite);
+    draw_batch_set_layer(s_batch, 3);
+    draw_batch_fill_circle(s_batch, c, 4, GColorYellow);
     #else
     // B/W: add black ring for contrast
-    graphics_context_set_fill_color(ctx, GColorBlack);
-    graphics_fill_circle(ctx, GPoint(s_spark_x, s_spark_y), 6);
-    graphics_context_set_fill_color(ctx, GColorWhite);
-    graphics_fill_circle(ctx, GPoint(s_spark_x, s_spark_y), 5);
+    draw_batch_fill_circle(s_batch, c, 6, GColorBlack);
+    draw_batch_set_layer(s_batch, 3);
+    draw_batch_fill_circle(s_batch, c, 5, GColorWhite);
     #endif
+
+    draw_batch_flush(s_batch);
+}
+
+// ===========================================================================
+// BOUNDING BOXES (dirty-rect tracking)
+// ===========================================================================
+static GRect rect_from_points(int x0, int y0, int x1, int y1, int pad) {
+    int lx = x0 < x1 ? x0 : x1, hx = x0 < x1 ? x1 : x0;
+    int ly = y0 < y1 ? y0 : y1, hy = y0 < y1 ? y1 : y0;
+    return GRect(lx - pad, ly - pad, hx - lx + 2 * pad + 1, hy - ly + 2 * pad + 1);
+}
+
+// Body from hair to shoes plus the sword (mirrors draw_fighter geometry)
+static GRect fighter_bbox(const Fighter *f) {
+    int x = f->x + s_shake_dx;
+    int cx = x + f->cur_lean * f->dir;
+    int cy = GROUND_Y + s_shake_dy + f->cur_crouch;
+    GRect body = rect_from_points(x < cx ? x : cx, cy - 74, x < cx ? cx : x, cy + 1, 30);
+
+    GPoint hand, tip;
+    compute_sword_points(f, &hand, &tip);
+    GRect sword = rect_from_points(hand.x, hand.y, tip.x, tip.y, 8);
+
+    int x0 = body.origin.x < sword.origin.x ? body.origin.x : sword.origin.x;
+    int y0 = body.origin.y < sword.origin.y ? body.origin.y : sword.origin.y;
+    int x1 = body.origin.x + body.size.w, sx1 = sword.origin.x + sword.size.w;
+    int y1 = body.origin.y + body.size.h, sy1 = sword.origin.y + sword.size.h;
+    if (sx1 > x1) x1 = sx1;
+    if (sy1 > y1) y1 = sy1;
+    return GRect(x0, y0, x1 - x0, y1 - y0);
+}
+
+static GRect sparks_bbox(void) {
+    if (!s_sparks) return GRectZero;
+    int r = 4 + s_spark_life * 3 + 5;  // Outer ring distance + spark radius
+    if (r < 7) r = 7;                  // Central flash
+    return rect_from_points(s_spark_x, s_spark_y, s_spark_x, s_spark_y, r);
 }
 
 // ===========================================================================
 // CANVAS
 // ===========================================================================
 static void canvas_proc(Layer *l, GContext *ctx) {
-    draw_bg(ctx);
-    draw_fighter(ctx, &s_guard, false);
-    draw_fighter(ctx, &s_prince, true);
-    draw_sparks(ctx);
+    // Runs per dirty clip layer: restore the background, redraw what overlaps
+    frame_governor_render_begin(s_gov);
+    PROFILE_BEGIN(PROF_BG);
+    bg_cache_draw(s_bg, ctx, layer_get_bounds(s_canvas));
+    PROFILE_END(PROF_BG);
+
+    PROFILE_BEGIN(PROF_FIGHTER);
+    if (dirty_tracker_overlaps(l, fighter_bbox(&s_guard))) draw_fighter(ctx, &s_guard, false);
+    if (dirty_tracker_overlaps(l, fighter_bbox(&s_prince))) draw_fighter(ctx, &s_prince, true);
+    PROFILE_END(PROF_FIGHTER);
+
+    PROFILE_BEGIN(PROF_SPARKS);
+    if (dirty_tracker_overlaps(l, sparks_bbox())) draw_sparks(ctx);
+    PROFILE_END(PROF_SPARKS);
+    frame_governor_render_end(s_gov);
 }
 
 // ===========================================================================
 // ANIMATION
 // ===========================================================================
-static void init_fighter(Fighter *f, int16_t x, int8_t dir) {
-    f->x = x;
-    f->dir = dir;
-    f->pose = P_READY;
-    PoseData p = POSES[P_READY];
-    f->cur_lean = p.lean;
-    f->cur_step_fwd = p.step_fwd;
-    f->cur_step_back = p.step_back;
-    f->cur_crouch = p.crouch;
-    f->cur_sword_ang = p.sword_ang;
-    f->cur_arm_raise = p.arm_raise;
+static void load_fighter(Fighter *f, const FighterKey *k) {
+    f->x = k->x;
+    f->pose = k->pose;
+    f->cur_lean = k->lean;
+    f->cur_step_fwd = k->step_fwd;
+    f->cur_step_back = k->step_back;
+    f->cur_crouch = k->crouch;
+    f->cur_arm_raise = k->arm_raise;
+    f->sword = &FIGHT_SWORDS[k->sword];
 }
 
 static void update_anim(void) {
-    s_seq_frame++;
-    Move m = s_seq[s_seq_idx];
-
-    if (s_seq_frame >= m.dur) {
-        s_seq_frame = 0;
-        s_seq_idx = (s_seq_idx + 1) % NUM_SEQ;
-
-        // Do not hard-reset positions at loop; keep continuous flow
-
-        // Keep fighters separate - no overlapping!
-        if (s_prince.x < 30) s_prince.x = 30;
-        if (s_prince.x > SCREEN_W/2 - 20) s_prince.x = SCREEN_W/2 - 20;
-        if (s_guard.x > SCREEN_W - 30) s_guard.x = SCREEN_W - 30;
-        if (s_guard.x < SCREEN_W/2 + 20) s_guard.x = SCREEN_W/2 + 20;
-
-        Move next = s_seq[s_seq_idx];
-        s_prince.pose = next.prince;
-        s_guard.pose = next.guard;
-
-        if (next.clash) {
-            // Trigger sparks on impact
-            s_sparks = true;
-            s_spark_life = 10;
-
-            // Compute where blades cross for spark position
-            GPoint p_hand, p_tip, g_hand, g_tip;
-            compute_sword_points(&s_prince, &p_hand, &p_tip);
-            compute_sword_points(&s_guard, &g_hand, &g_tip);
-
-            int16_t ix = 0, iy = 0;
-            if (line_intersect(p_hand, p_tip, g_hand, g_tip, &ix, &iy)) {
-                s_spark_x = ix;
-                s_spark_y = iy;
-            } else {
-                // Fallback: average mid-blade points
-                GPoint p_mid = (GPoint){ (p_hand.x + p_tip.x) / 2, (p_hand.y + p_tip.y) / 2 };
-                GPoint g_mid = (GPoint){ (g_hand.x + g_tip.x) / 2, (g_hand.y + g_tip.y) / 2 };
-                s_spark_x = (p_mid.x + g_mid.x) / 2;
-                s_spark_y = (p_mid.y + g_mid.y) / 2;
-            }
+    // Poses, positions and clashes are baked (fight_bake.c): look them up
+    const FightFrame *frame = &FIGHT_TABLE[s_fight_frame];
+    load_fighter(&s_prince, &frame->prince);
+    load_fighter(&s_guard, &frame->guard);
 
-#if ENABLE_CLASH_SHAKE
-            // Optional subtle camera shake (battery-friendly)
-            if (s_battery > 20) {
-                s_shake_frames = 1;  // 1 frame only
-                s_shake_mag = 1;     // minimal offset
-            }
-#endif
+    const FightClash *clash = &FIGHT_CLASHES[s_next_clash];
+    if (FIGHT_CLASH_COUNT > 0 && clash->frame == s_fight_frame) {
+        s_next_clash = (s_next_clash + 1) % FIGHT_CLASH_COUNT;
 
+        // Trigger sparks on impact, where the blades cross
+        s_sparks = true;
+        s_spark_life = 10;
+        s_spark_x = clash->x;
+        s_spark_y = clash->y;
+
+#if ENABLE_CLASH_SHAKE
+        // Optional subtle camera shake (battery-friendly)
+        if (s_battery > 20) {
+            s_shake_frames = 1;  // 1 frame only
+            s_shake_mag = 1;     // minimal offset
         }
+#endif
     }
-
-    // Smooth interpolation every frame
-    update_fighter_interpolation(&s_prince);
-    update_fighter_interpolation(&s_guard);
-
-    // Movement - keep them on screen and close!
-    if (s_prince.pose == P_STEP_FWD && s_prince.x < s_guard.x - 20) s_prince.x += 1;
-    else if (s_prince.pose == P_STEP_BACK && s_prince.x > 35) s_prince.x -= 1;
-    else if (s_prince.pose == P_STRUCK && s_prince.x > 35) s_prince.x -= 1;
-
-    if (s_guard.pose == P_STEP_FWD && s_guard.x > s_prince.x + 20) s_guard.x -= 1;
-    else if (s_guard.pose == P_STEP_BACK && s_guard.x < SCREEN_W - 35) s_guard.x += 1;
-    else if (s_guard.pose == P_STRUCK && s_guard.x < SCREEN_W - 35) s_guard.x += 1;
-
-    // Hard bounds - keep separate, swords meet in middle!
-    if (s_prince.x < 30) s_prince.x = 30;
-    if (s_prince.x > SCREEN_W/2 - 20) s_prince.x = SCREEN_W/2 - 20;
-    if (s_guard.x > SCREEN_W - 30) s_guard.x = SCREEN_W - 30;
-    if (s_guard.x < SCREEN_W/2 + 20) s_guard.x = SCREEN_W/2 + 20;
+    s_fight_frame = (s_fight_frame + 1) % FIGHT_FRAMES;
 
     if (s_sparks) {
         s_spark_life--;
@@ -735,26 +592,47 @@ static void update_anim(void) {
 #endif
 }
 
-static void timer_cb(void *data) {
+static void frame_cb(void *data) {
     s_gframe++;
+    PROFILE_BEGIN(PROF_UPDATE);
     update_anim();
-    layer_mark_dirty(s_canvas);
 
-    int ms = (s_battery <= 20) ? ANIM_MS * 2 : ANIM_MS;
-    s_timer = app_timer_register(ms, timer_cb, NULL);
+    dirty_tracker_set_bbox(s_dirty, DIRTY_PRINCE, fighter_bbox(&s_prince));
+    dirty_tracker_set_bbox(s_dirty, DIRTY_GUARD, fighter_bbox(&s_guard));
+    dirty_tracker_set_bbox(s_dirty, DIRTY_SPARKS, sparks_bbox());
+    if (!bg_cache_is_valid(s_bg)) dirty_tracker_mark_all(s_dirty);
+    dirty_tracker_commit(s_dirty);
+    PROFILE_END(PROF_UPDATE);
+
+    PROFILE_FRAME(frame_governor_interval(s_gov));
 }
 
+static const TimeTextConfig TT_CFG = { .date_format = "%a %b %d", .pad_hour = true };
+
 static void tick_cb(struct tm *t, TimeUnits u) {
-    strftime(s_time_buf, sizeof(s_time_buf), clock_is_24h_style() ? "%H:%M" : "%I:%M", t);
-    text_layer_set_text(s_time_lyr, s_time_buf);
-    strftime(s_date_buf, sizeof(s_date_buf), "%a %b %d", t);
-    text_layer_set_text(s_date_lyr, s_date_buf);
+    // Text layers have no background: erase under the strings that changed
+    uint8_t changed = time_text_update(s_tt, t, u);
+    if (changed & TIME_TEXT_TIME) dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_time_lyr)));
+    if (changed & TIME_TEXT_DATE) dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_date_lyr)));
+    if (changed) dirty_tracker_commit(s_dirty);  // The text redraws now, not next frame
+}
+
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_cb(void *context) {
+    bg_cache_invalidate(s_bg);
+    dirty_tracker_mark_all(s_dirty);
+    dirty_tracker_commit(s_dirty);
 }
+#endif
 
 static void battery_cb(BatteryChargeState s) {
     s_battery = s.charge_percent;
+    frame_governor_set_battery(s_gov, s);
     snprintf(s_batt_buf, sizeof(s_batt_buf), "%d%%", s_battery);
     text_layer_set_text(s_batt_lyr, s_batt_buf);
+    // Text layers have no background: erase the old percentage
+    dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_batt_lyr)));
+    dirty_tracker_commit(s_dirty);
 }
 
 // ===========================================================================
@@ -765,8 +643,20 @@ static void win_load(Window *w) {
     GRect b = layer_get_bounds(root);
 
     s_canvas = layer_create(b);
-    layer_set_update_proc(s_canvas, canvas_proc);
     layer_add_child(root, s_canvas);
+    s_dirty = dirty_tracker_create(s_canvas, NUM_DIRTY, canvas_proc);
+
+    s_bg = bg_cache_create(draw_bg);
+    s_batch = draw_batch_create(SPARK_BATCH_SIZE);
+#ifdef PBL_COLOR
+    // Color only: B/W keeps the vector bodies (see create_sprite_atlas.py)
+    s_atlas = sprite_atlas_create(RESOURCE_ID_FIGHTERS, FIGHTERS_FRAMES, FIGHTERS_COUNT);
+#endif
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers){
+        .did_change = unobstructed_cb
+    }, NULL);
+#endif
 
     s_time_lyr = text_layer_create(GRect(0, 4, b.size.w, 32));
     text_layer_set_background_color(s_time_lyr, GColorClear);
@@ -775,8 +665,9 @@ static void win_load(Window *w) {
     text_layer_set_text_alignment(s_time_lyr, GTextAlignmentCenter);
     layer_add_child(root, text_layer_get_layer(s_time_lyr));
 
-    // Battery indicator at top right
-    s_batt_lyr = text_layer_create(GRect(b.size.w - 38, 4, 36, 16));
+    // Battery indicator at top right (a line lower on round: the corner is
+    // masked off and the time fills the top row)
+    s_batt_lyr = text_layer_create(round_mask_fit_rect(b, GRect(b.size.w - 38, PBL_IF_ROUND_ELSE(36, 4), 36, 16)));
     text_layer_set_background_color(s_batt_lyr, GColorClear);
     text_layer_set_text_color(s_batt_lyr, COL_TIME);
     text_layer_set_font(s_batt_lyr, fonts_get_system_font(FONT_KEY_GOTHIC_14));
@@ -790,13 +681,21 @@ static void win_load(Window *w) {
     text_layer_set_text_alignment(s_date_lyr, GTextAlignmentCenter);
     layer_add_child(root, text_layer_get_layer(s_date_lyr));
 
-    init_fighter(&s_prince, PRINCE_X, 1);
-    init_fighter(&s_guard, GUARD_X, -1);
+    PROFILE_INIT(PROF_NAMES, NUM_PROF);
+    PROFILE_HUD_ATTACH(root, GRect(0, 36, 84, 52));
 
-    s_timer = app_timer_register(ANIM_MS, timer_cb, NULL);
+    // Last frame of the loop: where the first update continues from
+    s_prince.dir = 1;
+    s_guard.dir = -1;
+    load_fighter(&s_prince, &FIGHT_TABLE[FIGHT_FRAMES - 1].prince);
+    load_fighter(&s_guard, &FIGHT_TABLE[FIGHT_FRAMES - 1].guard);
 
-    time_t now = time(NULL);
-    tick_cb(localtime(&now), MINUTE_UNIT);
+    s_gov = frame_governor_create(&GOV_CFG, frame_cb, NULL);
+    frame_governor_set_battery(s_gov, battery_state_service_peek());
+    frame_governor_run(s_gov, true);
+
+    s_tt = time_text_create(&TT_CFG, s_time_lyr, s_date_lyr);
+    time_text_refresh(s_tt);
 
     // Initialize battery display
     snprintf(s_batt_buf, sizeof(s_batt_buf), "%d%%", s_battery);
@@ -804,7 +703,22 @@ static void win_load(Window *w) {
 }
 
 static void win_unload(Window *w) {
-    if (s_timer) app_timer_cancel(s_timer);
+    frame_governor_destroy(s_gov);
+    s_gov = NULL;
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+#endif
+    PROFILE_DEINIT();
+    bg_cache_destroy(s_bg);
+    s_bg = NULL;
+    dirty_tracker_destroy(s_dirty);
+    s_dirty = NULL;
+    draw_batch_destroy(s_batch);
+    s_batch = NULL;
+    sprite_atlas_destroy(s_atlas);
+    s_atlas = NULL;
+    time_text_destroy(s_tt);
+    s_tt = NULL;
     text_layer_destroy(s_time_lyr);
     text_layer_destroy(s_date_lyr);
     text_layer_destroy(s_batt_lyr);
@@ -816,7 +730,7 @@ static void win_unload(Window *w) {
 // ===========================================================================
 static void init(void) {
     s_win = window_create();
-    window_set_background_color(s_win, GColorBlack);
+    window_set_background_color(s_win, GColorClear);  // keep last frame (dirty rects)
     window_set_window_handlers(s_win, (WindowHandlers){
         .load = win_load, .unload = win_unload
     });
@@ -0,0 +1,115 @@
+/**
+ * Path Pool - see path_pool.h
+ */
+
+#include <pebble.h>
+#include "path_pool.h"
+
+typedef struct {
+    GPath *path;
+    GPoint *scratch;            // Owned point buffer, NULL for fixed shapes
+    uint16_t max_points;
+} PoolEntry;
+
+struct PathPool {
+    uint8_t capacity;
+    uint8_t count;
+    PoolEntry entries[];
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static PoolEntry *prv_entry(PathPool *pool, int id) {
+    if (!pool || id < 0 || id >= pool->count) return NULL;
+    return &pool->entries[id];
+}
+
+static int prv_push(PathPool *pool, GPoint *points, uint16_t num_points, GPoint *scratch) {
+    if (!pool || pool->count >= pool->capacity) return -1;
+
+    // gpath_create() only stores the pointer; the points are never written
+    GPathInfo info = { .num_points = num_points, .points = points };
+    GPath *path = gpath_create(&info);
+    if (!path) return -1;
+
+    PoolEntry *entry = &pool->entries[pool->count];
+    entry->path = path;
+    entry->scratch = scratch;
+    entry->max_points = num_points;
+    return pool->count++;
+}
+
+static GPath *prv_place(PathPool *pool, int id, GPoint offset, int32_t angle) {
+    PoolEntry *entry = prv_entry(pool, id);
+    if (!entry) return NULL;
+    gpath_move_to(entry->path, offset);
+    gpath_rotate_to(entry->path, angle);
+    return entry->path;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+PathPool *path_pool_create(uint8_t capacity) {
+    PathPool *pool = calloc(1, sizeof(PathPool) + capacity * sizeof(PoolEntry));
+    if (!pool) return NULL;
+    pool->capacity = capacity;
+    return pool;
+}
+
+void path_pool_destroy(PathPool *pool) {
+    if (!pool) return;
+    for (int i = 0; i < pool->count; i++) {
+        gpath_destroy(pool->entries[i].path);
+        free(pool->entries[i].scratch);
+    }
+    free(pool);
+}
+
+int path_pool_add(PathPool *pool, const GPoint *points, uint16_t num_points) {
+    return prv_push(pool, (GPoint *)points, num_points, NULL);
+}
+
+int path_pool_add_scratch(PathPool *pool, uint16_t max_points) {
+    if (!pool || pool->count >= pool->capacity) return -1;
+    GPoint *scratch = calloc(max_points, sizeof(GPoint));
+    if (!scratch) return -1;
+
+    int id = prv_push(pool, scratch, max_points, scratch);
+    if (id < 0) {
+        free(scratch);
+        return -1;
+    }
+    pool->entries[id].path->num_points = 0;  // Nothing to draw until set
+    return id;
+}
+
+void path_pool_set_points(PathPool *pool, int id, const GPoint *points, uint16_t num_points) {
+    PoolEntry *entry = prv_entry(pool, id);
+    if (!entry || !entry->scratch) return;
+    if (num_points > entry->max_points) num_points = entry->max_points;
+    memcpy(entry->scratch, points, num_points * sizeof(GPoint));
+    entry->path->num_points = num_points;
+}
+
+GPath *path_pool_get(PathPool *pool, int id) {
+    PoolEntry *entry = prv_entry(pool, id);
+    return entry ? entry->path : NULL;
+}
+
+void path_pool_fill(PathPool *pool, GContext *ctx, int id, GPoint offset, int32_t angle) {
+    GPath *path = prv_place(pool, id, offset, angle);
+    if (path && path->num_points > 2) {
+        gpath_draw_filled(ctx, path);
+    }
+}
+
+void path_pool_outline(PathPool *pool, GContext *ctx, int id, GPoint offset, int32_t angle) {
+    GPath *path = prv_place(pool, id, offset, angle);
+    if (path && path->num_points > 1) {
+        gpath_draw_outline(ctx, path);
+    }
+}
@@ -6,20 +6,31 @@
  */
 
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/frame_governor.h"
+#include "lib/path_pool.h"
+#include "lib/scheduler.h"
+#include "lib/state_store.h"
+#include "lib/time_text.h"
+#include "plant_state.h"
 
 // ============================================================================
 // CONFIGURATION
 // ============================================================================
 
-#define ANIMATION_INTERVAL 50
-#define ANIMATION_INTERVAL_LOW_POWER 100
+#define ANIMATION_INTERVAL 50        // Watering splash, growth burst
+#define ANIMATION_INTERVAL_IDLE 200  // Gentle sway only
+#define MAX_INTERVAL 1000
 #define LOW_BATTERY_THRESHOLD 20
+#define ANIMATION_BURST_MS 10000     // Animate this long after a tap, then freeze
 
-// Game mechanics
-#define WATER_MAX 100
+// Game mechanics (water max and decay rate: plant_state.h)
 #define WATER_PER_PRESS 30
-#define WATER_DECAY_INTERVAL 1800   // 30 minutes in seconds
-#define WATER_DECAY_AMOUNT 12
+#define WATER_CHECK_MS 60000       // Decay check, rides on ticks and frames
+#define PLANT_SAVE_MS 300000       // Longest a change waits for its flash write
+
+// Face-only key (plant_state.h holds the ones the worker shares)
+#define STORAGE_KEY_WORKER_ASKED 2  // The user was asked to allow the worker
 
 // Growth thresholds
 #define WATER_THRIVING_MIN 70
@@ -32,20 +43,11 @@
 // Water drops for splash effect
 #define MAX_WATER_DROPS 5
 
-// Persistent storage keys
-#define STORAGE_KEY_PLANT 1
-
 // ============================================================================
 // DATA STRUCTURES
 // ============================================================================
 
-typedef enum {
-    STAGE_SEED = 0,
-    STAGE_SPROUT = 1,
-    STAGE_SMALL = 2,
-    STAGE_FULL = 3,
-    STAGE_FLOWERING = 4
-} GrowthStage;
+// GrowthStage and the persisted PlantState: plant_state.h (shared with the worker)
 
 typedef enum {
     HEALTH_THRIVING = 0,
@@ -54,14 +56,6 @@ typedef enum {
     HEALTH_WILTING = 3
 } HealthState;
 
-typedef struct {
-    GrowthStage stage;
-    uint8_t water_level;
-    uint8_t growth_progress;
-    time_t last_watered;
-    uint16_t total_waters;
-} PlantState;
-
 typedef struct {
     GPoint pos;
     int16_t vel_x;
@@ -78,7 +72,20 @@ static Window *s_main_window;
 static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
-static AppTimer *s_animation_timer;
+static FrameGovernor *s_governor;  // Owns the animation timer
+static Scheduler *s_scheduler;     // Water decay, no wakeups of its own
+static StateStore *s_plant_store;  // Coalesces plant writes, flushes on exit
+static TimeText *s_time_text;      // Sets only the text that changed
+static BgCache *s_bg_cache;  // Sky and pot, rendered once
+static PathPool *s_paths;    // Created at load, reused every draw
+
+enum { PATH_POT, NUM_PATHS };
+
+// Pot body trapezoid (wider at top) relative to the bottom center; the
+// 4px rim sits above it
+static const GPoint POT_POINTS[] = {
+    {-30, -21}, {30, -21}, {22, 0}, {-22, 0}
+};
 
 static PlantState s_plant;
 static WaterDrop s_drops[MAX_WATER_DROPS];
@@ -157,30 +164,55 @@ static HealthState get_health_state(void) {
 // PERSISTENCE
 // ============================================================================
 
+// The worker sleeps until its next decay step; that may have moved
+static void plant_written(const void *data) {
+    if (app_worker_is_running()) {
+        AppWorkerMessage msg = { 0 };
+        app_worker_send_message(PLANT_MSG_WATERED, &msg);
+    }
+}
+
+static const StateStoreConfig PLANT_STORE_CONFIG = {
+    .key = STORAGE_KEY_PLANT,
+    .version = PLANT_STATE_VERSION,
+    .interval_ms = PLANT_SAVE_MS,
+    .did_write = plant_written,
+};
+
+// Queued, not written: a watering splash doesn't wait on flash
 static void save_plant_state(void) {
-    persist_write_data(STORAGE_KEY_PLANT, &s_plant, sizeof(PlantState));
+    state_store_mark_dirty(s_plant_store);
 }
 
-static void load_plant_state(void) {
-    if (persist_exists(STORAGE_KEY_PLANT)) {
-        persist_read_data(STORAGE_KEY_PLANT, &s_plant, sizeof(PlantState));
+// Before the versioned store the key held the bare struct
+static bool load_legacy_plant_state(void) {
+    if (persist_get_size(STORAGE_KEY_PLANT) != (int)sizeof(PlantState)) return false;
+    persist_read_data(STORAGE_KEY_PLANT, &s_plant, sizeof(PlantState));
+    save_plant_state();  // Rewrite in the new layout
+    return true;
+}
+
+#if defined(PLANT_WORKER)
+// Launching prompts the user when another app's worker runs, and replaces it
+// if they accept. Ask once: after a decline, or once that other worker takes
+// over again, the face just catches up on load.
+static void launch_worker(void) {
+    if (app_worker_is_running() || persist_exists(STORAGE_KEY_WORKER_ASKED)) return;
+    if (app_worker_launch() == APP_WORKER_RESULT_ASKING_CONFIRMATION) {
+        persist_write_bool(STORAGE_KEY_WORKER_ASKED, true);
+    }
+}
+#endif
 
+static void load_plant_state(void) {
+    s_plant_store = state_store_create(&PLANT_STORE_CONFIG, &s_plant, sizeof(s_plant));
+    if (state_store_load(s_plant_store) || load_legacy_plant_state()) {
         // Validate
         if (s_plant.stage > STAGE_FLOWERING) s_plant.stage = STAGE_SEED;
         if (s_plant.water_level > WATER_MAX) s_plant.water_level = WATER_MAX;
 
-        // Apply decay since last run
-        time_t now = time(NULL);
-        if (s_plant.last_watered > 0) {
-            int32_t elapsed = now - s_plant.last_watered;
-            int intervals = elapsed / WATER_DECAY_INTERVAL;
-            int decay = intervals * WATER_DECAY_AMOUNT;
-            if (decay >= s_plant.water_level) {
-                s_plant.water_level = 0;
-            } else {
-                s_plant.water_level -= decay;
-            }
-        }
+        // Decay since the last save; a no-op when the worker kept it current
+        plant_state_decay(&s_plant, time(NULL));
     } else {
         // New plant
         s_plant.stage = STAGE_SEED;
@@ -188,6 +220,7 @@ static void load_plant_state(void) {
         s_plant.growth_progress = 0;
         s_plant.last_watered = time(NULL);
         s_plant.total_waters = 0;
+        save_plant_state();
     }
 }
 
@@ -218,6 +251,16 @@ static void check_plant_death(void) {
     }
 }
 
+// Scheduler task, every WATER_CHECK_MS
+static void decay_water(void *context) {
+    if (plant_state_decay(&s_plant, time(NULL))) {
+        save_plant_state();
+    }
+
+    // Check if plant has died and needs rebirth
+    check_plant_death();
+}
+
 static void start_water_splash(void) {
     int plant_top_y = s_screen_height - 60 - (s_plant.stage * 12);
 
@@ -273,16 +316,7 @@ static void draw_pot(GContext *ctx, int16_t y_base) {
 
     // Pot body (trapezoid - wider at top)
     graphics_context_set_fill_color(ctx, COLOR_POT);
-    GPoint pot_points[4] = {
-        {pot_left, pot_top + rim_height},
-        {pot_left + pot_width, pot_top + rim_height},
-        {pot_left + pot_width - 8, y_base},
-        {pot_left + 8, y_base}
-    };
-    GPathInfo pot_info = { .num_points = 4, .points = pot_points };
-    GPath *pot_path = gpath_create(&pot_info);
-    gpath_draw_filled(ctx, pot_path);
-    gpath_destroy(pot_path);
+    path_pool_fill(s_paths, ctx, PATH_POT, GPoint(s_center_x, y_base), 0);
 
     // Pot rim
     graphics_context_set_fill_color(ctx, COLOR_POT_RIM);
@@ -601,17 +635,24 @@ static void draw_growth_progress(GContext *ctx) {
 // CANVAS UPDATE
 // ============================================================================
 
-static void canvas_update_proc(Layer *layer, GContext *ctx) {
-    GRect bounds = layer_get_bounds(layer);
-
+// Static part of the scene, cached by bg_cache
+static void draw_scenery(GContext *ctx, GRect bounds) {
     // Sky background
     graphics_context_set_fill_color(ctx, COLOR_SKY);
     graphics_fill_rect(ctx, bounds, 0, GCornerNone);
 
-    int y_base = s_screen_height - 5;
+    // Pot sits behind the plant
+    draw_pot(ctx, s_screen_height - 5);
+}
 
-    // Draw pot first (background)
-    draw_pot(ctx, y_base);
+static void canvas_update_proc(Layer *layer, GContext *ctx) {
+    GRect bounds = layer_get_bounds(layer);
+    frame_governor_render_begin(s_governor);
+
+    // Draw cached sky and pot first (background)
+    bg_cache_draw(s_bg_cache, ctx, bounds);
+
+    int y_base = s_screen_height - 5;
 
     // Draw plant
     draw_plant(ctx, y_base);
@@ -623,22 +664,28 @@ static void canvas_update_proc(Layer *layer, GContext *ctx) {
     draw_battery_indicator(ctx);
     draw_water_indicator(ctx);
     draw_growth_progress(ctx);
+
+    frame_governor_render_end(s_governor);
 }
 
 // ============================================================================
 // ANIMATION UPDATE
 // ============================================================================
 
+static int get_target_wilt(void) {
+    HealthState health = get_health_state();
+    if (health == HEALTH_THIRSTY) return 6;
+    if (health == HEALTH_WILTING) return 14;
+    return 0;
+}
+
 static void update_animations(void) {
     // Update sway phase
     s_sway_phase = (s_sway_phase + 150) % TRIG_MAX_ANGLE;
     s_leaf_phase = (s_leaf_phase + 200) % TRIG_MAX_ANGLE;
 
     // Update wilt offset
-    HealthState health = get_health_state();
-    int target_wilt = 0;
-    if (health == HEALTH_THIRSTY) target_wilt = 6;
-    if (health == HEALTH_WILTING) target_wilt = 14;
+    int target_wilt = get_target_wilt();
 
     if (s_wilt_offset < target_wilt) s_wilt_offset++;
     else if (s_wilt_offset > target_wilt) s_wilt_offset--;
@@ -673,63 +720,60 @@ static void update_animations(void) {
     }
 }
 
-static void animation_timer_callback(void *data) {
-    update_animations();
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+    .interval_ms = ANIMATION_INTERVAL,
+    .idle_interval_ms = ANIMATION_INTERVAL_IDLE,
+    .max_interval_ms = MAX_INTERVAL,
+    .low_battery_percent = LOW_BATTERY_THRESHOLD,
+    .burst_ms = ANIMATION_BURST_MS,
+};
 
-    uint32_t interval = (s_battery_level <= LOW_BATTERY_THRESHOLD)
-                        ? ANIMATION_INTERVAL_LOW_POWER
-                        : ANIMATION_INTERVAL;
+// Splashes, growth and wilting need full speed; swaying alone doesn't
+static uint8_t scene_activity(void) {
+    if (s_is_watering || s_growth_anim > 0) return 100;
+    if (s_wilt_offset != get_target_wilt()) return 100;
+    return 0;
+}
 
-    s_animation_timer = app_timer_register(interval, animation_timer_callback, NULL);
+// Called by the frame governor; catch up on skipped steps at low FPS so the
+// sway keeps its speed
+static void animation_frame(void *context) {
+    for (int i = frame_governor_steps(s_governor); i > 0; i--) {
+        update_animations();
+    }
+    frame_governor_set_activity(s_governor, scene_activity());
+    scheduler_service(s_scheduler);
 }
 
 // ============================================================================
 // TIME HANDLING
 // ============================================================================
 
-static void update_time(void) {
-    time_t temp = time(NULL);
-    struct tm *tick_time = localtime(&temp);
-
-    if (!tick_time || !s_time_layer) return;
-
-    // Update time
-    static char time_buffer[8];
-    strftime(time_buffer, sizeof(time_buffer), "%I:%M", tick_time);
-
-    // Remove leading zero
-    if (time_buffer[0] == '0') {
-        memmove(time_buffer, time_buffer + 1, strlen(time_buffer));
-    }
-    text_layer_set_text(s_time_layer, time_buffer);
-
-    // Update date (e.g., "Fri Jan 17")
-    if (s_date_layer) {
-        static char date_buffer[16];
-        strftime(date_buffer, sizeof(date_buffer), "%a %b %d", tick_time);
-        text_layer_set_text(s_date_layer, date_buffer);
-    }
-}
+static const TimeTextConfig TIME_TEXT_CONFIG = {
+    .date_format = "%a %b %d",  // e.g. "Fri Jan 17"
+};
 
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-    update_time();
-
-    // Check water decay every minute
-    if (s_plant.last_watered > 0) {
-        time_t now = time(NULL);
-        int32_t elapsed = now - s_plant.last_watered;
-        int expected_level = WATER_MAX - ((elapsed / WATER_DECAY_INTERVAL) * WATER_DECAY_AMOUNT);
-        if (expected_level < 0) expected_level = 0;
-
-        if (s_plant.water_level > expected_level) {
-            s_plant.water_level = expected_level;
-            save_plant_state();
+    time_text_update(s_time_text, tick_time, units_changed);
+    scheduler_service(s_scheduler);  // Water decay, if due
+
+    // Asleep between bursts: settle the wilt and repaint the frozen frame
+    if (frame_governor_is_asleep(s_governor)) {
+        s_wilt_offset = get_target_wilt();
+        if (s_canvas_layer) {
+            layer_mark_dirty(s_canvas_layer);
         }
     }
+}
 
-    // Check if plant has died and needs rebirth
-    check_plant_death();
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_did_change(void *context) {
+    bg_cache_invalidate(s_bg_cache);
+    if (s_canvas_layer) {
+        layer_mark_dirty(s_canvas_layer);
+    }
 }
+#endif
 
 // ============================================================================
 // BUTTON HANDLING
@@ -738,6 +782,21 @@ static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
 static void accel_tap_handler(AccelAxisType axis, int32_t direction) {
     // Shake/tap to water the plant!
     water_plant();
+    frame_governor_wake(s_governor);
+    frame_governor_set_activity(s_governor, scene_activity());
+}
+
+// ============================================================================
+// FOCUS HANDLING
+// ============================================================================
+
+// Notifications and other apps cover the face: stop animating underneath,
+// then play a fresh burst when the face is visible again
+static void focus_handler(bool in_focus) {
+    if (in_focus) {
+        frame_governor_wake(s_governor);
+    }
+    frame_governor_run(s_governor, in_focus);
 }
 
 // ============================================================================
@@ -746,6 +805,7 @@ static void accel_tap_handler(AccelAxisType axis, int32_t direction) {
 
 static void battery_callback(BatteryChargeState state) {
     s_battery_level = state.charge_percent;
+    frame_governor_set_battery(s_governor, state);
 }
 
 // ============================================================================
@@ -765,6 +825,16 @@ static void main_window_load(Window *window) {
     layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
 
+    // Background cache (bitmap allocated on first draw)
+    s_bg_cache = bg_cache_create(draw_scenery);
+    s_paths = path_pool_create(NUM_PATHS);
+    path_pool_add(s_paths, POT_POINTS, ARRAY_LENGTH(POT_POINTS));
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+        .did_change = unobstructed_did_change
+    }, NULL);
+#endif
+
     // Time layer at top
     GRect time_frame = GRect(0, 2, s_screen_width, 40);
     s_time_layer = text_layer_create(time_frame);
@@ -782,6 +852,7 @@ static void main_window_load(Window *window) {
     text_layer_set_font(s_date_layer, fonts_get_system_font(FONT_KEY_GOTHIC_14));
     text_layer_set_text_alignment(s_date_layer, GTextAlignmentCenter);
     layer_add_child(window_layer, text_layer_get_layer(s_date_layer));
+    s_time_text = time_text_create(&TIME_TEXT_CONFIG, s_time_layer, s_date_layer);
 
     // Initialize drops
     for (int i = 0; i < MAX_WATER_DROPS; i++) {
@@ -789,24 +860,41 @@ static void main_window_load(Window *window) {
     }
 
     // Start animation timer
-    s_animation_timer = app_timer_register(ANIMATION_INTERVAL, animation_timer_callback, NULL);
+    s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
+    frame_governor_set_battery(s_governor, battery_state_service_peek());
+    frame_governor_set_activity(s_governor, scene_activity());
+    frame_governor_run(s_governor, true);
 
     // Initial time update
-    update_time();
+    time_text_refresh(s_time_text);
 }
 
 static void main_window_unload(Window *window) {
-    if (s_animation_timer) {
-        app_timer_cancel(s_animation_timer);
-        s_animation_timer = NULL;
+    if (s_governor) {
+        frame_governor_destroy(s_governor);
+        s_governor = NULL;
     }
 
-    save_plant_state();
+    state_store_flush(s_plant_store);
+
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+    unobstructed_area_service_unsubscribe();
+#endif
+    if (s_bg_cache) {
+        bg_cache_destroy(s_bg_cache);
+        s_bg_cache = NULL;
+    }
+    if (s_paths) {
+        path_pool_destroy(s_paths);
+        s_paths = NULL;
+    }
 
     if (s_canvas_layer) {
         layer_destroy(s_canvas_layer);
         s_canvas_layer = NULL;
     }
+    time_text_destroy(s_time_text);
+    s_time_text = NULL;
     if (s_time_layer) {
         text_layer_destroy(s_time_layer);
         s_time_layer = NULL;
@@ -826,6 +914,14 @@ static void init(void) {
 
     load_plant_state();
 
+    // Opt-in (WORKER=1 pebble build); without it the face catches up on load
+#if defined(PLANT_WORKER)
+    launch_worker();
+#endif
+
+    s_scheduler = scheduler_create();
+    scheduler_add(s_scheduler, WATER_CHECK_MS, SCHEDULER_PRIORITY_LOW, decay_water, NULL);
+
     s_main_window = window_create();
     window_set_window_handlers(s_main_window, (WindowHandlers) {
         .load = main_window_load,
@@ -836,22 +932,27 @@ static void init(void) {
     tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
     battery_state_service_subscribe(battery_callback);
     accel_tap_service_subscribe(accel_tap_handler);  // Shake to water!
+    app_focus_service_subscribe(focus_handler);
 
     BatteryChargeState state = battery_state_service_peek();
     s_battery_level = state.charge_percent;
 }
 
 static void deinit(void) {
-    save_plant_state();
+    state_store_destroy(s_plant_store);  // Writes anything still queued
+    s_plant_store = NULL;
 
     tick_timer_service_unsubscribe();
     battery_state_service_unsubscribe();
     accel_tap_service_unsubscribe();
+    app_focus_service_unsubscribe();
 
     if (s_main_window) {
         window_destroy(s_main_window);
         s_main_window = NULL;
     }
+    scheduler_destroy(s_scheduler);
+    s_scheduler = NULL;
 }
 
 int main(void) {
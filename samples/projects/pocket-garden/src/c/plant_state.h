@@ -0,0 +1,67 @@
+/**
+ * Plant State - shared by the watchface and its background worker
+ *
+ * The worker (worker_src/c/worker.c) keeps the persisted plant's water
+ * level current while the face isn't on screen, so the face's startup is
+ * a plain read rather than a replay of every decay it missed. Both sides
+ * decay with plant_state_decay(), which is idempotent: it computes the
+ * level from the time since the last watering and only ever lowers it,
+ * so it doesn't matter which side (or both) got there first.
+ *
+ * The face tells a running worker when it saves a watering or a rebirth
+ * (PLANT_MSG_WATERED) so the worker's next decay step moves with it.
+ *
+ * Include after <pebble.h> or <pebble_worker.h>.
+ */
+
+#pragma once
+
+#define STORAGE_KEY_PLANT 1
+#define PLANT_STATE_VERSION 1       // lib/state_store.h layout stamp
+
+#define WATER_MAX 100
+#define WATER_DECAY_INTERVAL 1800   // 30 minutes in seconds
+#define WATER_DECAY_AMOUNT 12
+
+// AppWorkerMessage types, face -> worker
+enum {
+    PLANT_MSG_WATERED = 1,      // last_watered moved; no payload
+};
+
+typedef enum {
+    STAGE_SEED = 0,
+    STAGE_SPROUT = 1,
+    STAGE_SMALL = 2,
+    STAGE_FULL = 3,
+    STAGE_FLOWERING = 4
+} GrowthStage;
+
+// Persisted under STORAGE_KEY_PLANT behind a state_store header; bump
+// PLANT_STATE_VERSION when the layout changes
+typedef struct {
+    GrowthStage stage;
+    uint8_t water_level;
+    uint8_t growth_progress;
+    time_t last_watered;
+    uint16_t total_waters;
+} PlantState;
+
+// Lowers the water level to what `now` allows. Returns true if it changed.
+static inline bool plant_state_decay(PlantState *plant, time_t now) {
+    if (plant->last_watered <= 0) return false;
+    int32_t elapsed = now - plant->last_watered;
+    int expected_level = WATER_MAX - ((elapsed / WATER_DECAY_INTERVAL) * WATER_DECAY_AMOUNT);
+    if (expected_level < 0) expected_level = 0;
+
+    if (plant->water_level <= expected_level) return false;
+    plant->water_level = expected_level;
+    return true;
+}
+
+// When plant_state_decay() next has something to do; 0 once dried out
+static inline time_t plant_state_next_decay(const PlantState *plant, time_t now) {
+    if (plant->last_watered <= 0 || plant->water_level == 0) return 0;
+    int32_t elapsed = now - plant->last_watered;
+    if (elapsed < 0) elapsed = 0;
+    return plant->last_watered + (elapsed / WATER_DECAY_INTERVAL + 1) * WATER_DECAY_INTERVAL;
+}
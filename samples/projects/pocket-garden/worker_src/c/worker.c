@@ -0,0 +1,88 @@
+/**
+ * Pocket Garden - Background Worker
+ *
+ * Keeps the persisted plant's water level current while the watchface
+ * isn't running, so the face opens on a plain read. Death and rebirth
+ * stay with the face (it vibrates); the worker only lets the plant dry.
+ *
+ * Between decay steps the worker holds just the next due time: the
+ * minute tick is a single compare, and persist is read and written at
+ * most once per 30 minutes. The plant is re-read right before each step
+ * because the face may have watered it since.
+ */
+
+#include <pebble_worker.h>
+#include "../../src/c/plant_state.h"
+
+static time_t s_next_decay;     // 0 = nothing to do (no plant, or dried out)
+
+// The face's lib/state_store.h layout: version and size, then the struct.
+// The lib builds against pebble.h, so the worker mirrors it here.
+typedef struct {
+    uint16_t version;
+    uint16_t size;
+} StoreHeader;
+
+#define PLANT_BLOB_SIZE (sizeof(StoreHeader) + sizeof(PlantState))
+
+static bool read_plant(PlantState *plant) {
+    uint8_t blob[PLANT_BLOB_SIZE];
+    if (persist_read_data(STORAGE_KEY_PLANT, blob, sizeof(blob)) != (int)sizeof(blob)) return false;
+
+    StoreHeader header;
+    memcpy(&header, blob, sizeof(header));
+    if (header.version != PLANT_STATE_VERSION || header.size != sizeof(PlantState)) return false;
+    memcpy(plant, blob + sizeof(header), sizeof(*plant));
+    return true;
+}
+
+static void write_plant(const PlantState *plant) {
+    uint8_t blob[PLANT_BLOB_SIZE];
+    StoreHeader header = { .version = PLANT_STATE_VERSION, .size = sizeof(PlantState) };
+    memcpy(blob, &header, sizeof(header));
+    memcpy(blob + sizeof(header), plant, sizeof(*plant));
+    persist_write_data(STORAGE_KEY_PLANT, blob, sizeof(blob));
+}
+
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+    time_t now = time(NULL);
+    if (s_next_decay == 0 || now < s_next_decay) return;
+
+    PlantState plant;
+    if (!read_plant(&plant)) {
+        s_next_decay = 0;
+        return;
+    }
+    if (plant_state_decay(&plant, now)) {
+        write_plant(&plant);
+    }
+    s_next_decay = plant_state_next_decay(&plant, now);
+}
+
+// The face watered (or replanted): its next decay step may have moved
+static void app_message_handler(uint16_t type, AppWorkerMessage *data) {
+    if (type != PLANT_MSG_WATERED) return;
+    PlantState plant;
+    s_next_decay = read_plant(&plant) ? plant_state_next_decay(&plant, time(NULL)) : 0;
+}
+
+static void init(void) {
+    PlantState plant;
+    if (read_plant(&plant)) {
+        s_next_decay = plant_state_next_decay(&plant, time(NULL));
+    }
+    app_worker_message_subscribe(app_message_handler);
+    tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
+}
+
+static void deinit(void) {
+    tick_timer_service_unsubscribe();
+    app_worker_message_unsubscribe();
+}
+
+int main(void) {
+    init();
+    worker_event_loop();
+    deinit();
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * Frame Governor
+ *
+ * Owns the animation timer and picks each frame's interval instead of a
+ * fixed ANIMATION_INTERVAL / ANIMATION_INTERVAL_LOW_POWER pair:
+ *
+ *   - Scene activity: 100 runs at `interval_ms`, 0 at `idle_interval_ms`
+ *     (a monkey munching an apple doesn't need 10 FPS, a falling one does)
+ *   - Battery: at or below `low_battery_percent` and not charging, or in
+ *     user low-power mode, intervals double
+ *   - Measured cost: update + render time is averaged and the interval is
+ *     kept at least twice that, so the CPU sleeps at least half the time
+ *   - Missed deadlines: frames that start late (the watch couldn't keep up)
+ *     add a backoff that decays again once frames are on time
+ *
+ * Level of detail: frame_governor_lod() is FULL until the frames stop
+ * fitting (average cost over half `interval_ms`, or deadlines missed), then
+ * drops a tier at a time; it comes back a tier after a run of cheap, on-time
+ * frames. Low battery or low-power mode hold it at REDUCED or below. Draw
+ * code reads it each frame, so a slow aplite unit or a busy scene loses
+ * detail instead of frame rate.
+ *
+ * Burst then sleep: with `burst_ms` set, animation stops `burst_ms` after
+ * the last frame_governor_wake() and the last frame stays on screen. Wake
+ * it from a wrist flick (accel_tap_service) and on regaining focus; tick
+ * handlers keep the time current meanwhile.
+ *
+ * Usage:
+ *     static const FrameGovernorConfig GOV_CONFIG = {
+ *         .interval_ms = 50, .idle_interval_ms = 500,
+ *         .max_interval_ms = 1000, .low_battery_percent = 20,
+ *     };
+ *     s_gov = frame_governor_create(&GOV_CONFIG, animation_frame, NULL);  // window load
+ *     frame_governor_run(s_gov, should_animate());   // whenever conditions change
+ *     frame_governor_set_battery(s_gov, state);      // battery handler
+ *     frame_governor_wake(s_gov);                    // tap handler, focus regained
+ *
+ *     static void animation_frame(void *context) {   // called by the governor
+ *         for (int i = frame_governor_steps(s_gov); i > 0; i--) update_scene();
+ *         frame_governor_set_activity(s_gov, scene_activity());
+ *         layer_mark_dirty(s_canvas_layer);
+ *     }
+ *
+ *     // in the update proc, to include render time in the cost
+ *     frame_governor_render_begin(s_gov);
+ *     ...
+ *     frame_governor_render_end(s_gov);
+ *
+ *     // in draw code, optional detail
+ *     if (frame_governor_lod(s_gov) == FRAME_GOVERNOR_LOD_FULL) draw_eyes(ctx);
+ *
+ * The governor re-arms the timer itself after each frame; don't call
+ * app_timer_register() from the frame proc.
+ *
+ * Capture mode (CAPTURE=1 pebble build, defines CAPTURE_MODE): no timer.
+ * The governor subscribes to accel taps and runs exactly one frame, with
+ * steps() == 1, per tap, so `pebble emu-tap` steps the animation and
+ * create_preview_gif.py --step records frames 0..N of the loop exactly.
+ * frame_governor_wake() also steps, so a face's own tap handler (which
+ * replaces the governor's subscription) keeps stepping if it calls wake.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define FRAME_GOVERNOR_MAX_STEPS 8   // Catch-up steps after a long frame
+
+typedef struct {
+    uint16_t interval_ms;           // At full activity, battery fine
+    uint16_t idle_interval_ms;      // At activity 0
+    uint16_t max_interval_ms;       // Cap after battery/cost/backoff scaling
+    uint8_t low_battery_percent;    // At or below (not charging): intervals x2
+    uint32_t burst_ms;              // Sleep this long after the last wake (0 = never)
+} FrameGovernorConfig;
+
+typedef enum {
+    FRAME_GOVERNOR_LOD_FULL,        // Everything
+    FRAME_GOVERNOR_LOD_REDUCED,     // Drop fine detail (faces, glow passes, most sparks)
+    FRAME_GOVERNOR_LOD_MINIMAL,     // Silhouettes only
+} FrameGovernorLod;
+
+typedef void (*FrameGovernorFrameProc)(void *context);
+
+typedef struct FrameGovernor FrameGovernor;
+
+// `config` is copied. The timer is not started until frame_governor_run().
+FrameGovernor *frame_governor_create(const FrameGovernorConfig *config,
+                                     FrameGovernorFrameProc frame_proc, void *context);
+void frame_governor_destroy(FrameGovernor *gov);
+
+// Starts (if not already running) or cancels the animation timer. While
+// asleep, run(true) only records that animation is allowed.
+void frame_governor_run(FrameGovernor *gov, bool run);
+bool frame_governor_is_running(const FrameGovernor *gov);
+
+// Starts a new `burst_ms` animation window (no-op without burst_ms)
+void frame_governor_wake(FrameGovernor *gov);
+
+// Runs one frame now, with steps() == 1, whether or not the timer is
+// running. Capture mode calls this on each tap.
+void frame_governor_step(FrameGovernor *gov);
+bool frame_governor_is_asleep(const FrameGovernor *gov);
+
+// 0 = idle scene, 100 = fast action. Ramping up reschedules a pending
+// slow frame so the action isn't late.
+void frame_governor_set_activity(FrameGovernor *gov, uint8_t activity);
+void frame_governor_set_battery(FrameGovernor *gov, BatteryChargeState state);
+void frame_governor_set_low_power(FrameGovernor *gov, bool low_power);
+
+// Bracket the drawing code (may be called several times per frame)
+void frame_governor_render_begin(FrameGovernor *gov);
+void frame_governor_render_end(FrameGovernor *gov);
+
+// Nominal `interval_ms` steps since the previous frame (1 when on pace).
+// Run the simulation this many times to keep wall-clock speed at low FPS.
+uint8_t frame_governor_steps(const FrameGovernor *gov);
+
+// Detail tier for this frame (always FULL in capture mode, so captures
+// don't depend on the machine)
+FrameGovernorLod frame_governor_lod(const FrameGovernor *gov);
+
+// Interval chosen for the next frame, and the averaged update+render cost
+uint16_t frame_governor_interval(const FrameGovernor *gov);
+uint16_t frame_governor_cost(const FrameGovernor *gov);
@@ -0,0 +1,84 @@
+/**
+ * State Store
+ *
+ * Coalesced persistence for an app's settings and state: one struct, one
+ * key, written at most once per interval and always on exit.
+ *
+ * A flash write is slow, costs power and stalls the event loop; writing on
+ * every button press or every game tick also wears the flash for nothing
+ * when the next change is seconds away. Here:
+ *
+ *   - The app owns a plain struct; several settings pack into one key
+ *   - state_store_mark_dirty() after a change arms one timer for the
+ *     interval; changes before it fires share the write
+ *   - A write is skipped when the bytes match what is already on flash
+ *     (a setting toggled twice costs nothing)
+ *   - The blob leads with a version stamp and size; a blob from another
+ *     layout is ignored on load, so the app falls back to its defaults
+ *     (or migrates it) rather than reading garbage
+ *
+ * Usage:
+ *     typedef struct { bool low_power; bool vibes; } Settings;
+ *     static Settings s_settings = { .vibes = true };              // Defaults
+ *
+ *     static const StateStoreConfig STORE_CONFIG = {
+ *         .key = PERSIST_KEY_SETTINGS,
+ *         .version = 1,                // Bump when Settings changes layout
+ *         .interval_ms = 5 * 60 * 1000,
+ *     };
+ *
+ *     s_store = state_store_create(&STORE_CONFIG, &s_settings, sizeof(s_settings));  // init
+ *     state_store_load(s_store);       // false: nothing valid stored, defaults stand
+ *
+ *     s_settings.vibes = !s_settings.vibes;                         // click handler
+ *     state_store_mark_dirty(s_store);
+ *
+ *     state_store_destroy(s_store);    // deinit: writes anything pending
+ *
+ * On flash the key holds a StateStoreHeader followed by the struct's
+ * bytes. A background worker sharing the key can't include this header
+ * (it builds against pebble_worker.h); mirror the layout there.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+// Leads the blob on flash
+typedef struct {
+    uint16_t version;
+    uint16_t size;              // Of the data that follows
+} StateStoreHeader;
+
+#define STATE_STORE_MAX_SIZE (PERSIST_DATA_MAX_LENGTH - sizeof(StateStoreHeader))
+
+// Called after each write that reached flash
+typedef void (*StateStoreWriteHandler)(const void *data);
+
+typedef struct {
+    uint32_t key;               // persist key for the whole struct
+    uint16_t version;           // Layout stamp; other versions are ignored on load
+    uint32_t interval_ms;       // Longest a change waits to be written
+    StateStoreWriteHandler did_write;   // Optional
+} StateStoreConfig;
+
+typedef struct StateStore StateStore;
+
+// `data` is the app's struct, `size` at most STATE_STORE_MAX_SIZE bytes;
+// it must outlive the store. `config` is copied.
+StateStore *state_store_create(const StateStoreConfig *config, void *data, uint16_t size);
+
+// Writes anything pending, then frees the store
+void state_store_destroy(StateStore *store);
+
+// Fills `data` from flash. False if nothing valid was stored; `data` is
+// left untouched then.
+bool state_store_load(StateStore *store);
+
+// `data` changed: write it within the interval
+void state_store_mark_dirty(StateStore *store);
+
+// Write now if anything is pending. True if flash was written.
+bool state_store_flush(StateStore *store);
+
+bool state_store_is_dirty(const StateStore *store);
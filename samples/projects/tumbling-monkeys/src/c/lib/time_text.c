@@ -0,0 +1,113 @@
+/**
+ * Time Text - see time_text.h
+ */
+
+#include <pebble.h>
+#include "time_text.h"
+
+struct TimeText {
+    TimeTextConfig config;
+    TextLayer *time_layer;
+    TextLayer *date_layer;
+
+    char time[8];
+    char date[TIME_TEXT_DATE_MAX];
+
+    // What the strings were formatted from (-1 = not yet)
+    int8_t hour, minute;
+    bool is_24h;
+    int16_t yday, year;
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+// "9:05", "09:05" or "21:05" into `out` (at least 6 bytes)
+static void prv_format_time(const TimeText *text, const struct tm *t, char *out) {
+    int hour = t->tm_hour;
+    bool pad = text->is_24h || text->config.pad_hour;
+    if (!text->is_24h) {
+        hour %= 12;
+        if (hour == 0) hour = 12;
+    }
+    if (pad || hour >= 10) *out++ = '0' + hour / 10;
+    *out++ = '0' + hour % 10;
+    *out++ = ':';
+    *out++ = '0' + t->tm_min / 10;
+    *out++ = '0' + t->tm_min % 10;
+    *out = '\0';
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+TimeText *time_text_create(const TimeTextConfig *config, TextLayer *time_layer, TextLayer *date_layer) {
+    TimeText *text = calloc(1, sizeof(TimeText));
+    if (!text) return NULL;
+
+    text->config = *config;
+    text->time_layer = time_layer;
+    text->date_layer = date_layer;
+    text->hour = text->minute = -1;
+    text->yday = text->year = -1;
+    return text;
+}
+
+void time_text_destroy(TimeText *text) {
+    free(text);
+}
+
+uint8_t time_text_update(TimeText *text, const struct tm *tick_time, TimeUnits units_changed) {
+    if (!text || !tick_time) return 0;
+    uint8_t changed = 0;
+
+    bool is_24h = clock_is_24h_style();
+    if (tick_time->tm_min != text->minute || tick_time->tm_hour != text->hour || is_24h != text->is_24h) {
+        text->hour = tick_time->tm_hour;
+        text->minute = tick_time->tm_min;
+        text->is_24h = is_24h;
+
+        char time[sizeof(text->time)];
+        prv_format_time(text, tick_time, time);
+        if (strcmp(time, text->time) != 0) {
+            strcpy(text->time, time);
+            if (text->time_layer) text_layer_set_text(text->time_layer, text->time);
+            changed |= TIME_TEXT_TIME;
+        }
+    }
+
+    bool new_day = (units_changed & DAY_UNIT) || tick_time->tm_yday != text->yday ||
+                   tick_time->tm_year != text->year;
+    if (text->config.date_format && new_day) {
+        text->yday = tick_time->tm_yday;
+        text->year = tick_time->tm_year;
+
+        char date[sizeof(text->date)];
+        strftime(date, sizeof(date), text->config.date_format, tick_time);
+        if (strcmp(date, text->date) != 0) {
+            strcpy(text->date, date);
+            if (text->date_layer) text_layer_set_text(text->date_layer, text->date);
+            changed |= TIME_TEXT_DATE;
+        }
+    }
+    return changed;
+}
+
+uint8_t time_text_refresh(TimeText *text) {
+    if (!text) return 0;
+    time_t now = time(NULL);
+    struct tm *tick_time = localtime(&now);
+    if (!tick_time) return 0;
+    text->hour = text->minute = -1;
+    return time_text_update(text, tick_time, DAY_UNIT);
+}
+
+const char *time_text_time(const TimeText *text) {
+    return text ? text->time : "";
+}
+
+const char *time_text_date(const TimeText *text) {
+    return text ? text->date : "";
+}
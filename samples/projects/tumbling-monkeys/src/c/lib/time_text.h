@@ -0,0 +1,68 @@
+/**
+ * Time Text
+ *
+ * Time and date strings for text layers, touched only when they change.
+ *
+ * The usual tick handler re-runs strftime() for both strings and calls
+ * text_layer_set_text() on both layers every minute. Setting the text
+ * throws away the layer's cached text layout and marks it dirty, so the
+ * date is laid out and redrawn 1440 times a day to show 1 change. Here:
+ *
+ *   - The time is formatted by hand ("9:05" / "09:05" / "21:05"): no
+ *     strftime, no memmove to strip the leading zero
+ *   - The date runs strftime() only when the day changes
+ *   - A layer's text is set only when its string differs, so an unchanged
+ *     layer keeps its layout and isn't redrawn
+ *
+ * Subscribe to MINUTE_UNIT only; the day change arrives as a minute tick
+ * with DAY_UNIT set in `units_changed`.
+ *
+ * Usage:
+ *     static const TimeTextConfig TIME_TEXT_CONFIG = { .date_format = "%a %b %d" };
+ *     s_time_text = time_text_create(&TIME_TEXT_CONFIG, s_time_layer, s_date_layer);  // window load
+ *     time_text_refresh(s_time_text);                  // window load, after the layers exist
+ *
+ *     static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+ *         uint8_t changed = time_text_update(s_time_text, tick_time, units_changed);
+ *         if (changed & TIME_TEXT_DATE) ...            // e.g. repaint under the date only
+ *     }
+ *
+ *     time_text_destroy(s_time_text);                   // window unload
+ *
+ * Either layer may be NULL for faces that draw the strings themselves with
+ * graphics_draw_text(); time_text_time() and time_text_date() return them.
+ */
+
+#pragma once
+
+#include <pebble.h>
+
+#define TIME_TEXT_DATE_MAX 24   // Bytes of formatted date, including the NUL
+
+// time_text_update() result bits
+enum {
+    TIME_TEXT_TIME = 1 << 0,
+    TIME_TEXT_DATE = 1 << 1,
+};
+
+typedef struct {
+    const char *date_format;    // strftime() format, NULL for no date
+    bool pad_hour;              // "09:05" rather than "9:05" in 12h mode (24h always pads)
+} TimeTextConfig;
+
+typedef struct TimeText TimeText;
+
+// `config` is copied; `date_format` must outlive the TimeText (a literal)
+TimeText *time_text_create(const TimeTextConfig *config, TextLayer *time_layer, TextLayer *date_layer);
+void time_text_destroy(TimeText *text);
+
+// Re-formats what `units_changed` and `tick_time` say is stale and sets the
+// layers whose string changed. Returns the TIME_TEXT_* bits that changed.
+uint8_t time_text_update(TimeText *text, const struct tm *tick_time, TimeUnits units_changed);
+
+// Re-formats both strings from the current time (window load, settings
+// changed). Returns the TIME_TEXT_* bits that changed.
+uint8_t time_text_refresh(TimeText *text);
+
+const char *time_text_time(const TimeText *text);
+const char *time_text_date(const TimeText *text);
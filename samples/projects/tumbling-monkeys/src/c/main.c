@@ -1,12 +1,24 @@
 #include <pebble.h>
+#include "lib/bg_cache.h"
+#include "lib/dirty_tracker.h"
+#include "lib/draw_batch.h"
+#include "lib/fixed_tables.h"
+#include "lib/frame_governor.h"
+#include "lib/motion.h"
+#include "lib/round_mask.h"
+#include "lib/state_store.h"
+#include "lib/time_text.h"
 
 // ============================================================================
 // CONFIGURATION
 // ============================================================================
 
-#define ANIMATION_INTERVAL 100
-#define ANIMATION_INTERVAL_LOW_POWER 200
+// Frame governor intervals (doubled on low battery / low power mode)
+#define ANIMATION_INTERVAL PBL_IF_COLOR_ELSE(100, 200)  // ~10 FPS, ~5 FPS on B/W
+#define ANIMATION_INTERVAL_IDLE 500                     // Everyone munching: 2 FPS
+#define ANIMATION_INTERVAL_MAX 1000
 #define LOW_BATTERY_THRESHOLD 20
+#define ANIMATION_BURST_MS 20000                        // Animate after a flick, then freeze
 
 #define NUM_MONKEYS 2
 #define NUM_VINES 4
@@ -20,6 +32,7 @@
   #define GROUND_Y 150
   #define TIME_Y 8
   #define DATE_Y 44
+  #define BATTERY_Y 47
   #define SWING_ZONE_TOP 75
   #define SWING_ZONE_BOTTOM 140
 #else
@@ -29,6 +42,7 @@
   #define GROUND_Y 150
   #define TIME_Y 2
   #define DATE_Y 38
+  #define BATTERY_Y 4
   #define SWING_ZONE_TOP 70
   #define SWING_ZONE_BOTTOM 140
 #endif
@@ -147,7 +161,10 @@ static Window *s_main_window;
 static Layer *s_canvas_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
-static AppTimer *s_animation_timer;
+static FrameGovernor *s_governor;      // owns the animation timer
+static BgCache *s_bg_cache;            // sky, canopy, branches + ground overlay
+static DirtyTracker *s_dirty;          // repaints only around vines + monkeys
+static DrawBatch *s_monkey_batch;      // monkey parts grouped by color
 static bool s_running = false;         // app active + window loaded
 static bool s_window_loaded = false;   // window lifecycle guard
 static bool s_fully_initialized = false; // set only after everything is ready
@@ -155,17 +172,22 @@ static bool s_in_focus = true;         // track focus state separately
 static void focus_handler(bool in_focus);
 static bool s_bt_connected = true;     // phone connection (pause when false)
 static bool s_is_charging = false;     // charging state (pause when true)
-static bool s_low_power_mode = false;  // user FPS cap toggle
-static bool s_vibes_enabled = true;    // user-toggle vibrations
+
+// User toggles, persisted together under one key
+typedef struct {
+  bool low_power;                      // user FPS cap toggle
+  bool vibes;                          // user-toggle vibrations
+} Settings;
+static Settings s_settings = { .low_power = false, .vibes = true };
+static StateStore *s_settings_store;   // writes toggles at most every 5 min
 
 enum {
-  PERSIST_KEY_LOW_POWER = 1,
+  PERSIST_KEY_LOW_POWER = 1,           // before settings were packed: migrated
   PERSIST_KEY_VIBES = 2,
+  PERSIST_KEY_SETTINGS = 3,
 };
 
 static inline bool should_animate(void);
-static uint32_t get_animation_interval(void);
-static void ensure_timer_running(void);
 static void bt_handler(bool connected);
 static void click_config_provider(void *context);
 static void up_click_handler(ClickRecognizerRef recognizer, void *context);
@@ -176,14 +198,9 @@ static Vine s_vines[NUM_VINES];
 static Branch s_branches[NUM_BRANCHES];
 
 static int s_battery_level = 100;
-static char s_time_buffer[8];
-static char s_date_buffer[16];
-static uint32_t s_last_shake_time = 0;  // cooldown for shake detection
-
-// Shake detection threshold (magnitude squared to avoid sqrt)
-// Gravity is ~1000 per axis, so normal is ~1000000. Vigorous shake > 3000000
-#define SHAKE_THRESHOLD_SQ 4000000
-#define SHAKE_COOLDOWN_MS 1500
+static GPoint s_battery_pos;  // Top right; beside the date, inside the circle on round
+static TimeText *s_time_text = NULL;  // Sets only the text that changed
+static Motion *s_motion = NULL;
 
 // ============================================================================
 // SAFE MATH HELPERS (CRITICAL FOR PEBBLE STABILITY)
@@ -212,18 +229,6 @@ static int clampi(int v, int lo, int hi) {
   return v;
 }
 
-static int ease_in_out(int progress) {
-  progress = clampi(progress, 0, 100);
-  int32_t angle = (progress * TRIG_MAX_ANGLE / 2) / 100;
-  int result = 50 - (cos_safe(angle) * 50) / TRIG_MAX_RATIO;
-  return result;
-}
-
-static int ease_out(int progress) {
-  progress = clampi(progress, 0, 100);
-  return 100 - ((100 - progress) * (100 - progress)) / 100;
-}
-
 // ============================================================================
 // ANIMATION CONTROL HELPERS (EFFICIENCY)
 // ============================================================================
@@ -233,34 +238,29 @@ static inline bool should_animate(void) {
          s_canvas_layer && s_bt_connected && !s_is_charging;
 }
 
-static uint32_t get_animation_interval(void) {
-  uint32_t interval = ANIMATION_INTERVAL;        // ~10 FPS
-#ifndef PBL_COLOR
-  interval = ANIMATION_INTERVAL_LOW_POWER;       // ~5 FPS on B/W
-#endif
-  if (s_low_power_mode || s_battery_level <= LOW_BATTERY_THRESHOLD) {
-    interval = ANIMATION_INTERVAL_LOW_POWER;
-  }
-  return interval;
-}
+static const FrameGovernorConfig GOVERNOR_CONFIG = {
+  .interval_ms = ANIMATION_INTERVAL,
+  .idle_interval_ms = ANIMATION_INTERVAL_IDLE,
+  .max_interval_ms = ANIMATION_INTERVAL_MAX,
+  .low_battery_percent = LOW_BATTERY_THRESHOLD,
+  .burst_ms = ANIMATION_BURST_MS,
+};
 
-// Forward declaration
-static void animation_timer_callback(void *data);
+// Gravity alone reads ~1000; a vigorous shake peaks past 2g for ~100ms
+static const MotionConfig MOTION_CONFIG = {
+  .threshold_mg = 2000,
+  .min_peak_ms = 100,
+  .max_latency_ms = 500,
+  .cooldown_ms = 1500,
+  .idle_ms = ANIMATION_BURST_MS,
+};
 
-static void ensure_timer_running(void) {
-  if (should_animate()) {
-    if (!s_animation_timer) {
-      uint32_t interval = get_animation_interval();
-      if (interval < 50) interval = 50;  // Minimum 50ms to prevent overload
-      s_animation_timer = app_timer_register(interval, animation_timer_callback, NULL);
-    }
-  } else {
-    if (s_animation_timer) {
-      app_timer_cancel(s_animation_timer);
-      s_animation_timer = NULL;
-    }
-  }
-}
+// A burst of button toggles shares one flash write; deinit flushes the rest
+static const StateStoreConfig SETTINGS_STORE_CONFIG = {
+  .key = PERSIST_KEY_SETTINGS,
+  .version = 1,
+  .interval_ms = 5 * 60 * 1000,
+};
 
 // ============================================================================
 // INITIALIZATION
@@ -417,7 +417,7 @@ static void update_climb_vine(Monkey *m) {
   m->pos.x = vine->top.x;
   m->pos.y = base_y + offset;
 
-  int bob = (sin_safe(progress * TRIG_MAX_ANGLE / 10) * 3) / TRIG_MAX_RATIO;
+  int bob = fixed_sin_mul(progress * TRIG_MAX_ANGLE / 10, 3);
   m->pos.y += bob;
 
   m->limb_phase = progress * TRIG_MAX_ANGLE / 12;
@@ -434,7 +434,7 @@ static void update_hang_look(Monkey *m) {
 
   Vine *vine = &s_vines[m->anim.vine_index];
 
-  int32_t sway = (sin_safe(progress * TRIG_MAX_ANGLE / 60) * 8) / TRIG_MAX_RATIO;
+  int32_t sway = fixed_sin_mul(progress * TRIG_MAX_ANGLE / 60, 8);
 
   m->pos.x = vine->top.x + sway;
   m->pos.y = vine->top.y + vine->length - 10;
@@ -462,7 +462,7 @@ static void update_tail_hang(Monkey *m) {
   int mid_x = (branch->start.x + branch->end.x) / 2;
   int mid_y = (branch->start.y + branch->end.y) / 2;
 
-  int32_t swing = (sin_safe(progress * TRIG_MAX_ANGLE / 40) * 15) / TRIG_MAX_RATIO;
+  int32_t swing = fixed_sin_mul(progress * TRIG_MAX_ANGLE / 40, 15);
 
   m->pos.x = mid_x + swing;
   m->pos.y = mid_y + 22;
@@ -505,7 +505,7 @@ static void update_fight(Monkey *m) {
   int center_y = SWING_ZONE_TOP + 30;
 
   if (progress < 30) {
-    int eased = ease_in_out(progress * 100 / 30);
+    int eased = fixed_ease_in_out(progress * 100 / 30);
     m->pos.x = m->anim.start_pos.x + (center_x - m->anim.start_pos.x) * eased / 100;
     m->pos.y = m->anim.start_pos.y + (center_y - m->anim.start_pos.y) * eased / 100;
     m->direction = (center_x > m->anim.start_pos.x) ? 1 : -1;
@@ -514,8 +514,8 @@ static void update_fight(Monkey *m) {
     int tussle_p = (progress - 30) * 100 / 50;
     tussle_p = clampi(tussle_p, 0, 100);
 
-    int shake_x = (sin_safe(tussle_p * TRIG_MAX_ANGLE / 8) * 8) / TRIG_MAX_RATIO;
-    int shake_y = (cos_safe(tussle_p * TRIG_MAX_ANGLE / 6) * 5) / TRIG_MAX_RATIO;
+    int shake_x = fixed_sin_mul(tussle_p * TRIG_MAX_ANGLE / 8, 8);
+    int shake_y = fixed_cos_mul(tussle_p * TRIG_MAX_ANGLE / 6, 5);
 
     // Use fixed center point to avoid feedback loop
     m->pos.x = center_x + shake_x;
@@ -527,12 +527,12 @@ static void update_fight(Monkey *m) {
   } else {
     int retreat_p = (progress - 80) * 100 / 20;
     retreat_p = clampi(retreat_p, 0, 100);
-    int eased = ease_out(retreat_p);
+    int eased = fixed_ease_out(retreat_p);
 
     int retreat_dir = (m->anim.start_pos.x < center_x) ? -1 : 1;
 
     m->pos.x = center_x + retreat_dir * eased * 25 / 100;
-    m->pos.y = SWING_ZONE_TOP + 40 - (sin_safe(eased * TRIG_MAX_ANGLE / 200) * 15) / TRIG_MAX_RATIO;
+    m->pos.y = SWING_ZONE_TOP + 40 - fixed_sin_mul(eased * TRIG_MAX_ANGLE / 200, 15);
 
     m->direction = -retreat_dir;
     m->anim.rotation = 0;
@@ -550,7 +550,7 @@ static void update_falling(Monkey *m) {
     fall_p = clampi(fall_p, 0, 100);
     int eased = (fall_p * fall_p) / 100;
 
-    int wobble = (sin_safe(fall_p * TRIG_MAX_ANGLE / 8) * 20) / TRIG_MAX_RATIO;
+    int wobble = fixed_sin_mul(fall_p * TRIG_MAX_ANGLE / 8, 20);
     m->pos.x = m->anim.start_pos.x + wobble;
 
     m->pos.y = m->anim.start_pos.y + (GROUND_Y - 18 - m->anim.start_pos.y) * eased / 100;
@@ -729,7 +729,7 @@ static void update_vines(void) {
 #ifndef PBL_COLOR
   delta = 30;
 #endif
-  if (s_low_power_mode || s_battery_level <= LOW_BATTERY_THRESHOLD) {
+  if (s_settings.low_power || s_battery_level <= LOW_BATTERY_THRESHOLD) {
     delta = 20;
   }
   for (int i = 0; i < NUM_VINES; i++) {
@@ -750,7 +750,7 @@ static void draw_canopy(GContext *ctx) {
 #ifndef PBL_COLOR
   step1 = 36; step2 = 48;
 #endif
-  if (s_low_power_mode || s_battery_level <= LOW_BATTERY_THRESHOLD) { step1 += 12; step2 += 12; }
+  if (s_settings.low_power || s_battery_level <= LOW_BATTERY_THRESHOLD) { step1 += 12; step2 += 12; }
 
   for (int x = 0; x < SCREEN_WIDTH; x += step1) {
     graphics_fill_circle(ctx, GPoint(x, CANOPY_TOP + 5), 18);
@@ -790,14 +790,14 @@ static void draw_vines(GContext *ctx) {
 #ifndef PBL_COLOR
     segments = 3;
 #endif
-    if (s_low_power_mode || s_battery_level <= LOW_BATTERY_THRESHOLD) {
+    if (s_settings.low_power || s_battery_level <= LOW_BATTERY_THRESHOLD) {
       segments = 3;
     }
     int seg_len = vine->length / segments;
 
     for (int j = 0; j < segments; j++) {
       int32_t angle = (vine->sway_phase + j * 1000) & ANGLE_MASK;
-      int16_t sway = (sin_safe(angle) * vine->sway_amount) / TRIG_MAX_RATIO;
+      int16_t sway = fixed_sin_mul(angle, vine->sway_amount);
 
       next.x = current.x + sway;
       next.y = current.y + seg_len;
@@ -825,7 +825,7 @@ static void draw_ground(GContext *ctx) {
 #ifndef PBL_COLOR
   tufts = 10;
 #endif
-  if (s_low_power_mode || s_battery_level <= LOW_BATTERY_THRESHOLD) tufts -= 4;
+  if (s_settings.low_power || s_battery_level <= LOW_BATTERY_THRESHOLD) tufts -= 4;
   if (tufts < 6) tufts = 6;
   for (int i = 0; i < tufts; i++) {
     int x = 5 + (i * SCREEN_WIDTH / tufts);
@@ -836,29 +836,89 @@ static void draw_ground(GContext *ctx) {
   }
 }
 
-static void draw_monkey_tail(GContext *ctx, Monkey *m, int16_t base_x, int16_t base_y) {
-  graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-  graphics_context_set_stroke_width(ctx, 2);
+// Static scenery behind the monkeys (cached, see bg_cache)
+static void draw_scenery(GContext *ctx, GRect bounds) {
+  graphics_context_set_fill_color(ctx, COLOR_SKY);
+  graphics_fill_rect(ctx, GRect(0, 0, SCREEN_WIDTH, CANOPY_TOP + 20), 0, GCornerNone);
+
+  graphics_context_set_fill_color(ctx, COLOR_SKY_LOW);
+  graphics_fill_rect(ctx, GRect(0, CANOPY_TOP + 20, SCREEN_WIDTH, GROUND_Y - CANOPY_TOP - 20), 0, GCornerNone);
+
+  draw_canopy(ctx);
+  draw_branches(ctx);
+  draw_ground(ctx);
+}
 
+// Static scenery in front of the monkeys: falling monkeys land behind the grass
+static void draw_scenery_front(GContext *ctx, GRect bounds) {
+  draw_ground(ctx);
+}
+
+// Draw layers for the monkey batch, in the order the parts used to be painted.
+// Both monkeys share one batch, so each layer costs one color change for the
+// pair instead of one per part.
+enum {
+  LAYER_GRIP_VINE,      // Vine above a hanging monkey
+  LAYER_FUR,            // Tail, body, limbs
+  LAYER_BELLY,
+  LAYER_APPLE,          // Apple, dizzy stars
+  LAYER_APPLE_BITE,
+  LAYER_APPLE_STEM,
+  LAYER_HEAD,
+  LAYER_FACE,
+  LAYER_EARS,
+  LAYER_FEATURES,       // Inner ears, eyes, mouth
+  LAYER_TAIL_OVER,      // Upside-down tail hangs over the face
+};
+
+// Worst case is a sitting monkey: tail, body, arms, apple and head
+#define MONKEY_BATCH_SIZE (NUM_MONKEYS * 32)
+
+static void draw_monkey_tail(DrawBatch *batch, Monkey *m, int16_t base_x, int16_t base_y,
+                             FrameGovernorLod lod) {
   GPoint current = {base_x - m->direction * 3, base_y + 5};
   GPoint next;
 
+  // Reduced detail: one straight segment, no curl or tip
+  if (lod != FRAME_GOVERNOR_LOD_FULL) {
+    next = GPoint(current.x - m->direction * 9, current.y + 9);
+    draw_batch_line(batch, current, next, COLOR_MONKEY_FUR, 2);
+    return;
+  }
+
   for (int i = 0; i < 3; i++) {
     int32_t angle = (m->tail_phase + i * 1500) & ANGLE_MASK;
-    int16_t curl = (sin_safe(angle) * 3) / TRIG_MAX_RATIO;
+    int16_t curl = fixed_sin_mul(angle, 3);
 
     next.x = current.x - m->direction * 3 + curl;
     next.y = current.y + 3;
 
-    graphics_draw_line(ctx, current, next);
+    draw_batch_line(batch, current, next, COLOR_MONKEY_FUR, 2);
     current = next;
   }
 
-  graphics_fill_circle(ctx, current, 1);
+  draw_batch_fill_circle(batch, current, 1, COLOR_MONKEY_FUR);
+}
+
+// Queues a pair of limbs (width-3 lines) ending in round hands
+static void draw_monkey_limbs(DrawBatch *batch, GPoint a0, GPoint a1, GPoint b0, GPoint b1, uint16_t hand) {
+  draw_batch_line(batch, a0, a1, COLOR_MONKEY_FUR, 3);
+  draw_batch_line(batch, b0, b1, COLOR_MONKEY_FUR, 3);
+  draw_batch_fill_circle(batch, a1, hand, COLOR_MONKEY_FUR);
+  draw_batch_fill_circle(batch, b1, hand, COLOR_MONKEY_FUR);
+}
+
+// Body fur and belly, offset for the falling tumble
+static void draw_monkey_body(DrawBatch *batch, GRect fur, GRect belly, uint8_t belly_radius) {
+  draw_batch_set_layer(batch, LAYER_FUR);
+  draw_batch_fill_rect(batch, fur, 3, COLOR_MONKEY_FUR);
+  draw_batch_set_layer(batch, LAYER_BELLY);
+  draw_batch_fill_rect(batch, belly, belly_radius, COLOR_MONKEY_BELLY);
+  draw_batch_set_layer(batch, LAYER_FUR);
 }
 
-static void draw_monkey(GContext *ctx, Monkey *m) {
-  if (!ctx || !m) return;
+static void draw_monkey(DrawBatch *batch, Monkey *m, FrameGovernorLod lod) {
+  if (!batch || !m) return;
 
   int16_t x = m->pos.x;
   int16_t y = m->pos.y;
@@ -894,241 +954,222 @@ static void draw_monkey(GContext *ctx, Monkey *m) {
     grip_point.y = (branch->start.y + branch->end.y) / 2;
   }
 
-  if (!hanging_upside_down) {
-    draw_monkey_tail(ctx, m, x, y);
+  // Minimal detail drops the tail altogether
+  bool tail = lod != FRAME_GOVERNOR_LOD_MINIMAL;
+  draw_batch_set_layer(batch, LAYER_FUR);
+  if (tail && !hanging_upside_down) {
+    draw_monkey_tail(batch, m, x, y, lod);
   }
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-  graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-  graphics_context_set_stroke_width(ctx, 3);
-
   if (hanging_upside_down) {
-    graphics_fill_rect(ctx, GRect(x - 5, y - 6, 10, 12), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3, y - 4, 6, 8), 2, GCornersAll);
-
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_draw_line(ctx, GPoint(x - 3, y - 6), GPoint(grip_point.x - 3, grip_point.y));
-    graphics_draw_line(ctx, GPoint(x + 3, y - 6), GPoint(grip_point.x + 3, grip_point.y));
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_circle(ctx, GPoint(grip_point.x - 3, grip_point.y), 2);
-    graphics_fill_circle(ctx, GPoint(grip_point.x + 3, grip_point.y), 2);
-
-    int arm_dangle = (sin_safe(m->limb_phase) * 3) / TRIG_MAX_RATIO;
-    graphics_draw_line(ctx, GPoint(x - 5, y + 4), GPoint(x - 7 + arm_dangle, y + 12));
-    graphics_draw_line(ctx, GPoint(x + 5, y + 4), GPoint(x + 7 - arm_dangle, y + 12));
-    graphics_fill_circle(ctx, GPoint(x - 7 + arm_dangle, y + 12), 2);
-    graphics_fill_circle(ctx, GPoint(x + 7 - arm_dangle, y + 12), 2);
+    draw_monkey_body(batch, GRect(x - 5, y - 6, 10, 12), GRect(x - 3, y - 4, 6, 8), 2);
+
+    draw_monkey_limbs(batch, GPoint(x - 3, y - 6), GPoint(grip_point.x - 3, grip_point.y),
+                      GPoint(x + 3, y - 6), GPoint(grip_point.x + 3, grip_point.y), 2);
+
+    int arm_dangle = fixed_sin_mul(m->limb_phase, 3);
+    draw_monkey_limbs(batch, GPoint(x - 5, y + 4), GPoint(x - 7 + arm_dangle, y + 12),
+                      GPoint(x + 5, y + 4), GPoint(x + 7 - arm_dangle, y + 12), 2);
 
   } else if (hanging_from_vine) {
-    graphics_context_set_stroke_color(ctx, COLOR_VINE);
-    graphics_context_set_stroke_width(ctx, 3);
-    graphics_draw_line(ctx, GPoint(x, y - 16), GPoint(x, CANOPY_TOP + 10));
-
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_rect(ctx, GRect(x - 5, y - 5, 10, 12), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3, y - 2, 6, 8), 2, GCornersAll);
-
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_context_set_stroke_width(ctx, 3);
-    graphics_draw_line(ctx, GPoint(x - 4, y - 5), GPoint(x, y - 16));
-    graphics_draw_line(ctx, GPoint(x + 4, y - 5), GPoint(x, y - 16));
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_circle(ctx, GPoint(x, y - 16), 3);
+    draw_batch_set_layer(batch, LAYER_GRIP_VINE);
+    draw_batch_line(batch, GPoint(x, y - 16), GPoint(x, CANOPY_TOP + 10), COLOR_VINE, 3);
+
+    draw_monkey_body(batch, GRect(x - 5, y - 5, 10, 12), GRect(x - 3, y - 2, 6, 8), 2);
+
+    draw_batch_line(batch, GPoint(x - 4, y - 5), GPoint(x, y - 16), COLOR_MONKEY_FUR, 3);
+    draw_batch_line(batch, GPoint(x + 4, y - 5), GPoint(x, y - 16), COLOR_MONKEY_FUR, 3);
+    draw_batch_fill_circle(batch, GPoint(x, y - 16), 3, COLOR_MONKEY_FUR);
 
     // safer leg swing
-    int leg_offset = (sin_safe(m->anim.rotation) * 6) / TRIG_MAX_RATIO;
-    graphics_draw_line(ctx, GPoint(x - 3, y + 7), GPoint(x - 5 - leg_offset, y + 15));
-    graphics_draw_line(ctx, GPoint(x + 3, y + 7), GPoint(x + 5 - leg_offset, y + 15));
-    graphics_fill_circle(ctx, GPoint(x - 5 - leg_offset, y + 15), 2);
-    graphics_fill_circle(ctx, GPoint(x + 5 - leg_offset, y + 15), 2);
+    int leg_offset = fixed_sin_mul(m->anim.rotation, 6);
+    draw_monkey_limbs(batch, GPoint(x - 3, y + 7), GPoint(x - 5 - leg_offset, y + 15),
+                      GPoint(x + 3, y + 7), GPoint(x + 5 - leg_offset, y + 15), 2);
 
   } else if (sitting) {
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_rect(ctx, GRect(x - 5, y - 3, 10, 10), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3, y - 1, 6, 7), 2, GCornersAll);
-
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_context_set_stroke_width(ctx, 3);
-    graphics_draw_line(ctx, GPoint(x - 4, y + 7), GPoint(x - 6, y + 5));
-    graphics_draw_line(ctx, GPoint(x + 4, y + 7), GPoint(x + 6, y + 5));
-    graphics_fill_circle(ctx, GPoint(x - 6, y + 5), 2);
-    graphics_fill_circle(ctx, GPoint(x + 6, y + 5), 2);
-
-    int munch_phase = (sin_safe(m->limb_phase) * 4) / TRIG_MAX_RATIO;
+    draw_monkey_body(batch, GRect(x - 5, y - 3, 10, 10), GRect(x - 3, y - 1, 6, 7), 2);
+
+    draw_monkey_limbs(batch, GPoint(x - 4, y + 7), GPoint(x - 6, y + 5),
+                      GPoint(x + 4, y + 7), GPoint(x + 6, y + 5), 2);
+
+    int munch_phase = fixed_sin_mul(m->limb_phase, 4);
     int apple_x = x + dir * 6;
     int apple_y = y - 8 + munch_phase;
 
-    graphics_draw_line(ctx, GPoint(x - dir * 5, y), GPoint(x - dir * 8, y + 5));
-    graphics_fill_circle(ctx, GPoint(x - dir * 8, y + 5), 2);
-
-    graphics_draw_line(ctx, GPoint(x + dir * 5, y - 2), GPoint(apple_x, apple_y + 3));
-    graphics_fill_circle(ctx, GPoint(apple_x, apple_y + 3), 2);
+    draw_monkey_limbs(batch, GPoint(x - dir * 5, y), GPoint(x - dir * 8, y + 5),
+                      GPoint(x + dir * 5, y - 2), GPoint(apple_x, apple_y + 3), 2);
 
     int bites = m->anim.target_branch;
     int apple_radius = clampi(5 - bites, 0, 5);
     if (apple_radius > 1) {
-      graphics_context_set_fill_color(ctx, COLOR_APPLE);
-      graphics_fill_circle(ctx, GPoint(apple_x, apple_y), apple_radius);
+      draw_batch_set_layer(batch, LAYER_APPLE);
+      draw_batch_fill_circle(batch, GPoint(apple_x, apple_y), apple_radius, COLOR_APPLE);
 
       if (bites > 0) {
-        graphics_context_set_fill_color(ctx, COLOR_APPLE_BITE);
-        graphics_fill_circle(ctx, GPoint(apple_x - dir * 2, apple_y), bites);
+        draw_batch_set_layer(batch, LAYER_APPLE_BITE);
+        draw_batch_fill_circle(batch, GPoint(apple_x - dir * 2, apple_y), bites, COLOR_APPLE_BITE);
       }
 
-      graphics_context_set_stroke_color(ctx, COLOR_BRANCH);
-      graphics_context_set_stroke_width(ctx, 1);
-      graphics_draw_line(ctx, GPoint(apple_x, apple_y - apple_radius),
-                              GPoint(apple_x + 1, apple_y - apple_radius - 2));
+      draw_batch_set_layer(batch, LAYER_APPLE_STEM);
+      draw_batch_line(batch, GPoint(apple_x, apple_y - apple_radius),
+                      GPoint(apple_x + 1, apple_y - apple_radius - 2), COLOR_BRANCH, 1);
     }
 
   } else if (fighting) {
     int fight_progress = clampi((m->anim.frame * 100) / FIGHT_FRAMES, 0, 100);
     bool tussling = (fight_progress >= 30 && fight_progress < 80);
 
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_rect(ctx, GRect(x - 5, y - 5, 10, 12), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3, y - 2, 6, 8), 2, GCornersAll);
-
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_context_set_stroke_width(ctx, 3);
+    draw_monkey_body(batch, GRect(x - 5, y - 5, 10, 12), GRect(x - 3, y - 2, 6, 8), 2);
 
     if (tussling) {
-      int arm_swing = (sin_safe(m->limb_phase * 3) * 10) / TRIG_MAX_RATIO;
-      graphics_draw_line(ctx, GPoint(x - 5, y - 2), GPoint(x - 12 + arm_swing, y - 8));
-      graphics_draw_line(ctx, GPoint(x + 5, y - 2), GPoint(x + 12 - arm_swing, y - 8));
-      graphics_fill_circle(ctx, GPoint(x - 12 + arm_swing, y - 8), 2);
-      graphics_fill_circle(ctx, GPoint(x + 12 - arm_swing, y - 8), 2);
+      int arm_swing = fixed_sin_mul(m->limb_phase * 3, 10);
+      draw_monkey_limbs(batch, GPoint(x - 5, y - 2), GPoint(x - 12 + arm_swing, y - 8),
+                        GPoint(x + 5, y - 2), GPoint(x + 12 - arm_swing, y - 8), 2);
     } else {
-      graphics_draw_line(ctx, GPoint(x - 5, y - 2), GPoint(x - 10, y - 6));
-      graphics_draw_line(ctx, GPoint(x + 5, y - 2), GPoint(x + 10, y - 6));
-      graphics_fill_circle(ctx, GPoint(x - 10, y - 6), 2);
-      graphics_fill_circle(ctx, GPoint(x + 10, y - 6), 2);
+      draw_monkey_limbs(batch, GPoint(x - 5, y - 2), GPoint(x - 10, y - 6),
+                        GPoint(x + 5, y - 2), GPoint(x + 10, y - 6), 2);
     }
 
-    graphics_draw_line(ctx, GPoint(x - 3, y + 7), GPoint(x - 7, y + 14));
-    graphics_draw_line(ctx, GPoint(x + 3, y + 7), GPoint(x + 7, y + 14));
-    graphics_fill_circle(ctx, GPoint(x - 7, y + 14), 2);
-    graphics_fill_circle(ctx, GPoint(x + 7, y + 14), 2);
+    draw_monkey_limbs(batch, GPoint(x - 3, y + 7), GPoint(x - 7, y + 14),
+                      GPoint(x + 3, y + 7), GPoint(x + 7, y + 14), 2);
 
   } else if (falling) {
     int fall_progress = clampi((m->anim.frame * 100) / FALLING_FRAMES, 0, 100);
 
-    int rot_offset_x = (sin_safe(m->anim.rotation) * 3) / TRIG_MAX_RATIO;
-    int rot_offset_y = (cos_safe(m->anim.rotation) * 2) / TRIG_MAX_RATIO;
-
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_rect(ctx, GRect(x - 5 + rot_offset_x, y - 5 + rot_offset_y, 10, 12), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3 + rot_offset_x, y - 2 + rot_offset_y, 6, 8), 2, GCornersAll);
-
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_context_set_stroke_width(ctx, 3);
+    int rot_offset_x = fixed_sin_mul(m->anim.rotation, 3);
+    int rot_offset_y = fixed_cos_mul(m->anim.rotation, 2);
 
-    int flail = (sin_safe(m->limb_phase) * 12) / TRIG_MAX_RATIO;
-    int flail2 = (cos_safe(m->limb_phase) * 10) / TRIG_MAX_RATIO;
+    draw_monkey_body(batch, GRect(x - 5 + rot_offset_x, y - 5 + rot_offset_y, 10, 12),
+                     GRect(x - 3 + rot_offset_x, y - 2 + rot_offset_y, 6, 8), 2);
 
-    graphics_draw_line(ctx, GPoint(x - 5, y - 2), GPoint(x - 10 + flail, y - 8 + flail2));
-    graphics_draw_line(ctx, GPoint(x + 5, y - 2), GPoint(x + 10 - flail, y - 6 - flail2));
-    graphics_fill_circle(ctx, GPoint(x - 10 + flail, y - 8 + flail2), 2);
-    graphics_fill_circle(ctx, GPoint(x + 10 - flail, y - 6 - flail2), 2);
+    int flail = fixed_sin_mul(m->limb_phase, 12);
+    int flail2 = fixed_cos_mul(m->limb_phase, 10);
 
-    graphics_draw_line(ctx, GPoint(x - 3, y + 7), GPoint(x - 8 - flail2, y + 14 + flail));
-    graphics_draw_line(ctx, GPoint(x + 3, y + 7), GPoint(x + 8 + flail2, y + 12 - flail));
-    graphics_fill_circle(ctx, GPoint(x - 8 - flail2, y + 14 + flail), 2);
-    graphics_fill_circle(ctx, GPoint(x + 8 + flail2, y + 12 - flail), 2);
+    draw_monkey_limbs(batch, GPoint(x - 5, y - 2), GPoint(x - 10 + flail, y - 8 + flail2),
+                      GPoint(x + 5, y - 2), GPoint(x + 10 - flail, y - 6 - flail2), 2);
+    draw_monkey_limbs(batch, GPoint(x - 3, y + 7), GPoint(x - 8 - flail2, y + 14 + flail),
+                      GPoint(x + 3, y + 7), GPoint(x + 8 + flail2, y + 12 - flail), 2);
 
     if (fall_progress >= 60) {
-      graphics_context_set_fill_color(ctx, COLOR_STAR);
+      draw_batch_set_layer(batch, LAYER_APPLE);
       int star_phase = fall_progress * 5;
       for (int i = 0; i < 3; i++) {
         int star_angle = (star_phase + i * TRIG_MAX_ANGLE / 3) & ANGLE_MASK;
-        int star_x = x + (sin_safe(star_angle) * 12) / TRIG_MAX_RATIO;
-        int star_y = y - 18 + (cos_safe(star_angle) * 5) / TRIG_MAX_RATIO;
-        graphics_fill_circle(ctx, GPoint(star_x, star_y), 2);
+        int star_x = x + fixed_sin_mul(star_angle, 12);
+        int star_y = y - 18 + fixed_cos_mul(star_angle, 5);
+        draw_batch_fill_circle(batch, GPoint(star_x, star_y), 2, COLOR_STAR);
       }
     }
 
   } else {
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-    graphics_fill_rect(ctx, GRect(x - 5, y - 5, 10, 12), 3, GCornersAll);
-    graphics_context_set_fill_color(ctx, COLOR_MONKEY_BELLY);
-    graphics_fill_rect(ctx, GRect(x - 3, y - 2, 6, 8), 2, GCornersAll);
+    draw_monkey_body(batch, GRect(x - 5, y - 5, 10, 12), GRect(x - 3, y - 2, 6, 8), 2);
 
-    graphics_context_set_stroke_color(ctx, COLOR_MONKEY_FUR);
-    graphics_context_set_stroke_width(ctx, 3);
     int spread = in_air ? 8 : 5;
-
-    graphics_draw_line(ctx, GPoint(x - 5, y), GPoint(x - spread, y - 2));
-    graphics_draw_line(ctx, GPoint(x + 5, y), GPoint(x + spread, y - 2));
-    graphics_fill_circle(ctx, GPoint(x - spread, y - 2), 2);
-    graphics_fill_circle(ctx, GPoint(x + spread, y - 2), 2);
-
-    graphics_draw_line(ctx, GPoint(x - 3, y + 7), GPoint(x - spread + 2, y + 12));
-    graphics_draw_line(ctx, GPoint(x + 3, y + 7), GPoint(x + spread - 2, y + 12));
-    graphics_fill_circle(ctx, GPoint(x - spread + 2, y + 12), 2);
-    graphics_fill_circle(ctx, GPoint(x + spread - 2, y + 12), 2);
+    draw_monkey_limbs(batch, GPoint(x - 5, y), GPoint(x - spread, y - 2),
+                      GPoint(x + 5, y), GPoint(x + spread, y - 2), 2);
+    draw_monkey_limbs(batch, GPoint(x - 3, y + 7), GPoint(x - spread + 2, y + 12),
+                      GPoint(x + 3, y + 7), GPoint(x + spread - 2, y + 12), 2);
   }
 
   // HEAD
   int head_y = hanging_upside_down ? y + 12 : y - 10;
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-  graphics_fill_circle(ctx, GPoint(x, head_y), 7);
+  draw_batch_set_layer(batch, LAYER_HEAD);
+  draw_batch_fill_circle(batch, GPoint(x, head_y), 7, COLOR_MONKEY_FUR);
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_FACE);
-  graphics_fill_circle(ctx, GPoint(x + dir * 2, head_y + (hanging_upside_down ? -1 : 1)), 5);
+  if (lod != FRAME_GOVERNOR_LOD_MINIMAL) {
+    draw_batch_set_layer(batch, LAYER_FACE);
+    draw_batch_fill_circle(batch, GPoint(x + dir * 2, head_y + (hanging_upside_down ? -1 : 1)), 5,
+                           COLOR_MONKEY_FACE);
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_FUR);
-  graphics_fill_circle(ctx, GPoint(x - 6, head_y), 3);
-  graphics_fill_circle(ctx, GPoint(x + 6, head_y), 3);
+    draw_batch_set_layer(batch, LAYER_EARS);
+    draw_batch_fill_circle(batch, GPoint(x - 6, head_y), 3, COLOR_MONKEY_FUR);
+    draw_batch_fill_circle(batch, GPoint(x + 6, head_y), 3, COLOR_MONKEY_FUR);
+  }
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_FACE);
-  graphics_fill_circle(ctx, GPoint(x - 6, head_y), 1);
-  graphics_fill_circle(ctx, GPoint(x + 6, head_y), 1);
+  // Ears, eyes and mouth: the first detail to go when frames run long
+  if (lod == FRAME_GOVERNOR_LOD_FULL) {
+    draw_batch_set_layer(batch, LAYER_FEATURES);
+    draw_batch_fill_circle(batch, GPoint(x - 6, head_y), 1, COLOR_MONKEY_FACE);
+    draw_batch_fill_circle(batch, GPoint(x + 6, head_y), 1, COLOR_MONKEY_FACE);
 
-  graphics_context_set_fill_color(ctx, COLOR_MONKEY_DARK);
-  int eye_y = head_y + (hanging_upside_down ? 2 : -2);
-  graphics_fill_circle(ctx, GPoint(x + dir * 1, eye_y), 1);
-  graphics_fill_circle(ctx, GPoint(x + dir * 4, eye_y), 1);
+    int eye_y = head_y + (hanging_upside_down ? 2 : -2);
+    draw_batch_fill_circle(batch, GPoint(x + dir * 1, eye_y), 1, COLOR_MONKEY_DARK);
+    draw_batch_fill_circle(batch, GPoint(x + dir * 4, eye_y), 1, COLOR_MONKEY_DARK);
 
-  graphics_context_set_stroke_color(ctx, COLOR_MONKEY_DARK);
-  graphics_context_set_stroke_width(ctx, 1);
-  int mouth_y = head_y + (hanging_upside_down ? -3 : 3);
-  graphics_draw_line(ctx, GPoint(x + dir * 1, mouth_y), GPoint(x + dir * 4, mouth_y));
+    int mouth_y = head_y + (hanging_upside_down ? -3 : 3);
+    draw_batch_line(batch, GPoint(x + dir * 1, mouth_y), GPoint(x + dir * 4, mouth_y), COLOR_MONKEY_DARK, 1);
+  }
 
-  if (hanging_upside_down) {
-    draw_monkey_tail(ctx, m, x, y);
+  if (tail && hanging_upside_down) {
+    draw_batch_set_layer(batch, LAYER_TAIL_OVER);
+    draw_monkey_tail(batch, m, x, y, lod);
   }
 }
 
-static void canvas_update_proc(Layer *layer, GContext *ctx) {
-  if (!layer || !ctx || !s_window_loaded || !s_fully_initialized) return;
+// ============================================================================
+// DIRTY RECTS
+// ============================================================================
 
-  graphics_context_set_fill_color(ctx, COLOR_SKY);
-  graphics_fill_rect(ctx, GRect(0, 0, SCREEN_WIDTH, CANOPY_TOP + 20), 0, GCornerNone);
+// Dirty tracker slots: one per monkey, one per vine
+#define DIRTY_MONKEY_BASE 0
+#define DIRTY_VINE_BASE   NUM_MONKEYS
+#define NUM_DIRTY_SLOTS   (NUM_MONKEYS + NUM_VINES)
+
+// Covers limbs, tail and the grip line up to the vine/branch
+static GRect monkey_bbox(const Monkey *m) {
+  if (!m->active) return GRectZero;
+  int16_t top = m->pos.y - 28;
+  if (top > CANOPY_TOP + 6) top = CANOPY_TOP + 6;
+  return GRect(m->pos.x - 24, top, 48, m->pos.y + 24 - top);
+}
 
-  graphics_context_set_fill_color(ctx, COLOR_SKY_LOW);
-  graphics_fill_rect(ctx, GRect(0, CANOPY_TOP + 20, SCREEN_WIDTH, GROUND_Y - CANOPY_TOP - 20), 0, GCornerNone);
+// Segments sway cumulatively, so the tip can drift segments * sway_amount
+static GRect vine_bbox(const Vine *v) {
+  int16_t reach = 4 * v->sway_amount + 4;
+  return GRect(v->top.x - reach, v->top.y - 2, 2 * reach, v->length + 6);
+}
 
-  draw_canopy(ctx);
-  draw_branches(ctx);
+static void update_dirty_rects(void) {
+  for (int i = 0; i < NUM_MONKEYS; i++) {
+    dirty_tracker_set_bbox(s_dirty, DIRTY_MONKEY_BASE + i, monkey_bbox(&s_monkeys[i]));
+  }
+  for (int v = 0; v < NUM_VINES; v++) {
+    dirty_tracker_set_bbox(s_dirty, DIRTY_VINE_BASE + v, vine_bbox(&s_vines[v]));
+  }
+  if (!bg_cache_is_valid(s_bg_cache)) dirty_tracker_mark_all(s_dirty);
+  dirty_tracker_commit(s_dirty);
+}
+
+static void repaint_all(void) {
+  if (!s_dirty || !s_window_loaded) return;
+  dirty_tracker_mark_all(s_dirty);
+  dirty_tracker_commit(s_dirty);
+}
+
+// Runs once per dirty clip layer; `layer` is the clip, drawing is in screen
+// coordinates
+static void canvas_update_proc(Layer *layer, GContext *ctx) {
+  if (!layer || !ctx || !s_window_loaded || !s_fully_initialized) return;
+  frame_governor_render_begin(s_governor);
+
+  bg_cache_draw(s_bg_cache, ctx, GRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
   draw_vines(ctx);
 
+  FrameGovernorLod lod = frame_governor_lod(s_governor);
+  draw_batch_begin(s_monkey_batch, ctx);
   for (int i = 0; i < NUM_MONKEYS; i++) {
-    if (i >= 0 && i < NUM_MONKEYS && s_monkeys[i].active) {
-      draw_monkey(ctx, &s_monkeys[i]);
+    if (s_monkeys[i].active && dirty_tracker_overlaps(layer, monkey_bbox(&s_monkeys[i]))) {
+      draw_monkey(s_monkey_batch, &s_monkeys[i], lod);
     }
   }
+  draw_batch_flush(s_monkey_batch);
 
-  draw_ground(ctx);
+  bg_cache_draw_overlay(s_bg_cache, ctx);
 
   // Battery indicator
-  int batt_x = SCREEN_WIDTH - 28;
-  int batt_y = 4;
+  int batt_x = s_battery_pos.x;
+  int batt_y = s_battery_pos.y;
   int batt_width = 22;
   int batt_height = 10;
 
@@ -1155,94 +1196,112 @@ static void canvas_update_proc(Layer *layer, GContext *ctx) {
 #endif
 
   graphics_fill_rect(ctx, GRect(batt_x + 2, batt_y + 2, fill_width, batt_height - 4), 0, GCornerNone);
+
+  frame_governor_render_end(s_governor);
 }
 
 // ============================================================================
 // TIMER
 // ============================================================================
 
-static void animation_timer_callback(void *data) {
-  // Clear timer handle first (it's no longer valid after firing)
-  s_animation_timer = NULL;
+// How fast the busiest monkey needs frames: 0 = munching, 100 = falling
+static uint8_t trick_activity(const Monkey *m) {
+  switch (m->anim.current_trick) {
+    case TRICK_SIT_MUNCH:  return 0;
+    case TRICK_HANG_LOOK:  return 30;
+    case TRICK_TAIL_HANG:  return 30;
+    case TRICK_CLIMB_VINE: return 60;
+    default:               return 100;  // swing, fight, fall
+  }
+}
+
+static uint8_t scene_activity(void) {
+  uint8_t activity = 0;
+  for (int i = 0; i < NUM_MONKEYS; i++) {
+    if (!s_monkeys[i].active) continue;
+    uint8_t a = trick_activity(&s_monkeys[i]);
+    if (a > activity) activity = a;
+  }
+  return activity;
+}
 
+// Called by the frame governor, which re-arms the timer afterwards
+static void animation_frame(void *context) {
   // If not running or window not present, stop here and don't reschedule
   if (!should_animate()) {
+    frame_governor_run(s_governor, false);
     return;
   }
 
-  // Update animation state with safety checks
-  update_vines();
-  for (int i = 0; i < NUM_MONKEYS; i++) {
-    if (i >= 0 && i < NUM_MONKEYS && s_monkeys[i].active) {
-      update_monkey(&s_monkeys[i]);
+  // At low FPS run the missed steps so tricks keep their real-time length
+  for (int step = frame_governor_steps(s_governor); step > 0; step--) {
+    update_vines();
+    for (int i = 0; i < NUM_MONKEYS; i++) {
+      if (s_monkeys[i].active) {
+        update_monkey(&s_monkeys[i]);
+      }
     }
   }
+  frame_governor_set_activity(s_governor, scene_activity());
 
-  if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
-
-  // Schedule next frame last, only if still running
-  if (should_animate() && !s_animation_timer) {
-    s_animation_timer = app_timer_register(get_animation_interval(), animation_timer_callback, NULL);
-  }
+  if (s_dirty) update_dirty_rects();
 }
 
 // ============================================================================
 // TIME + SERVICES
 // ============================================================================
 
+static const TimeTextConfig TIME_TEXT_CONFIG = {
+  .date_format = "%a %b %d",
+  .pad_hour = true,
+};
+
 static void update_time(void) {
   // Guard against calls when not ready
-  if (!s_fully_initialized || !s_window_loaded || !s_time_layer || !s_date_layer) return;
-
-  time_t temp = time(NULL);
-  struct tm *tick_time = localtime(&temp);
+  if (!s_fully_initialized || !s_window_loaded) return;
+  time_text_refresh(s_time_text);
+}
 
-  strftime(s_time_buffer, sizeof(s_time_buffer),
-           clock_is_24h_style() ? "%H:%M" : "%I:%M", tick_time);
-  text_layer_set_text(s_time_layer, s_time_buffer);
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+  if (!s_fully_initialized || !s_window_loaded) return;
+  uint8_t changed = time_text_update(s_time_text, tick_time, units_changed);
+  if (!s_running) return;  // repainted in full when focus returns
 
-  strftime(s_date_buffer, sizeof(s_date_buffer), "%a %b %d", tick_time);
-  text_layer_set_text(s_date_layer, s_date_buffer);
+  // Text layers are clear: repaint the scene under the strings that changed
+  if (changed & TIME_TEXT_TIME) {
+    dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_time_layer)));
+  }
+  if (changed & TIME_TEXT_DATE) {
+    dirty_tracker_add_rect(s_dirty, layer_get_frame(text_layer_get_layer(s_date_layer)));
+  }
+  // Animating: the next frame commits them; otherwise no frame is coming
+  if (!frame_governor_is_running(s_governor) || frame_governor_is_asleep(s_governor)) {
+    dirty_tracker_commit(s_dirty);
+  }
 }
 
-static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-  if (!s_running || !s_fully_initialized) return;
-  update_time();
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_did_change(void *context) {
+  bg_cache_invalidate(s_bg_cache);
+  repaint_all();
 }
+#endif
 
 static void battery_callback(BatteryChargeState state) {
   s_battery_level = state.charge_percent;
   s_is_charging = state.is_plugged;
+  frame_governor_set_battery(s_governor, state);
+  bg_cache_invalidate(s_bg_cache);  // canopy/grass detail depends on battery
   if (s_fully_initialized) {
-    ensure_timer_running();
-    if (s_canvas_layer && s_window_loaded) layer_mark_dirty(s_canvas_layer);
+    frame_governor_run(s_governor, should_animate());
+    repaint_all();
   }
 }
 
-static void accel_data_handler(AccelData *data, uint32_t num_samples) {
+// Vigorous shake: every monkey lets go of its vine
+static void shake_handler(void *context) {
   if (!s_running || !s_fully_initialized || !s_in_focus) return;
-  if (!data || num_samples == 0) return;
-
-  // Check cooldown
-  uint32_t now = time(NULL) * 1000;  // rough ms (second precision is enough)
-  if (now - s_last_shake_time < SHAKE_COOLDOWN_MS) return;
-
-  // Check for vigorous shake - look for high magnitude in any sample
-  bool vigorous = false;
-  for (uint32_t i = 0; i < num_samples && !vigorous; i++) {
-    int32_t x = data[i].x;
-    int32_t y = data[i].y;
-    int32_t z = data[i].z;
-    int32_t mag_sq = x * x + y * y + z * z;
-    if (mag_sq > SHAKE_THRESHOLD_SQ) {
-      vigorous = true;
-    }
-  }
 
-  if (!vigorous) return;
-
-  // Vigorous shake detected - trigger falls
-  s_last_shake_time = now;
   bool any_fell = false;
   for (int i = 0; i < NUM_MONKEYS; i++) {
     if (s_monkeys[i].active && s_monkeys[i].anim.current_trick != TRICK_FALLING) {
@@ -1250,30 +1309,41 @@ static void accel_data_handler(AccelData *data, uint32_t num_samples) {
       any_fell = true;
     }
   }
-  if (any_fell && s_vibes_enabled) vibes_short_pulse();
-  if (s_canvas_layer && s_window_loaded) layer_mark_dirty(s_canvas_layer);
+  if (any_fell && s_settings.vibes) vibes_short_pulse();
+  frame_governor_wake(s_governor);
+  frame_governor_set_activity(s_governor, scene_activity());
+  if (s_dirty && s_window_loaded) update_dirty_rects();
+}
+
+// Wrist flick: play another burst of tricks
+static void tap_handler(AccelAxisType axis, int32_t direction, void *context) {
+  if (!s_fully_initialized) return;
+  frame_governor_wake(s_governor);
 }
 
 // Connection change handler (pause when disconnected)
 static void bt_handler(bool connected) {
   s_bt_connected = connected;
   if (s_fully_initialized) {
-    ensure_timer_running();
+    frame_governor_run(s_governor, should_animate());
   }
 }
 
 // User button toggles for low power and vibrations
 static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
   if (!s_fully_initialized) return;
-  s_low_power_mode = !s_low_power_mode;
-  persist_write_bool(PERSIST_KEY_LOW_POWER, s_low_power_mode);
-  ensure_timer_running();
+  s_settings.low_power = !s_settings.low_power;
+  state_store_mark_dirty(s_settings_store);
+  bg_cache_invalidate(s_bg_cache);
+  repaint_all();  // vine segments + grass tufts change with low power
+  frame_governor_set_low_power(s_governor, s_settings.low_power);
+  frame_governor_run(s_governor, should_animate());
 }
 
 static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
   if (!s_fully_initialized) return;
-  s_vibes_enabled = !s_vibes_enabled;
-  persist_write_bool(PERSIST_KEY_VIBES, s_vibes_enabled);
+  s_settings.vibes = !s_settings.vibes;
+  state_store_mark_dirty(s_settings_store);
 }
 
 static void click_config_provider(void *context) {
@@ -1298,9 +1368,22 @@ static void main_window_load(Window *window) {
   init_branches();
   init_monkeys();
 
+  // No update proc on the canvas itself: the dirty tracker's clip layers
+  // draw, and the clear window background keeps the rest of the last frame
   s_canvas_layer = layer_create(bounds);
-  layer_set_update_proc(s_canvas_layer, canvas_update_proc);
   layer_add_child(window_layer, s_canvas_layer);
+  s_dirty = dirty_tracker_create(s_canvas_layer, NUM_DIRTY_SLOTS, canvas_update_proc);
+  s_monkey_batch = draw_batch_create(MONKEY_BATCH_SIZE);
+  s_battery_pos = round_mask_fit_rect(bounds, GRect(SCREEN_WIDTH - 28, BATTERY_Y, 24, 10)).origin;
+
+  s_bg_cache = bg_cache_create(draw_scenery);
+  bg_cache_set_overlay(s_bg_cache, GRect(0, GROUND_Y - 8, SCREEN_WIDTH, SCREEN_HEIGHT - GROUND_Y + 8),
+                       draw_scenery_front);
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+  unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+    .did_change = unobstructed_did_change
+  }, NULL);
+#endif
   window_set_click_config_provider(window, click_config_provider);
 
   s_time_layer = text_layer_create(GRect(0, TIME_Y, bounds.size.w, 38));
@@ -1317,6 +1400,10 @@ static void main_window_load(Window *window) {
   text_layer_set_text_alignment(s_date_layer, GTextAlignmentCenter);
   layer_add_child(window_layer, text_layer_get_layer(s_date_layer));
 
+  s_time_text = time_text_create(&TIME_TEXT_CONFIG, s_time_layer, s_date_layer);
+
+  s_governor = frame_governor_create(&GOVERNOR_CONFIG, animation_frame, NULL);
+  frame_governor_set_low_power(s_governor, s_settings.low_power);
   battery_callback(battery_state_service_peek());
 
   // Mark as fully initialized before updating time display
@@ -1324,9 +1411,10 @@ static void main_window_load(Window *window) {
 
   // Now safe to update time (guard checks s_fully_initialized)
   update_time();
+  repaint_all();
 
   // Start/stop animation loop based on current conditions
-  ensure_timer_running();
+  frame_governor_run(s_governor, should_animate());
 }
 
 static void main_window_unload(Window *window) {
@@ -1336,12 +1424,14 @@ static void main_window_unload(Window *window) {
   s_running = false;
 
   // Cancel timer before destroying anything
-  if (s_animation_timer) {
-    app_timer_cancel(s_animation_timer);
-    s_animation_timer = NULL;
+  if (s_governor) {
+    frame_governor_destroy(s_governor);
+    s_governor = NULL;
   }
 
   // ✅ destroy + NULL everything (prevents use-after-free crashes)
+  time_text_destroy(s_time_text);
+  s_time_text = NULL;
   if (s_time_layer) {
     text_layer_destroy(s_time_layer);
     s_time_layer = NULL;
@@ -1350,18 +1440,57 @@ static void main_window_unload(Window *window) {
     text_layer_destroy(s_date_layer);
     s_date_layer = NULL;
   }
+  if (s_dirty) {
+    dirty_tracker_destroy(s_dirty);
+    s_dirty = NULL;
+  }
+  if (s_monkey_batch) {
+    draw_batch_destroy(s_monkey_batch);
+    s_monkey_batch = NULL;
+  }
   if (s_canvas_layer) {
     layer_destroy(s_canvas_layer);
     s_canvas_layer = NULL;
   }
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+  unobstructed_area_service_unsubscribe();
+#endif
+  if (s_bg_cache) {
+    bg_cache_destroy(s_bg_cache);
+    s_bg_cache = NULL;
+  }
 }
 
 // ============================================================================
 // APP LIFECYCLE
 // ============================================================================
 
+// One bool key per setting, from before they were packed together. The old
+// keys go only once the packed blob is on flash; until then the next launch
+// migrates again.
+static void migrate_settings(void) {
+  bool low_power = persist_exists(PERSIST_KEY_LOW_POWER);
+  bool vibes = persist_exists(PERSIST_KEY_VIBES);
+  if (!low_power && !vibes) return;
+
+  if (low_power) s_settings.low_power = persist_read_bool(PERSIST_KEY_LOW_POWER);
+  if (vibes) s_settings.vibes = persist_read_bool(PERSIST_KEY_VIBES);
+
+  state_store_mark_dirty(s_settings_store);
+  if (!state_store_flush(s_settings_store)) return;
+  if (low_power) persist_delete(PERSIST_KEY_LOW_POWER);
+  if (vibes) persist_delete(PERSIST_KEY_VIBES);
+}
+
 static void init(void) {
+  // Load persisted settings first: window load reads them
+  s_settings_store = state_store_create(&SETTINGS_STORE_CONFIG, &s_settings, sizeof(s_settings));
+  if (!state_store_load(s_settings_store)) {
+    migrate_settings();
+  }
+
   s_main_window = window_create();
+  window_set_background_color(s_main_window, GColorClear);  // keep last frame for dirty rects
 
   window_set_window_handlers(s_main_window, (WindowHandlers) {
     .load = main_window_load,
@@ -1373,8 +1502,9 @@ static void init(void) {
   tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
   battery_state_service_subscribe(battery_callback);
 
-  // Use raw accel data for vigorous shake detection (25Hz, 5 samples per batch)
-  accel_data_service_subscribe(5, accel_data_handler);
+  // Shake detection at 10Hz in batches of 5; after the animation burst
+  // only wrist flicks are listened to until one wakes the scene
+  s_motion = motion_create(&MOTION_CONFIG, shake_handler, tap_handler, NULL);
 
   // Pause animation when app loses focus (e.g., notifications)
   app_focus_service_subscribe(focus_handler);
@@ -1382,22 +1512,17 @@ static void init(void) {
   // Pause animation when not connected to phone (saves power)
   bluetooth_connection_service_subscribe(bt_handler);
 
-  // Load persisted settings
-  if (persist_exists(PERSIST_KEY_LOW_POWER)) {
-    s_low_power_mode = persist_read_bool(PERSIST_KEY_LOW_POWER);
-  }
-  if (persist_exists(PERSIST_KEY_VIBES)) {
-    s_vibes_enabled = persist_read_bool(PERSIST_KEY_VIBES);
-  }
-
   s_bt_connected = bluetooth_connection_service_peek();
 }
 
 static void deinit(void) {
   s_running = false;
+  state_store_destroy(s_settings_store);  // flushes pending toggles
+  s_settings_store = NULL;
   tick_timer_service_unsubscribe();
   battery_state_service_unsubscribe();
-  accel_data_service_unsubscribe();
+  motion_destroy(s_motion);
+  s_motion = NULL;
   app_focus_service_unsubscribe();
   bluetooth_connection_service_unsubscribe();
 
@@ -1414,13 +1539,13 @@ static void focus_handler(bool in_focus) {
 
   // When losing focus, immediately stop timer
   if (!in_focus) {
-    if (s_animation_timer) {
-      app_timer_cancel(s_animation_timer);
-      s_animation_timer = NULL;
-    }
+    frame_governor_run(s_governor, false);
   } else {
     // When gaining focus, restart timer if conditions are met
-    ensure_timer_running();
+    repaint_all();
+    frame_governor_wake(s_governor);
+    motion_wake(s_motion);
+    frame_governor_run(s_governor, should_animate());
   }
 }
 